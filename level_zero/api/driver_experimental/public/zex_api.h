@@ -20,6 +20,7 @@
 // driver experimental API headers
 #include "level_zero/api/driver_experimental/public/zex_cmdlist.h"
 
+#include "zex_cmdqueue.h"
 #include "zex_driver.h"
 #include "zex_event.h"
 #include "zex_memory.h"
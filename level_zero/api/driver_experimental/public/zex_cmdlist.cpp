@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -67,4 +67,27 @@ zexCommandListAppendWriteToMemory(
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListBeginGraphCapture(
+    zex_command_list_handle_t hCommandList) {
+
+    if (!hCommandList) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    return L0::CommandList::fromHandle(hCommandList)->beginGraphCapture();
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListEndGraphCapture(
+    zex_command_list_handle_t hCommandList,
+    zex_command_list_handle_t *phGraph) {
+
+    if (!hCommandList) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    return L0::CommandList::fromHandle(hCommandList)->endGraphCapture(phGraph);
+}
 } // namespace L0
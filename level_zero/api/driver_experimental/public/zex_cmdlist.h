@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,4 +33,13 @@ zexCommandListAppendWriteToMemory(
     zex_write_to_mem_desc_t *desc,
     void *ptr,
     uint64_t data);
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListBeginGraphCapture(
+    zex_command_list_handle_t hCommandList);
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListEndGraphCapture(
+    zex_command_list_handle_t hCommandList,
+    zex_command_list_handle_t *phGraph);
 } // namespace L0
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/api/driver_experimental/public/zex_cmdqueue.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/direct_submission/direct_submission_telemetry.h"
+
+#include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
+
+namespace L0 {
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandQueueGetDirectSubmissionTelemetry(ze_command_queue_handle_t hCommandQueue, zex_direct_submission_telemetry_t *pTelemetry) {
+    auto commandQueue = static_cast<CommandQueueImp *>(CommandQueue::fromHandle(hCommandQueue));
+
+    if (!commandQueue || !pTelemetry) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto telemetry = commandQueue->getCsr()->getDirectSubmissionTelemetry();
+    if (!telemetry) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    static_assert(ZEX_DIRECT_SUBMISSION_TELEMETRY_HISTOGRAM_BUCKETS == NEO::LogScaleHistogram::bucketsCount);
+
+    pTelemetry->submissions = telemetry->submissions.load(std::memory_order_relaxed);
+    pTelemetry->ringStarts = telemetry->ringStarts.load(std::memory_order_relaxed);
+    pTelemetry->ringStops = telemetry->ringStops.load(std::memory_order_relaxed);
+    pTelemetry->ringSwitches = telemetry->ringSwitches.load(std::memory_order_relaxed);
+    for (uint32_t bucket = 0u; bucket < NEO::LogScaleHistogram::bucketsCount; bucket++) {
+        pTelemetry->dispatchCpuTimeNs[bucket] = telemetry->dispatchCpuTimeNs.getBucket(bucket);
+        pTelemetry->semaphoreSectionNs[bucket] = telemetry->semaphoreSectionNs.getBucket(bucket);
+        pTelemetry->relaxedOrderingQueueSize[bucket] = telemetry->relaxedOrderingQueueSize.getBucket(bucket);
+        pTelemetry->submitToGpuStartNs[bucket] = telemetry->submitToGpuStartNs.getBucket(bucket);
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
+} // namespace L0
@@ -0,0 +1,19 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "level_zero/api/driver_experimental/public/zex_common.h"
+#include <level_zero/ze_api.h>
+
+namespace L0 {
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandQueueGetDirectSubmissionTelemetry(
+    ze_command_queue_handle_t hCommandQueue,
+    zex_direct_submission_telemetry_t *pTelemetry);
+
+} // namespace L0
@@ -146,6 +146,30 @@ typedef struct _ze_intel_device_media_exp_properties_t {
     uint32_t numDecoderCores;                ///< [out] number of decoder cores
 } ze_intel_device_media_exp_properties_t;
 
+#ifndef ZEX_DIRECT_SUBMISSION_TELEMETRY_HISTOGRAM_BUCKETS
+/// @brief Number of log2 buckets in each direct submission telemetry histogram
+#define ZEX_DIRECT_SUBMISSION_TELEMETRY_HISTOGRAM_BUCKETS 32
+#endif // ZEX_DIRECT_SUBMISSION_TELEMETRY_HISTOGRAM_BUCKETS
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Forward-declare zex_direct_submission_telemetry_t
+typedef struct _zex_direct_submission_telemetry_t zex_direct_submission_telemetry_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Snapshot of direct submission (ULLS) telemetry of a command queue
+/// @details Bucket 0 of each histogram counts zero samples, bucket i counts samples in [2^(i-1), 2^i),
+///          the last bucket counts all larger samples.
+typedef struct _zex_direct_submission_telemetry_t {
+    uint64_t submissions;                                                                 ///< [out] number of command buffers submitted to the ring
+    uint64_t ringStarts;                                                                  ///< [out] number of ring buffer starts
+    uint64_t ringStops;                                                                   ///< [out] number of ring buffer stops
+    uint64_t ringSwitches;                                                                ///< [out] number of ring buffer switches
+    uint64_t dispatchCpuTimeNs[ZEX_DIRECT_SUBMISSION_TELEMETRY_HISTOGRAM_BUCKETS];        ///< [out] CPU time of dispatching command buffer into the ring, excluding time until GPU starts it, in nanoseconds
+    uint64_t semaphoreSectionNs[ZEX_DIRECT_SUBMISSION_TELEMETRY_HISTOGRAM_BUCKETS];       ///< [out] CPU time of programming semaphore section, in nanoseconds
+    uint64_t relaxedOrderingQueueSize[ZEX_DIRECT_SUBMISSION_TELEMETRY_HISTOGRAM_BUCKETS]; ///< [out] relaxed ordering scheduler queue size requested per submission
+    uint64_t submitToGpuStartNs[ZEX_DIRECT_SUBMISSION_TELEMETRY_HISTOGRAM_BUCKETS];       ///< [out] time from submitting command buffer on CPU until GPU starts executing it, in nanoseconds
+} zex_direct_submission_telemetry_t;
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
@@ -174,6 +174,12 @@ struct CommandList : _ze_command_list_handle_t {
     virtual ze_result_t appendCommandLists(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists,
                                            ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) = 0;
 
+    // Graph capture records appends of an immediate command list into an internal regular command list,
+    // which is handed out on end and can be replayed with a single appendCommandLists() call.
+    virtual ze_result_t beginGraphCapture() { return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE; }
+    virtual ze_result_t endGraphCapture(ze_command_list_handle_t *phGraph) { return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE; }
+    bool isCapturingGraph() const { return captureTarget != nullptr; }
+
     static CommandList *create(uint32_t productFamily, Device *device, NEO::EngineGroupType engineGroupType,
                                ze_command_list_flags_t flags, ze_result_t &resultValue,
                                bool internalUsage);
@@ -405,6 +411,7 @@ struct CommandList : _ze_command_list_handle_t {
     ze_context_handle_t hContext = nullptr;
     CommandQueue *cmdQImmediate = nullptr;
     CommandQueue *cmdQImmediateCopyOffload = nullptr;
+    CommandList *captureTarget = nullptr;
     Device *device = nullptr;
 
     size_t minimalSizeForBcsSplit = 4 * MemoryConstants::megaByte;
@@ -493,6 +493,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     ze_kernel_handle_t kernelHandle, const ze_group_count_t &threadGroupDimensions,
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
     CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendLaunchKernel(kernelHandle, threadGroupDimensions, hSignalEvent, numWaitEvents, phWaitEvents, launchParams, false);
+    }
 
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
     bool stallingCmdsForRelaxedOrdering = hasStallingCmdsForRelaxedOrdering(numWaitEvents, relaxedOrderingDispatch);
@@ -547,6 +550,10 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelIndirect(
     ze_kernel_handle_t kernelHandle, const ze_group_count_t &pDispatchArgumentsBuffer,
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendLaunchKernelIndirect(kernelHandle, pDispatchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -559,6 +566,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelInd
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendBarrier(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendBarrier(hSignalEvent, numWaitEvents, phWaitEvents, false);
+    }
+
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
     bool isStallingOperation = true;
@@ -592,6 +603,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMemoryCopy(dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents, false, forceDisableCopyOnlyInOrderSignaling);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, isCopyOffloadEnabled());
 
     auto estimatedSize = commonImmediateCommandSize;
@@ -646,6 +661,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMemoryCopyRegion(dstPtr, dstRegion, dstPitch, dstSlicePitch, srcPtr, srcRegion, srcPitch, srcSlicePitch,
+                                                     hSignalEvent, numWaitEvents, phWaitEvents, false, forceDisableCopyOnlyInOrderSignaling);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, isCopyOffloadEnabled());
 
     auto estimatedSize = commonImmediateCommandSize;
@@ -696,6 +716,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
                                                                             ze_event_handle_t hSignalEvent,
                                                                             uint32_t numWaitEvents,
                                                                             ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMemoryFill(ptr, pattern, patternSize, size, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -707,6 +731,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_event_handle_t hSignalEvent) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendSignalEvent(hSignalEvent);
+    }
+
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
@@ -717,6 +745,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_event_handle_t hSignalEvent) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendEventReset(hSignalEvent);
+    }
+
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
@@ -758,6 +790,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phWaitEvents, CommandToPatchContainer *outWaitCmds,
                                                                               bool relaxedOrderingAllowed, bool trackDependencies, bool apiRequest, bool skipAddingWaitEventsToResidency, bool skipFlush) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendWaitOnEvents(numEvents, phWaitEvents, outWaitCmds, false, trackDependencies, apiRequest, skipAddingWaitEventsToResidency, skipFlush);
+    }
+
     bool allSignaled = true;
     for (auto i = 0u; i < numEvents; i++) {
         allSignaled &= (!this->dcFlushSupport && Event::fromHandle(phWaitEvents[i])->isAlreadyCompleted());
@@ -784,6 +820,9 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteGlobalTimestamp(
     uint64_t *dstptr, ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendWriteGlobalTimestamp(dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
 
     checkAvailableSpace(numWaitEvents, false, commonImmediateCommandSize);
 
@@ -819,6 +858,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyRegion
                                                                                  ze_event_handle_t hSignalEvent,
                                                                                  uint32_t numWaitEvents,
                                                                                  ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendImageCopyRegion(hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     auto estimatedSize = commonImmediateCommandSize;
@@ -844,6 +887,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendImageCopyFromMemory(hDstImage, srcPtr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -862,6 +909,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendImageCopyToMemory(dstPtr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -882,6 +933,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendImageCopyFromMemoryExt(hDstImage, srcPtr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -902,6 +957,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendImageCopyToMemoryExt(dstPtr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -919,6 +978,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryRangesBar
                                                                                      ze_event_handle_t hSignalEvent,
                                                                                      uint32_t numWaitEvents,
                                                                                      ze_event_handle_t *phWaitEvents) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMemoryRangesBarrier(numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+
     checkAvailableSpace(numWaitEvents, false, commonImmediateCommandSize);
 
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryRangesBarrier(numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
@@ -927,6 +990,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryRangesBar
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnMemory(void *desc, void *ptr, uint64_t data, ze_event_handle_t signalEventHandle, bool useQwordData) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendWaitOnMemory(desc, ptr, data, signalEventHandle, useQwordData);
+    }
+
     checkAvailableSpace(0, false, commonImmediateCommandSize);
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWaitOnMemory(desc, ptr, data, signalEventHandle, useQwordData);
     return flushImmediate(ret, true, false, false, false, false, signalEventHandle);
@@ -934,6 +1001,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnMemory(vo
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteToMemory(void *desc, void *ptr, uint64_t data) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendWriteToMemory(desc, ptr, data);
+    }
+
     checkAvailableSpace(0, false, commonImmediateCommandSize);
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWriteToMemory(desc, ptr, data);
     return flushImmediate(ret, true, false, false, false, false, nullptr);
@@ -1484,16 +1555,303 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendCommandLists(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists,
                                                                               ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
 
+    if (this->isCapturingGraph()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    for (auto i = 0u; i < numCommandLists; i++) {
+        if (phCommandLists[i] == nullptr || CommandList::fromHandle(phCommandLists[i])->isImmediateType()) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    // Waits, dependency on prior work and signals are programmed to this command list without flushing and
+    // dispatched by the queue before and after the appended command lists, so all of them are a single submission.
+    auto commandStream = this->commandContainer.getCommandStream();
+    checkAvailableSpace(numWaitEvents, false, 2 * commonImmediateCommandSize);
+    size_t prologueStart = this->isFlushTaskSubmissionEnabled ? this->cmdListCurrentStartOffset : this->commandContainer.currentLinearStreamStartOffsetRef();
+
     auto ret = ZE_RESULT_SUCCESS;
     if (numWaitEvents) {
-        checkAvailableSpace(numWaitEvents, false, commonImmediateCommandSize);
         ret = this->appendWaitOnEvents(numWaitEvents, phWaitEvents, nullptr, false, true, true, true, true);
         if (ret != ZE_RESULT_SUCCESS) {
             return ret;
         }
     }
 
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    // Regular command lists are dispatched from the queue stream, so work already appended to this
+    // command list has to complete before they start.
+    if (isInOrderExecutionEnabled()) {
+        if (inOrderExecInfo->getCounterValue() > 0) {
+            CommandListCoreFamily<gfxCoreFamily>::appendWaitOnInOrderDependency(inOrderExecInfo, nullptr, inOrderExecInfo->getCounterValue(), inOrderExecInfo->getAllocationOffset(), false, true, false, false);
+        }
+    } else {
+        ret = CommandListCoreFamily<gfxCoreFamily>::appendBarrier(nullptr, 0, nullptr, false);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+    }
+
+    if (numCommandLists == 0) {
+        ret = appendCommandListsSignal(hSignalEvent);
+        return flushImmediate(ret, true, true, false, false, false, hSignalEvent);
+    }
+
+    auto commandStreamGpuAddress = commandStream->getGraphicsAllocation()->getGpuAddress();
+    typename CommandQueueHw<gfxCoreFamily>::ImmediateCommandListSections immediateSections{};
+    immediateSections.immediateCommandList = this;
+    if (commandStream->getUsed() != prologueStart) {
+        NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programBatchBufferEnd(*commandStream);
+        immediateSections.prologueGpuAddress = commandStreamGpuAddress + prologueStart;
+    }
+
+    size_t epilogueStart = commandStream->getUsed();
+    ret = appendCommandListsSignal(hSignalEvent);
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+    if (commandStream->getUsed() != epilogueStart) {
+        NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programBatchBufferEnd(*commandStream);
+        immediateSections.epilogueGpuAddress = commandStreamGpuAddress + epilogueStart;
+    }
+
+    auto signalEvent = Event::fromHandle(hSignalEvent);
+    if (signalEvent && (NEO::debugManager.flags.TrackNumCsrClientsOnSyncPoints.get() != 0)) {
+        signalEvent->setLatestUsedCmdQueue(this->cmdQImmediate);
+    }
+
+    this->commandContainer.removeDuplicatesFromResidencyContainer();
+    this->latestFlushIsCopyOffload = false;
+    ret = static_cast<CommandQueueHw<gfxCoreFamily> *>(this->cmdQImmediate)->executeCommandListsWithImmediateSections(numCommandLists, phCommandLists, immediateSections);
+
+    if (this->isFlushTaskSubmissionEnabled) {
+        this->cmdListCurrentStartOffset = commandStream->getUsed();
+    } else {
+        this->commandContainer.currentLinearStreamStartOffsetRef() = commandStream->getUsed();
+    }
+    this->handlePostSubmissionState();
+
+    this->latestFlushIsHostVisible = !this->dcFlushSupport;
+    if (signalEvent) {
+        signalEvent->setCsr(static_cast<CommandQueueImp *>(this->cmdQImmediate)->getCsr(), isInOrderExecutionEnabled());
+        this->latestFlushIsHostVisible |= signalEvent->isSignalScope(ZE_EVENT_SCOPE_FLAG_HOST);
+    }
+
+    if (ret == ZE_RESULT_SUCCESS && this->isSyncModeQueue) {
+        ret = hostSynchronize(std::numeric_limits<uint64_t>::max(), true);
+    }
+
+    return ret;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendCommandListsSignal(ze_event_handle_t hSignalEvent) {
+    if (hSignalEvent) {
+        return CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(hSignalEvent);
+    }
+
+    if (isInOrderExecutionEnabled()) {
+        // keep host synchronization and following appends ordered after the appended command lists
+        CommandListCoreFamily<gfxCoreFamily>::appendSignalInOrderDependencyCounter(nullptr, false);
+        CommandListCoreFamily<gfxCoreFamily>::handleInOrderDependencyCounter(nullptr, false, false);
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchMultipleKernelsIndirect(uint32_t numKernels,
+                                                                                               const ze_kernel_handle_t *kernelHandles,
+                                                                                               const uint32_t *pNumLaunchArguments,
+                                                                                               const ze_group_count_t *pLaunchArgumentsBuffer,
+                                                                                               ze_event_handle_t hSignalEvent,
+                                                                                               uint32_t numWaitEvents,
+                                                                                               ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendLaunchMultipleKernelsIndirect(numKernels, kernelHandles, pNumLaunchArguments, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    }
+    return BaseClass::appendLaunchMultipleKernelsIndirect(numKernels, kernelHandles, pNumLaunchArguments, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemAdvise(ze_device_handle_t hDevice, const void *ptr, size_t size, ze_memory_advice_t advice) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMemAdvise(hDevice, ptr, size, advice);
+    }
+    return BaseClass::appendMemAdvise(hDevice, ptr, size, advice);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryPrefetch(const void *ptr, size_t count) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMemoryPrefetch(ptr, count);
+    }
+    return BaseClass::appendMemoryPrefetch(ptr, count);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendQueryKernelTimestamps(uint32_t numEvents, ze_event_handle_t *phEvents, void *dstptr,
+                                                                                       const size_t *pOffsets, ze_event_handle_t hSignalEvent,
+                                                                                       uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendQueryKernelTimestamps(numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+    return BaseClass::appendQueryKernelTimestamps(numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMetricMemoryBarrier() {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMetricMemoryBarrier();
+    }
+    return BaseClass::appendMetricMemoryBarrier();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMetricStreamerMarker(zet_metric_streamer_handle_t hMetricStreamer, uint32_t value) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMetricStreamerMarker(hMetricStreamer, value);
+    }
+    return BaseClass::appendMetricStreamerMarker(hMetricStreamer, value);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMetricQueryBegin(zet_metric_query_handle_t hMetricQuery) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMetricQueryBegin(hMetricQuery);
+    }
+    return BaseClass::appendMetricQueryBegin(hMetricQuery);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMetricQueryEnd(zet_metric_query_handle_t hMetricQuery, ze_event_handle_t hSignalEvent,
+                                                                                uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMetricQueryEnd(hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+    return BaseClass::appendMetricQueryEnd(hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMILoadRegImm(uint32_t reg, uint32_t value, bool isBcs) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMILoadRegImm(reg, value, isBcs);
+    }
+    return BaseClass::appendMILoadRegImm(reg, value, isBcs);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMILoadRegReg(uint32_t reg1, uint32_t reg2) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMILoadRegReg(reg1, reg2);
+    }
+    return BaseClass::appendMILoadRegReg(reg1, reg2);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMILoadRegMem(uint32_t reg1, uint64_t address) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMILoadRegMem(reg1, address);
+    }
+    return BaseClass::appendMILoadRegMem(reg1, address);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMIStoreRegMem(uint32_t reg1, uint64_t address) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMIStoreRegMem(reg1, address);
+    }
+    return BaseClass::appendMIStoreRegMem(reg1, address);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMIMath(void *aluArray, size_t aluCount) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMIMath(aluArray, aluCount);
+    }
+    return BaseClass::appendMIMath(aluArray, aluCount);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMIBBStart(uint64_t address, size_t predication, bool secondLevel) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMIBBStart(address, predication, secondLevel);
+    }
+    return BaseClass::appendMIBBStart(address, predication, secondLevel);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMIBBEnd() {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMIBBEnd();
+    }
+    return BaseClass::appendMIBBEnd();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMINoop() {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendMINoop();
+    }
+    return BaseClass::appendMINoop();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPipeControl(void *dstPtr, uint64_t value) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendPipeControl(dstPtr, value);
+    }
+    return BaseClass::appendPipeControl(dstPtr, value);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSoftwareTag(const char *data) {
+    if (this->isCapturingGraph()) {
+        return this->captureTarget->appendSoftwareTag(data);
+    }
+    return BaseClass::appendSoftwareTag(data);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::beginGraphCapture() {
+    if (this->isCapturingGraph()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    ze_command_list_flags_t captureFlags = isInOrderExecutionEnabled() ? static_cast<ze_command_list_flags_t>(ZE_COMMAND_LIST_FLAG_IN_ORDER) : 0u;
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    auto productFamily = this->device->getNEODevice()->getHardwareInfo().platform.eProductFamily;
+
+    this->captureTarget = CommandList::create(productFamily, this->device, this->engineGroupType, captureFlags, returnValue, this->internalUsage);
+    if (this->captureTarget == nullptr) {
+        return returnValue;
+    }
+
+    this->captureTarget->setCmdListContext(this->hContext);
+    if (this->ordinal.has_value()) {
+        this->captureTarget->setOrdinal(this->ordinal.value());
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::endGraphCapture(ze_command_list_handle_t *phGraph) {
+    if (!this->isCapturingGraph() || phGraph == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto graph = this->captureTarget;
+    this->captureTarget = nullptr;
+
+    auto ret = graph->close();
+    if (ret != ZE_RESULT_SUCCESS) {
+        graph->destroy();
+        return ret;
+    }
+
+    *phGraph = graph->toHandle();
+    return ZE_RESULT_SUCCESS;
 }
 
 } // namespace L0
@@ -45,6 +45,11 @@ CommandListAllocatorFn commandListFactory[IGFX_MAX_PRODUCT] = {};
 CommandListAllocatorFn commandListFactoryImmediate[IGFX_MAX_PRODUCT] = {};
 
 ze_result_t CommandListImp::destroy() {
+    if (this->captureTarget) {
+        this->captureTarget->destroy();
+        this->captureTarget = nullptr;
+    }
+
     if (this->isBcsSplitNeeded) {
         static_cast<DeviceImp *>(this->device)->bcsSplit.releaseResources();
     }
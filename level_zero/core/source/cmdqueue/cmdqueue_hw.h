@@ -32,6 +32,17 @@ struct CommandQueueHw : public CommandQueueImp {
                                 void *phCommands,
                                 ze_fence_handle_t hFence) override;
 
+    // Commands of an immediate command list ended with MI_BATCH_BUFFER_END, dispatched
+    // before the first and after the last command list of the same submission
+    struct ImmediateCommandListSections {
+        CommandList *immediateCommandList = nullptr;
+        uint64_t prologueGpuAddress = 0;
+        uint64_t epilogueGpuAddress = 0;
+    };
+    ze_result_t executeCommandListsWithImmediateSections(uint32_t numCommandLists,
+                                                         ze_command_list_handle_t *phCommandLists,
+                                                         const ImmediateCommandListSections &immediateSections);
+
     void programStateBaseAddress(uint64_t gsba, bool useLocalMemoryForIndirectHeap, NEO::LinearStream &commandStream, bool cachedMOCSAllowed, NEO::StreamProperties *streamProperties);
     size_t estimateStateBaseAddressCmdSize();
     MOCKABLE_VIRTUAL void programFrontEnd(uint64_t scratchAddress, uint32_t perThreadScratchSpaceSlot0Size, NEO::LinearStream &commandStream, NEO::StreamProperties &streamProperties);
@@ -61,6 +72,12 @@ struct CommandQueueHw : public CommandQueueImp {
                        uint32_t perThreadScratchSpaceSlot1Size);
 
   protected:
+    ze_result_t executeCommandListsImpl(uint32_t numCommandLists,
+                                        ze_command_list_handle_t *phCommandLists,
+                                        ze_fence_handle_t hFence, bool performMigration,
+                                        NEO::LinearStream *parentImmediateCommandlistLinearStream,
+                                        const ImmediateCommandListSections *immediateSections);
+
     struct CommandListExecutionContext {
 
         CommandListExecutionContext() {}
@@ -88,6 +105,7 @@ struct CommandQueueHw : public CommandQueueImp {
         void *currentPatchForChainedBbStart = nullptr;
         NEO::ScratchSpaceController *scratchSpaceController = nullptr;
         NEO::GraphicsAllocation *globalStatelessAllocation = nullptr;
+        const ImmediateCommandListSections *immediateSections = nullptr;
 
         NEO::PreemptionMode preemptionMode{};
         NEO::PreemptionMode statePreemption{};
@@ -154,6 +172,9 @@ struct CommandQueueHw : public CommandQueueImp {
     inline size_t estimateCommandListSecondaryStart(CommandList *commandList);
     inline size_t estimateCommandListPrimaryStart(bool required);
     inline size_t estimateCommandListResidencySize(CommandList *commandList);
+    inline size_t estimateImmediateCommandListSectionsSize(CommandListExecutionContext &ctx);
+    inline void makeImmediateCommandListSectionsResident(CommandListExecutionContext &ctx);
+    inline void programImmediateCommandListSection(uint64_t sectionGpuAddress, NEO::LinearStream &commandStream);
     inline void setFrontEndStateProperties(CommandListExecutionContext &ctx);
     inline void handleScratchSpaceAndUpdateGSBAStateDirtyFlag(CommandListExecutionContext &ctx);
     inline size_t estimateLinearStreamSizeComplementary(CommandListExecutionContext &ctx,
@@ -65,6 +65,25 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     ze_fence_handle_t hFence,
     bool performMigration,
     NEO::LinearStream *parentImmediateCommandlistLinearStream) {
+    return executeCommandListsImpl(numCommandLists, phCommandLists, hFence, performMigration, parentImmediateCommandlistLinearStream, nullptr);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsWithImmediateSections(
+    uint32_t numCommandLists,
+    ze_command_list_handle_t *phCommandLists,
+    const ImmediateCommandListSections &immediateSections) {
+    return executeCommandListsImpl(numCommandLists, phCommandLists, nullptr, true, nullptr, &immediateSections);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsImpl(
+    uint32_t numCommandLists,
+    ze_command_list_handle_t *phCommandLists,
+    ze_fence_handle_t hFence,
+    bool performMigration,
+    NEO::LinearStream *parentImmediateCommandlistLinearStream,
+    const ImmediateCommandListSections *immediateSections) {
 
     auto ret = ZE_RESULT_SUCCESS;
 
@@ -105,6 +124,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
                       !this->commandQueueDebugCmdsProgrammed &&
                       device->getL0Debugger();
     ctx.lockScratchController = lockScratchController;
+    ctx.immediateSections = immediateSections;
 
     this->startingCmdBuffer = &this->commandStream;
 
@@ -169,6 +189,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsRegularHeapless(
     this->makeSbaTrackingBufferResidentIfL0DebuggerEnabled(ctx.isDebugEnabled);
 
     this->makeCsrTagAllocationResident();
+    this->makeImmediateCommandListSectionsResident(ctx);
 
     if (instructionCacheFlushRequired) {
         NEO::MemorySynchronizationCommands<GfxFamily>::addInstructionCacheFlush(child);
@@ -184,6 +205,9 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsRegularHeapless(
         auto commandList = CommandList::fromHandle(commandListHandles[i]);
 
         ctx.childGpuAddressPositionBeforeDynamicPreamble = child.getCurrentGpuAddressPosition();
+        if (i == 0 && ctx.immediateSections) {
+            this->programImmediateCommandListSection(ctx.immediateSections->prologueGpuAddress, child);
+        }
 
         this->patchCommands(*commandList, ctx);
         this->programOneCmdListBatchBufferStart(commandList, child, ctx);
@@ -198,6 +222,9 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsRegularHeapless(
 
     this->migrateSharedAllocationsIfRequested(ctx.isMigrationRequested, ctx.firstCommandList);
     this->programLastCommandListReturnBbStart(child, ctx);
+    if (ctx.immediateSections) {
+        this->programImmediateCommandListSection(ctx.immediateSections->epilogueGpuAddress, child);
+    }
     this->assignCsrTaskCountToFenceIfAvailable(hFence);
     this->dispatchTaskCountPostSyncRegular(ctx.isDispatchTaskCountPostSyncRequired, child);
 
@@ -236,6 +263,7 @@ size_t CommandQueueHw<gfxCoreFamily>::estimateStreamSizeForExecuteCommandListsRe
         linearStreamSizeEstimate += estimateCommandListSecondaryStart(cmdList);
         ctx.spaceForResidency += estimateCommandListResidencySize(cmdList);
     }
+    linearStreamSizeEstimate += estimateImmediateCommandListSectionsSize(ctx);
 
     if (ctx.isDispatchTaskCountPostSyncRequired) {
         linearStreamSizeEstimate += NEO::MemorySynchronizationCommands<GfxFamily>::getSizeForBarrierWithPostSyncOperation(this->device->getNEODevice()->getRootDeviceEnvironment(), false);
@@ -315,6 +343,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsRegular(
     this->makeRayTracingBufferResident(neoDevice->getRTMemoryBackedBuffer());
     this->makeSbaTrackingBufferResidentIfL0DebuggerEnabled(ctx.isDebugEnabled);
     this->makeCsrTagAllocationResident();
+    this->makeImmediateCommandListSectionsResident(ctx);
 
     if (ctx.globalInit) {
         if (stateCacheFlushRequired) {
@@ -372,6 +401,9 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsRegular(
         auto commandList = CommandList::fromHandle(commandListHandles[i]);
 
         ctx.childGpuAddressPositionBeforeDynamicPreamble = child.getCurrentGpuAddressPosition();
+        if (i == 0 && ctx.immediateSections) {
+            this->programImmediateCommandListSection(ctx.immediateSections->prologueGpuAddress, child);
+        }
 
         if (this->stateChanges.size() > this->currentStateChangeIndex) {
             auto &stateChange = this->stateChanges[this->currentStateChangeIndex];
@@ -402,6 +434,9 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsRegular(
     this->migrateSharedAllocationsIfRequested(ctx.isMigrationRequested, ctx.firstCommandList);
 
     this->programLastCommandListReturnBbStart(child, ctx);
+    if (ctx.immediateSections) {
+        this->programImmediateCommandListSection(ctx.immediateSections->epilogueGpuAddress, child);
+    }
     this->assignCsrTaskCountToFenceIfAvailable(hFence);
     this->dispatchTaskCountPostSyncRegular(ctx.isDispatchTaskCountPostSyncRequired, child);
 
@@ -466,6 +501,9 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsCopyOnly(
     for (auto i = 0u; i < numCommandLists; ++i) {
         auto commandList = CommandList::fromHandle(phCommandLists[i]);
         ctx.childGpuAddressPositionBeforeDynamicPreamble = child.getCurrentGpuAddressPosition();
+        if (i == 0 && ctx.immediateSections) {
+            this->programImmediateCommandListSection(ctx.immediateSections->prologueGpuAddress, child);
+        }
 
         this->programOneCmdListBatchBufferStart(commandList, child, ctx);
         this->prefetchMemoryToDeviceAssociatedWithCmdList(commandList);
@@ -475,10 +513,14 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsCopyOnly(
     this->assignCsrTaskCountToFenceIfAvailable(hFence);
 
     this->programLastCommandListReturnBbStart(child, ctx);
+    if (ctx.immediateSections) {
+        this->programImmediateCommandListSection(ctx.immediateSections->epilogueGpuAddress, child);
+    }
 
     this->dispatchTaskCountPostSyncByMiFlushDw(ctx.isDispatchTaskCountPostSyncRequired, fenceRequired, child);
 
     this->makeCsrTagAllocationResident();
+    this->makeImmediateCommandListSectionsResident(ctx);
     auto submitResult = this->prepareAndSubmitBatchBuffer(ctx, child);
     this->updateTaskCountAndPostSync(ctx.isDispatchTaskCountPostSyncRequired);
     this->csr->makeSurfacePackNonResident(this->csr->getResidencyAllocations(), false);
@@ -819,6 +861,8 @@ size_t CommandQueueHw<gfxCoreFamily>::estimateLinearStreamSizeInitial(
         ctx.globalInit = true;
     }
 
+    linearStreamSizeEstimate += estimateImmediateCommandListSectionsSize(ctx);
+
     return linearStreamSizeEstimate;
 }
 
@@ -843,6 +887,32 @@ size_t CommandQueueHw<gfxCoreFamily>::estimateCommandListResidencySize(CommandLi
     return commandList->getCmdContainer().getResidencyContainer().size();
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+size_t CommandQueueHw<gfxCoreFamily>::estimateImmediateCommandListSectionsSize(CommandListExecutionContext &ctx) {
+    if (ctx.immediateSections == nullptr) {
+        return 0;
+    }
+    ctx.spaceForResidency += estimateCommandListResidencySize(ctx.immediateSections->immediateCommandList) + 1;
+    return 2 * NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::getBatchBufferStartSize();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandQueueHw<gfxCoreFamily>::makeImmediateCommandListSectionsResident(CommandListExecutionContext &ctx) {
+    if (ctx.immediateSections == nullptr) {
+        return;
+    }
+    auto &commandContainer = ctx.immediateSections->immediateCommandList->getCmdContainer();
+    makeResidentAndMigrate(ctx.isMigrationRequested, commandContainer.getResidencyContainer());
+    this->csr->makeResident(*commandContainer.getCommandStream()->getGraphicsAllocation());
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandQueueHw<gfxCoreFamily>::programImmediateCommandListSection(uint64_t sectionGpuAddress, NEO::LinearStream &commandStream) {
+    if (sectionGpuAddress != 0) {
+        NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programBatchBufferStart(&commandStream, sectionGpuAddress, true, false, false);
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandQueueHw<gfxCoreFamily>::setFrontEndStateProperties(CommandListExecutionContext &ctx) {
 
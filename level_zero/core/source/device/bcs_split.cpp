@@ -13,6 +13,9 @@
 
 #include "level_zero/core/source/device/device_imp.h"
 
+#include <algorithm>
+#include <numeric>
+
 namespace L0 {
 
 bool BcsSplit::setupDevice(uint32_t productFamily, bool internalUsage, const ze_command_queue_desc_t *desc, NEO::CommandStreamReceiver *csr) {
@@ -66,6 +69,12 @@ bool BcsSplit::setupDevice(uint32_t productFamily, bool internalUsage, const ze_
         this->cmdQs.push_back(commandQueue);
     }
 
+    this->planner.enabled = NEO::debugManager.flags.SplitBcsAdaptive.get() == 1;
+    if (NEO::debugManager.flags.SplitBcsAdaptiveOverheadUs.get() != -1) {
+        this->planner.splitOverheadNs = NEO::debugManager.flags.SplitBcsAdaptiveOverheadUs.get() * 1000.0;
+        this->planner.learnOverhead = false;
+    }
+
     if (NEO::debugManager.flags.SplitBcsMaskH2D.get() > 0) {
         this->h2dEngines = NEO::debugManager.flags.SplitBcsMaskH2D.get();
     }
@@ -101,6 +110,7 @@ void BcsSplit::releaseResources() {
         d2hCmdQs.clear();
         h2dCmdQs.clear();
         this->events.releaseResources();
+        this->planner.reset();
     }
 }
 
@@ -119,6 +129,7 @@ std::optional<size_t> BcsSplit::Events::obtainForSplit(Context *context, size_t
     for (size_t i = 0; i < this->marker.size(); i++) {
         auto ret = this->marker[i]->queryStatus();
         if (ret == ZE_RESULT_SUCCESS) {
+            this->collectThroughputSamples(i);
             this->resetEventPackage(i);
             return i;
         }
@@ -130,6 +141,7 @@ std::optional<size_t> BcsSplit::Events::obtainForSplit(Context *context, size_t
     }
 
     this->marker[0]->hostSynchronize(std::numeric_limits<uint64_t>::max());
+    this->collectThroughputSamples(0);
     this->resetEventPackage(0);
     return 0;
 }
@@ -148,6 +160,10 @@ std::optional<size_t> BcsSplit::Events::allocateNew(Context *context, size_t max
         ze_event_pool_desc_t desc{};
         desc.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
         desc.count = static_cast<uint32_t>(maxEventCountInPool);
+        if (this->bcsSplit.planner.enabled) {
+            // subcopy timestamps feed the per engine throughput estimates
+            desc.flags = ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP;
+        }
         auto hDevice = this->bcsSplit.device.toHandle();
         auto pool = EventPool::create(this->bcsSplit.device.getDriverHandle(), context, 1, &hDevice, &desc, result);
         if (!pool) {
@@ -182,12 +198,39 @@ std::optional<size_t> BcsSplit::Events::allocateNew(Context *context, size_t max
             this->barrier.push_back(Event::fromHandle(hEvent));
         } else {
             this->subcopy.push_back(Event::fromHandle(hEvent));
+            this->subcopySize.push_back(0u);
         }
     }
+    this->splitDirection.push_back(NEO::TransferDirection::localToLocal);
 
     return this->marker.size() - 1;
 }
 
+void BcsSplit::Events::collectThroughputSamples(size_t index) {
+    if (!this->bcsSplit.planner.enabled) {
+        return;
+    }
+
+    auto direction = this->splitDirection[index];
+    auto engineCount = this->bcsSplit.getCmdQsForSplit(direction).size();
+    auto timerResolution = this->bcsSplit.device.getNEODevice()->getDeviceInfo().profilingTimerResolution;
+
+    for (size_t j = 0; j < engineCount; j++) {
+        auto subcopyIndex = index * this->bcsSplit.cmdQs.size() + j;
+        if (this->subcopySize[subcopyIndex] == 0u) {
+            continue;
+        }
+
+        ze_kernel_timestamp_result_t timestamp = {};
+        if (this->subcopy[subcopyIndex]->queryKernelTimestamp(&timestamp) == ZE_RESULT_SUCCESS &&
+            timestamp.context.kernelEnd > timestamp.context.kernelStart) {
+            auto durationNs = static_cast<uint64_t>((timestamp.context.kernelEnd - timestamp.context.kernelStart) * timerResolution);
+            this->bcsSplit.planner.addSample(direction, j, engineCount, this->subcopySize[subcopyIndex], durationNs);
+        }
+        this->subcopySize[subcopyIndex] = 0u;
+    }
+}
+
 void BcsSplit::Events::resetEventPackage(size_t index) {
     this->marker[index]->reset();
     this->barrier[index]->reset();
@@ -209,9 +252,146 @@ void BcsSplit::Events::releaseResources() {
         barrierEvent->destroy();
     }
     barrier.clear();
+    subcopySize.clear();
+    splitDirection.clear();
     for (auto &pool : this->pools) {
         pool->destroy();
     }
     pools.clear();
 }
+
+void BcsSplit::Planner::addSample(NEO::TransferDirection direction, size_t engineIndex, size_t engineCount, size_t size, uint64_t durationNs) {
+    if (!this->enabled || durationNs == 0u) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(this->mtx);
+    auto &directionStats = this->stats[static_cast<size_t>(direction)];
+    if (directionStats.size() != engineCount) {
+        directionStats.assign(engineCount, EngineStats{});
+    }
+
+    auto sampleSize = static_cast<double>(size);
+    auto sampleDurationNs = static_cast<double>(durationNs);
+    auto &engineStats = directionStats[engineIndex];
+    auto weight = engineStats.samples == 0u ? 1.0 : sampleWeight;
+    auto accumulate = [weight](double &mean, double sample) { mean = (1.0 - weight) * mean + weight * sample; };
+    accumulate(engineStats.bytesPerNs, sampleSize / sampleDurationNs);
+    accumulate(engineStats.meanSize, sampleSize);
+    accumulate(engineStats.meanDurationNs, sampleDurationNs);
+    accumulate(engineStats.meanSizeSquared, sampleSize * sampleSize);
+    accumulate(engineStats.meanSizeDurationNs, sampleSize * sampleDurationNs);
+    engineStats.samples++;
+}
+
+double BcsSplit::Planner::getSplitOverheadNs(NEO::TransferDirection direction) {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    return getSplitOverheadNsLocked(this->stats[static_cast<size_t>(direction)]);
+}
+
+double BcsSplit::Planner::getSplitOverheadNsLocked(const std::vector<EngineStats> &directionStats) const {
+    if (!this->learnOverhead) {
+        return this->splitOverheadNs;
+    }
+
+    // Fit is meaningful only for engines which have seen copies of noticeably different sizes
+    double overheadSum = 0.0;
+    uint32_t fittedEngines = 0u;
+    for (auto &engineStats : directionStats) {
+        if (engineStats.samples < 2u) {
+            continue;
+        }
+        auto sizeVariance = engineStats.meanSizeSquared - engineStats.meanSize * engineStats.meanSize;
+        auto minSizeSpread = minRelativeSizeSpread * engineStats.meanSize;
+        if (sizeVariance <= minSizeSpread * minSizeSpread) {
+            continue;
+        }
+        auto covariance = engineStats.meanSizeDurationNs - engineStats.meanSize * engineStats.meanDurationNs;
+        auto nsPerByte = covariance / sizeVariance;
+        overheadSum += std::max(0.0, engineStats.meanDurationNs - nsPerByte * engineStats.meanSize);
+        fittedEngines++;
+    }
+
+    return fittedEngines > 0u ? overheadSum / fittedEngines : this->splitOverheadNs;
+}
+
+void BcsSplit::Planner::planChunks(NEO::TransferDirection direction, size_t engineCount, size_t size, ChunkSizes &chunks) {
+    chunks.clear();
+    chunks.resize(engineCount, 0u);
+
+    StackVec<double, 4> bandwidths;
+    double overheadNs = this->splitOverheadNs;
+    if (this->enabled) {
+        std::lock_guard<std::mutex> lock(this->mtx);
+        auto &directionStats = this->stats[static_cast<size_t>(direction)];
+        if (directionStats.size() == engineCount &&
+            std::all_of(directionStats.begin(), directionStats.end(), [](const EngineStats &engineStats) { return engineStats.samples > 0u; })) {
+            for (auto &engineStats : directionStats) {
+                bandwidths.push_back(engineStats.bytesPerNs);
+            }
+            overheadNs = getSplitOverheadNsLocked(directionStats);
+        }
+    }
+
+    auto splitEvenly = [&]() {
+        auto remainingSize = size;
+        for (size_t i = 0; i < engineCount; i++) {
+            chunks[i] = remainingSize / (engineCount - i);
+            remainingSize -= chunks[i];
+        }
+    };
+
+    if (bandwidths.empty()) {
+        splitEvenly();
+        return;
+    }
+
+    StackVec<size_t, 4> order;
+    order.resize(engineCount);
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&bandwidths](size_t lhs, size_t rhs) { return bandwidths[lhs] > bandwidths[rhs]; });
+
+    // Every additional engine costs a submission and a dependency, so use only as many of the fastest engines as pay off.
+    size_t usedEngines = 1u;
+    double usedBandwidth = bandwidths[order[0]];
+    double bestTime = size / usedBandwidth;
+    double bandwidthSum = usedBandwidth;
+    for (size_t i = 1; i < engineCount; i++) {
+        bandwidthSum += bandwidths[order[i]];
+        auto time = size / bandwidthSum + i * overheadNs;
+        if (time < bestTime) {
+            bestTime = time;
+            usedEngines = i + 1;
+            usedBandwidth = bandwidthSum;
+        }
+    }
+
+    if (usedEngines < engineCount) {
+        // Idle engines produce no samples, so split evenly once in a while to refresh their estimates
+        std::lock_guard<std::mutex> lock(this->mtx);
+        auto &plansCount = this->plansSinceExploration[static_cast<size_t>(direction)];
+        if (++plansCount >= explorationInterval) {
+            plansCount = 0u;
+            splitEvenly();
+            return;
+        }
+    }
+
+    auto remainingSize = size;
+    for (size_t i = 0; i + 1 < usedEngines; i++) {
+        auto chunk = static_cast<size_t>(size * (bandwidths[order[i]] / usedBandwidth));
+        chunk = std::min(chunk, remainingSize);
+        chunks[order[i]] = chunk;
+        remainingSize -= chunk;
+    }
+    chunks[order[usedEngines - 1]] = remainingSize;
+}
+
+void BcsSplit::Planner::reset() {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    for (auto &directionStats : this->stats) {
+        directionStats.clear();
+    }
+    this->plansSinceExploration.fill(0u);
+}
 } // namespace L0
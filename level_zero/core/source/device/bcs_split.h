@@ -16,6 +16,7 @@
 #include "level_zero/core/source/context/context.h"
 #include "level_zero/core/source/event/event.h"
 
+#include <array>
 #include <functional>
 #include <mutex>
 #include <vector>
@@ -34,6 +35,41 @@ struct BcsSplit {
 
     std::mutex mtx;
 
+    struct Planner {
+        static constexpr size_t directionsCount = 4u;
+        static constexpr double defaultSplitOverheadNs = 10000.0;
+        static constexpr double sampleWeight = 0.25;
+        static constexpr double minRelativeSizeSpread = 0.1;
+        static constexpr uint32_t explorationInterval = 16u;
+
+        // Running weighted moments of (size, duration) samples. Intercept of linear fit of duration against size
+        // is the fixed cost of a copy on the engine, independent of its size.
+        struct EngineStats {
+            double bytesPerNs = 0.0;
+            double meanSize = 0.0;
+            double meanDurationNs = 0.0;
+            double meanSizeSquared = 0.0;
+            double meanSizeDurationNs = 0.0;
+            uint32_t samples = 0u;
+        };
+
+        using ChunkSizes = StackVec<size_t, 4>;
+
+        std::mutex mtx;
+        std::array<std::vector<EngineStats>, directionsCount> stats;
+        std::array<uint32_t, directionsCount> plansSinceExploration = {};
+        // Used until overhead is learned from samples of different sizes, or always when learnOverhead is false
+        double splitOverheadNs = defaultSplitOverheadNs;
+        bool learnOverhead = true;
+        bool enabled = false;
+
+        void addSample(NEO::TransferDirection direction, size_t engineIndex, size_t engineCount, size_t size, uint64_t durationNs);
+        void planChunks(NEO::TransferDirection direction, size_t engineCount, size_t size, ChunkSizes &chunks);
+        double getSplitOverheadNs(NEO::TransferDirection direction);
+        void reset();
+        double getSplitOverheadNsLocked(const std::vector<EngineStats> &directionStats) const;
+    } planner;
+
     struct Events {
         BcsSplit &bcsSplit;
 
@@ -42,10 +78,13 @@ struct BcsSplit {
         std::vector<Event *> barrier;
         std::vector<Event *> subcopy;
         std::vector<Event *> marker;
+        std::vector<size_t> subcopySize;
+        std::vector<NEO::TransferDirection> splitDirection;
         size_t createdFromLatestPool = 0u;
 
         std::optional<size_t> obtainForSplit(Context *context, size_t maxEventCountInPool);
         std::optional<size_t> allocateNew(Context *context, size_t maxEventCountInPool);
+        void collectThroughputSamples(size_t index);
         void resetEventPackage(size_t index);
 
         void releaseResources();
@@ -99,9 +138,17 @@ struct BcsSplit {
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
+        Planner::ChunkSizes chunks;
+        this->planner.planChunks(direction, cmdQsForSplit.size(), size, chunks);
+        this->events.splitDirection[markerEventIndex] = direction;
+
         auto totalSize = size;
-        auto engineCount = cmdQsForSplit.size();
         for (size_t i = 0; i < cmdQsForSplit.size(); i++) {
+            this->events.subcopySize[subcopyEventIndex + i] = chunks[i];
+            if (chunks[i] == 0u) {
+                continue;
+            }
+
             if (barrierRequired) {
                 auto barrierEventHandle = this->events.barrier[markerEventIndex]->toHandle();
                 cmdList->addEventsToCmdList(1u, &barrierEventHandle, nullptr, hasRelaxedOrderingDependencies, false, true, false);
@@ -109,11 +156,11 @@ struct BcsSplit {
 
             cmdList->addEventsToCmdList(numWaitEvents, phWaitEvents, nullptr, hasRelaxedOrderingDependencies, false, true, false);
 
-            if (signalEvent && i == 0u) {
+            if (signalEvent && eventHandles.empty()) {
                 cmdList->appendEventForProfilingAllWalkers(signalEvent, nullptr, nullptr, true, true, false, true);
             }
 
-            auto localSize = totalSize / engineCount;
+            auto localSize = chunks[i];
             auto localDstPtr = ptrOffset(dstptr, size - totalSize);
             auto localSrcPtr = ptrOffset(srcptr, size - totalSize);
 
@@ -129,14 +176,13 @@ struct BcsSplit {
             eventHandles.push_back(eventHandle);
 
             totalSize -= localSize;
-            engineCount--;
 
             if (signalEvent) {
                 signalEvent->appendAdditionalCsr(static_cast<CommandQueueImp *>(cmdQsForSplit[i])->getCsr());
             }
         }
 
-        cmdList->addEventsToCmdList(static_cast<uint32_t>(cmdQsForSplit.size()), eventHandles.data(), nullptr, hasRelaxedOrderingDependencies, false, true, false);
+        cmdList->addEventsToCmdList(static_cast<uint32_t>(eventHandles.size()), eventHandles.data(), nullptr, hasRelaxedOrderingDependencies, false, true, false);
         if (signalEvent) {
             cmdList->appendEventForProfilingAllWalkers(signalEvent, nullptr, nullptr, false, true, false, true);
         }
@@ -35,6 +35,10 @@ void *ExtensionFunctionAddressHelper::getExtensionFunctionAddress(const std::str
     RETURN_FUNC_PTR_IF_EXIST(zexCommandListAppendWaitOnMemory);
     RETURN_FUNC_PTR_IF_EXIST(zexCommandListAppendWaitOnMemory64);
     RETURN_FUNC_PTR_IF_EXIST(zexCommandListAppendWriteToMemory);
+    RETURN_FUNC_PTR_IF_EXIST(zexCommandListBeginGraphCapture);
+    RETURN_FUNC_PTR_IF_EXIST(zexCommandListEndGraphCapture);
+
+    RETURN_FUNC_PTR_IF_EXIST(zexCommandQueueGetDirectSubmissionTelemetry);
 
     RETURN_FUNC_PTR_IF_EXIST(zexCounterBasedEventCreate);
     RETURN_FUNC_PTR_IF_EXIST(zexEventGetDeviceAddress);
@@ -72,6 +72,11 @@ struct KernelImmutableData {
 
     const NEO::KernelInfo *getKernelInfo() const { return kernelInfo; }
 
+    void setKernelInfo(NEO::KernelInfo *kernelInfo) {
+        this->kernelInfo = kernelInfo;
+        this->kernelDescriptor = &kernelInfo->kernelDescriptor;
+    }
+
     void setIsaCopiedToAllocation() {
         isaCopiedToAllocation = true;
     }
@@ -8,6 +8,7 @@
 #include "level_zero/core/source/module/module_imp.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/compiler_interface/compiler_options_extra.h"
 #include "shared/source/compiler_interface/compiler_warnings/compiler_warnings.h"
@@ -161,29 +162,31 @@ std::string ModuleTranslationUnit::generateCompilerOptions(const char *buildOpti
 
 bool ModuleTranslationUnit::processSpecConstantInfo(NEO::CompilerInterface *compilerInterface, const ze_module_constants_t *pConstants, const char *input, uint32_t inputSize) {
     if (pConstants) {
-        NEO::SpecConstantInfo specConstInfo;
-        auto retVal = compilerInterface->getSpecConstantsInfo(*device->getNEODevice(), ArrayRef<const char>(input, inputSize), specConstInfo);
-        if (retVal != NEO::TranslationOutput::ErrorCode::success) {
+        auto preparedSpirV = compilerInterface->prepareSpirV(*device->getNEODevice(), ArrayRef<const char>(input, inputSize));
+        if (nullptr == preparedSpirV) {
             return false;
         }
+        const auto &specConstantsIds = preparedSpirV->specConstantsIds;
+        const auto &specConstantsSizes = preparedSpirV->specConstantsSizes;
         for (uint32_t i = 0; i < pConstants->numConstants; i++) {
             uint64_t specConstantValue = 0;
             uint32_t specConstantId = pConstants->pConstantIds[i];
             auto atributeSize = 0u;
             uint32_t j;
-            for (j = 0; j < specConstInfo.sizesBuffer->GetSize<uint32_t>(); j++) {
-                if (specConstantId == specConstInfo.idsBuffer->GetMemory<uint32_t>()[j]) {
-                    atributeSize = specConstInfo.sizesBuffer->GetMemory<uint32_t>()[j];
+            for (j = 0; j < specConstantsSizes.size(); j++) {
+                if (specConstantId == specConstantsIds[j]) {
+                    atributeSize = specConstantsSizes[j];
                     break;
                 }
             }
-            if (j == specConstInfo.sizesBuffer->GetSize<uint32_t>()) {
+            if (j == specConstantsSizes.size()) {
                 return false;
             }
             memcpy_s(&specConstantValue, sizeof(uint64_t),
                      const_cast<void *>(pConstants->pConstantValues[i]), atributeSize);
             specConstantsValues[specConstantId] = specConstantValue;
         }
+        this->preparedSpirV = std::move(preparedSpirV);
     }
     return true;
 }
@@ -287,9 +290,20 @@ ze_result_t ModuleTranslationUnit::buildFromSpirV(const char *input, uint32_t in
     inputArgs.src = ArrayRef<const char>(input, inputSize);
     inputArgs.apiOptions = ArrayRef<const char>(this->options.c_str(), this->options.length());
     inputArgs.internalOptions = ArrayRef<const char>(internalOptions.c_str(), internalOptions.length());
+    inputArgs.preparedSrc = pConstants ? this->preparedSpirV.get() : nullptr;
     return this->compileGenBinary(inputArgs, false);
 }
 
+std::shared_ptr<char[]> ModuleTranslationUnit::shareOrCopyBinary(const std::shared_ptr<char[]> &storage, ArrayRef<const uint8_t> storageRange, ArrayRef<const uint8_t> binary) {
+    if (binary.empty()) {
+        return nullptr;
+    }
+    if ((nullptr != storage) && (binary.begin() >= storageRange.begin()) && (binary.end() <= storageRange.end())) {
+        return std::shared_ptr<char[]>(storage, storage.get() + (binary.begin() - storageRange.begin()));
+    }
+    return makeCopy<char>(reinterpret_cast<const char *>(binary.begin()), binary.size());
+}
+
 ze_result_t ModuleTranslationUnit::createFromNativeBinary(const char *input, size_t inputSize) {
     UNRECOVERABLE_IF((nullptr == device) || (nullptr == device->getNEODevice()));
     auto productAbbreviation = NEO::hardwarePrefix[device->getNEODevice()->getHardwareInfo().platform.eProductFamily];
@@ -309,15 +323,8 @@ ze_result_t ModuleTranslationUnit::createFromNativeBinary(const char *input, siz
         PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodeErrors.c_str());
         return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
     } else {
-        this->irBinary = makeCopy(reinterpret_cast<const char *>(singleDeviceBinary.intermediateRepresentation.begin()), singleDeviceBinary.intermediateRepresentation.size());
         this->irBinarySize = singleDeviceBinary.intermediateRepresentation.size();
         this->options = singleDeviceBinary.buildOptions.str();
-
-        if (false == singleDeviceBinary.debugData.empty()) {
-            this->debugData = makeCopy(reinterpret_cast<const char *>(singleDeviceBinary.debugData.begin()), singleDeviceBinary.debugData.size());
-            this->debugDataSize = singleDeviceBinary.debugData.size();
-        }
-
         this->isGeneratedByIgc = singleDeviceBinary.generator == NEO::GeneratorType::igc;
 
         bool rebuild = NEO::debugManager.flags.RebuildPrecompiledKernels.get() && irBinarySize != 0;
@@ -326,17 +333,21 @@ ze_result_t ModuleTranslationUnit::createFromNativeBinary(const char *input, siz
             driverHandle->clearErrorDescription();
             return ZE_RESULT_ERROR_INVALID_NATIVE_BINARY;
         }
+
+        ArrayRef<const uint8_t> packedTargetDeviceBinary;
         if ((false == singleDeviceBinary.deviceBinary.empty()) && (false == rebuild)) {
-            this->unpackedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(singleDeviceBinary.deviceBinary.begin()), singleDeviceBinary.deviceBinary.size());
-            this->unpackedDeviceBinarySize = singleDeviceBinary.deviceBinary.size();
             // If the Native Binary was an Archive, then packedTargetDeviceBinary will be the packed Binary for the Target Device.
-            if (singleDeviceBinary.packedTargetDeviceBinary.size() > 0) {
-                this->packedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(singleDeviceBinary.packedTargetDeviceBinary.begin()), singleDeviceBinary.packedTargetDeviceBinary.size());
-                this->packedDeviceBinarySize = singleDeviceBinary.packedTargetDeviceBinary.size();
-            } else {
-                this->packedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(archive.begin()), archive.size());
-                this->packedDeviceBinarySize = archive.size();
-            }
+            packedTargetDeviceBinary = (singleDeviceBinary.packedTargetDeviceBinary.size() > 0) ? singleDeviceBinary.packedTargetDeviceBinary : archive;
+            this->packedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(packedTargetDeviceBinary.begin()), packedTargetDeviceBinary.size());
+            this->packedDeviceBinarySize = packedTargetDeviceBinary.size();
+            this->unpackedDeviceBinary = shareOrCopyBinary(this->packedDeviceBinary, packedTargetDeviceBinary, singleDeviceBinary.deviceBinary);
+            this->unpackedDeviceBinarySize = singleDeviceBinary.deviceBinary.size();
+        }
+
+        this->irBinary = shareOrCopyBinary(this->packedDeviceBinary, packedTargetDeviceBinary, singleDeviceBinary.intermediateRepresentation);
+        if (false == singleDeviceBinary.debugData.empty()) {
+            this->debugData = shareOrCopyBinary(this->packedDeviceBinary, packedTargetDeviceBinary, singleDeviceBinary.debugData);
+            this->debugDataSize = singleDeviceBinary.debugData.size();
         }
     }
 
@@ -366,6 +377,9 @@ ze_result_t ModuleTranslationUnit::processUnpackedBinary() {
     NEO::SingleDeviceBinary binary = {};
     binary.deviceBinary = blob;
     binary.targetDevice = NEO::getTargetDevice(device->getNEODevice()->getRootDeviceEnvironment());
+    if (auto compilerInterface = device->getNEODevice()->getRootDeviceEnvironment().compilerInterface.get()) {
+        binary.decodedMetadataCache = compilerInterface->getEnabledCache();
+    }
     std::string decodeErrors;
     std::string decodeWarnings;
 
@@ -563,7 +577,29 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
     linkageSuccessful &= populateHostGlobalSymbolsMap(this->translationUnit->programInfo.globalsDeviceToHostNameMap);
     this->updateBuildLog(neoDevice);
 
-    if ((this->isFullyLinked && this->type == ModuleType::user) || (this->sharedIsaAllocation && this->type == ModuleType::builtin)) {
+    if (this->lazyKernelMaterialization) {
+        if (this->isFullyLinked) {
+            // kernels sharing one ISA allocation are uploaded at once, only initialization of their data is deferred
+            if (this->sharedIsaAllocation) {
+                this->transferIsaSegmentsToAllocation(neoDevice, nullptr);
+            }
+            // exported functions can be called from any kernel in this and in dynamically linked modules
+            auto linkerInput = this->translationUnit->programInfo.linkerInput.get();
+            if (linkerInput && linkerInput->getExportedFunctionsSegmentId() >= 0) {
+                if (result = this->materializeKernel(static_cast<size_t>(linkerInput->getExportedFunctionsSegmentId())); result != ZE_RESULT_SUCCESS) {
+                    return result;
+                }
+            }
+        } else {
+            // dynamic linking patches and uploads ISA of all kernels
+            for (size_t kernelId = 0u; kernelId < this->kernelImmDatas.size(); kernelId++) {
+                if (result = this->initializeKernelImmutableData(kernelId); result != ZE_RESULT_SUCCESS) {
+                    return result;
+                }
+            }
+            this->lazyKernelMaterialization = false;
+        }
+    } else if ((this->isFullyLinked && this->type == ModuleType::user) || (this->sharedIsaAllocation && this->type == ModuleType::builtin)) {
         this->transferIsaSegmentsToAllocation(neoDevice, nullptr);
 
         if (device->getL0Debugger()) {
@@ -587,6 +623,14 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
             return;
         }
 
+        if (this->sharedIsaAllocation->isDeduplicated()) {
+            // content is uploaded by ISAPoolAllocator when the allocation is created for the first module using it
+            for (auto &kernelImmData : this->kernelImmDatas) {
+                kernelImmData->setIsaCopiedToAllocation();
+            }
+            return;
+        }
+
         const auto isaBufferSize = this->sharedIsaAllocation->getSize();
         DEBUG_BREAK_IF(isaBufferSize == 0);
         auto isaBuffer = std::vector<std::byte>(isaBufferSize);
@@ -619,24 +663,31 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
         }
     } else {
         for (auto &kernelImmData : kernelImmDatas) {
-            if (nullptr == kernelImmData->getIsaGraphicsAllocation() || kernelImmData->isIsaCopiedToAllocation()) {
-                continue;
-            }
-            kernelImmData->getIsaGraphicsAllocation()->setAubWritable(true, std::numeric_limits<uint32_t>::max());
-            kernelImmData->getIsaGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
-
-            auto [kernelHeapPtr, kernelHeapSize] = this->getKernelHeapPointerAndSize(kernelImmData, isaSegmentsForPatching);
-            NEO::MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelImmData->getIsaGraphicsAllocation()),
-                                                                  *neoDevice,
-                                                                  kernelImmData->getIsaGraphicsAllocation(),
-                                                                  0u,
-                                                                  kernelHeapPtr,
-                                                                  kernelHeapSize);
-            kernelImmData->setIsaCopiedToAllocation();
+            this->transferKernelIsaToAllocation(neoDevice, kernelImmData, isaSegmentsForPatching);
         }
     }
 }
 
+void ModuleImp::transferKernelIsaToAllocation(NEO::Device *neoDevice, const std::unique_ptr<KernelImmutableData> &kernelImmData, const NEO::Linker::PatchableSegments *isaSegmentsForPatching) {
+    if (nullptr == kernelImmData->getIsaGraphicsAllocation() || kernelImmData->isIsaCopiedToAllocation()) {
+        return;
+    }
+    const auto &productHelper = neoDevice->getProductHelper();
+    auto &rootDeviceEnvironment = neoDevice->getRootDeviceEnvironment();
+
+    kernelImmData->getIsaGraphicsAllocation()->setAubWritable(true, std::numeric_limits<uint32_t>::max());
+    kernelImmData->getIsaGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+
+    auto [kernelHeapPtr, kernelHeapSize] = this->getKernelHeapPointerAndSize(kernelImmData, isaSegmentsForPatching);
+    NEO::MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelImmData->getIsaGraphicsAllocation()),
+                                                          *neoDevice,
+                                                          kernelImmData->getIsaGraphicsAllocation(),
+                                                          0u,
+                                                          kernelHeapPtr,
+                                                          kernelHeapSize);
+    kernelImmData->setIsaCopiedToAllocation();
+}
+
 std::pair<const void *, size_t> ModuleImp::getKernelHeapPointerAndSize(const std::unique_ptr<KernelImmutableData> &kernelImmData,
                                                                        const NEO::Linker::PatchableSegments *isaSegmentsForPatching) {
     if (isaSegmentsForPatching) {
@@ -763,14 +814,20 @@ ze_result_t ModuleImp::initializeKernelImmutableDatas() {
         if (result = this->allocateKernelImmutableDatas(kernelsCount); result != ZE_RESULT_SUCCESS) {
             return result;
         }
+        this->lazyKernelMaterialization = this->isLazyKernelMaterializationAllowed();
+        if (this->lazyKernelMaterialization) {
+            this->materializedKernels.assign(kernelsCount, false);
+            this->kernelIdsByName.reserve(kernelsCount);
+            for (size_t i = 0lu; i < kernelsCount; i++) {
+                auto kernelInfo = this->translationUnit->programInfo.kernelInfos[i];
+                kernelImmDatas[i]->setKernelInfo(kernelInfo);
+                this->kernelIdsByName.emplace(kernelInfo->kernelDescriptor.kernelMetadata.kernelName, i);
+            }
+            this->initializeKernelDependencies();
+            return ZE_RESULT_SUCCESS;
+        }
         for (size_t i = 0lu; i < kernelsCount; i++) {
-            result = kernelImmDatas[i]->initialize(this->translationUnit->programInfo.kernelInfos[i],
-                                                   device,
-                                                   device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
-                                                   this->translationUnit->globalConstBuffer,
-                                                   this->translationUnit->globalVarBuffer,
-                                                   this->type == ModuleType::builtin);
-            if (result != ZE_RESULT_SUCCESS) {
+            if (result = this->initializeKernelImmutableData(i); result != ZE_RESULT_SUCCESS) {
                 kernelImmDatas[i].reset();
                 return result;
             }
@@ -779,6 +836,107 @@ ze_result_t ModuleImp::initializeKernelImmutableDatas() {
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t ModuleImp::initializeKernelImmutableData(size_t kernelId) {
+    return kernelImmDatas[kernelId]->initialize(this->translationUnit->programInfo.kernelInfos[kernelId],
+                                                device,
+                                                device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
+                                                this->translationUnit->globalConstBuffer,
+                                                this->translationUnit->globalVarBuffer,
+                                                this->type == ModuleType::builtin);
+}
+
+bool ModuleImp::isLazyKernelMaterializationAllowed() const {
+    return (1 == NEO::debugManager.flags.EnableLazyKernelMaterialization.get()) &&
+           (this->type == ModuleType::user) &&
+           (nullptr == this->device->getL0Debugger());
+}
+
+bool ModuleImp::isIsaDeduplicationAllowed() const {
+    auto linkerInput = this->translationUnit->programInfo.linkerInput.get();
+    bool isaRequiresPatching = linkerInput && linkerInput->getTraits().requiresPatchingOfInstructionSegments;
+    return (1 == NEO::debugManager.flags.EnableIsaDeduplication.get()) &&
+           (false == isaRequiresPatching) &&
+           (nullptr == this->device->getL0Debugger());
+}
+
+void ModuleImp::initializeKernelDependencies() {
+    this->kernelDependencyIds.assign(this->kernelImmDatas.size(), {});
+    auto linkerInput = this->translationUnit->programInfo.linkerInput.get();
+    if (nullptr == linkerInput) {
+        return;
+    }
+
+    const auto &symbols = linkerInput->getSymbols();
+    auto addDependency = [&](size_t kernelId, const std::string &symbolName) {
+        auto symbolIt = symbols.find(symbolName);
+        if ((symbolIt == symbols.end()) || (symbolIt->second.segment != NEO::SegmentType::instructions)) {
+            return;
+        }
+        auto dependencyId = static_cast<size_t>(symbolIt->second.instructionSegmentId);
+        auto &dependencies = this->kernelDependencyIds[kernelId];
+        if ((dependencyId != kernelId) && (dependencyId < this->kernelDependencyIds.size()) &&
+            (std::find(dependencies.begin(), dependencies.end(), dependencyId) == dependencies.end())) {
+            dependencies.push_back(dependencyId);
+        }
+    };
+
+    for (const auto &kernelDependency : linkerInput->getKernelDependencies()) {
+        auto kernelIt = this->kernelIdsByName.find(kernelDependency.kernelName);
+        if (kernelIt != this->kernelIdsByName.end()) {
+            addDependency(kernelIt->second, kernelDependency.usedFuncName);
+        }
+    }
+
+    // kernel dependencies cover only calls to external functions, calls to and addresses of other kernels are found in relocations
+    const auto &relocationsPerKernel = linkerInput->getRelocationsInInstructionSegments();
+    for (size_t kernelId = 0u; kernelId < std::min(relocationsPerKernel.size(), this->kernelDependencyIds.size()); kernelId++) {
+        for (const auto &relocation : relocationsPerKernel[kernelId]) {
+            addDependency(kernelId, relocation.symbolName);
+        }
+    }
+}
+
+ze_result_t ModuleImp::materializeKernel(size_t kernelId) {
+    if (false == this->lazyKernelMaterialization) {
+        return ZE_RESULT_SUCCESS;
+    }
+    std::lock_guard<std::mutex> lock(this->kernelMaterializationMutex);
+    auto isaSegments = this->isaSegmentsForPatching.empty() ? nullptr : &this->isaSegmentsForPatching;
+
+    // ISA of a kernel is usable only with ISA of all kernels it depends on
+    std::vector<size_t> pendingKernelIds = {kernelId};
+    while (false == pendingKernelIds.empty()) {
+        auto pendingKernelId = pendingKernelIds.back();
+        pendingKernelIds.pop_back();
+        if (this->materializedKernels[pendingKernelId]) {
+            continue;
+        }
+        if (auto result = this->initializeKernelImmutableData(pendingKernelId); result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+        this->transferKernelIsaToAllocation(this->device->getNEODevice(), this->kernelImmDatas[pendingKernelId], isaSegments);
+        this->materializedKernels[pendingKernelId] = true;
+
+        for (auto dependencyId : this->kernelDependencyIds[pendingKernelId]) {
+            if (false == this->materializedKernels[dependencyId]) {
+                pendingKernelIds.push_back(dependencyId);
+            }
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ModuleImp::materializeKernelByName(const char *kernelName) {
+    if (false == this->lazyKernelMaterialization) {
+        return ZE_RESULT_SUCCESS;
+    }
+    auto kernelIt = this->kernelIdsByName.find(kernelName);
+    if (kernelIt == this->kernelIdsByName.end()) {
+        return ZE_RESULT_SUCCESS;
+    }
+    return this->materializeKernel(kernelIt->second);
+}
+
 ze_result_t ModuleImp::allocateKernelImmutableDatas(size_t kernelsCount) {
     if (this->kernelImmDatas.size() == kernelsCount) {
         return ZE_RESULT_SUCCESS;
@@ -810,7 +968,19 @@ ze_result_t ModuleImp::setIsaGraphicsAllocations() {
     if (debuggerDisabled && kernelsIsaTotalSize <= isaAllocationPageSize) {
         auto neoDevice = this->device->getNEODevice();
         auto &isaAllocator = neoDevice->getIsaPoolAllocator();
-        auto crossModuleAllocation = isaAllocator.requestGraphicsAllocationForIsa(this->type == ModuleType::builtin, kernelsIsaTotalSize);
+        NEO::SharedIsaAllocation *crossModuleAllocation = nullptr;
+        if (this->isIsaDeduplicationAllowed()) {
+            // ISA is final at this point, so identical modules may share a single copy of it
+            auto isaContent = std::vector<uint8_t>(kernelsIsaTotalSize, 0u);
+            for (auto i = 0lu; i < kernelsCount; i++) {
+                auto &heapInfo = this->translationUnit->programInfo.kernelInfos[i]->heapInfo;
+                auto isaOffset = kernelsChunks[i].first;
+                memcpy_s(isaContent.data() + isaOffset, isaContent.size() - isaOffset, heapInfo.pKernelHeap, heapInfo.kernelHeapSize);
+            }
+            crossModuleAllocation = isaAllocator.requestDeduplicatedGraphicsAllocationForIsa(this->type == ModuleType::builtin, isaContent);
+        } else {
+            crossModuleAllocation = isaAllocator.requestGraphicsAllocationForIsa(this->type == ModuleType::builtin, kernelsIsaTotalSize);
+        }
         if (crossModuleAllocation == nullptr) {
             return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
         }
@@ -958,6 +1128,10 @@ ze_result_t ModuleImp::createKernel(const ze_kernel_desc_t *desc,
         driverHandle->clearErrorDescription();
         return ZE_RESULT_ERROR_INVALID_MODULE_UNLINKED;
     }
+    if (res = this->materializeKernelByName(desc->pKernelName); res != ZE_RESULT_SUCCESS) {
+        driverHandle->clearErrorDescription();
+        return res;
+    }
     auto kernel = Kernel::create(productFamily, this, desc, &res);
 
     if (res == ZE_RESULT_SUCCESS) {
@@ -1035,6 +1209,9 @@ ze_result_t ModuleImp::getDebugInfo(size_t *pDebugDataSize, uint8_t *pDebugData)
 
 void ModuleImp::copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching) {
     if (this->translationUnit->programInfo.linkerInput && this->translationUnit->programInfo.linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
+        if (this->lazyKernelMaterialization && (nullptr == this->sharedIsaAllocation)) {
+            return;
+        }
         auto neoDevice = this->device->getNEODevice();
         auto &rootDeviceEnvironment = neoDevice->getRootDeviceEnvironment();
 
@@ -1172,6 +1349,12 @@ ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnF
     // Check if the function is in the exported symbol table
     auto symbolIt = symbols.find(pFunctionName);
     if ((symbolIt != symbols.end()) && (symbolIt->second.symbol.segment == NEO::SegmentType::instructions)) {
+        auto kernelId = static_cast<size_t>(symbolIt->second.symbol.instructionSegmentId);
+        if (kernelId < this->kernelImmDatas.size()) {
+            if (auto result = this->materializeKernel(kernelId); result != ZE_RESULT_SUCCESS) {
+                return result;
+            }
+        }
         *pfnFunction = reinterpret_cast<void *>(symbolIt->second.gpuAddress);
     }
     // If the Function Pointer is not in the exported symbol table, then this function might be a kernel.
@@ -1179,6 +1362,9 @@ ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnF
     if (*pfnFunction == nullptr) {
         auto kernelImmData = this->getKernelImmutableData(pFunctionName);
         if (kernelImmData != nullptr) {
+            if (auto result = this->materializeKernelByName(pFunctionName); result != ZE_RESULT_SUCCESS) {
+                return result;
+            }
             auto isaAllocation = kernelImmData->getIsaGraphicsAllocation();
             *pfnFunction = reinterpret_cast<void *>(isaAllocation->getGpuAddress() + kernelImmData->getIsaOffsetInParentAllocation());
             // Ensure that any kernel in this module which uses this kernel module function pointer has access to the memory.
@@ -18,8 +18,11 @@
 
 #include <list>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 struct KernelDescriptor;
@@ -61,6 +64,8 @@ struct ModuleTranslationUnit {
     MOCKABLE_VIRTUAL ze_result_t compileGenBinary(NEO::TranslationInput &inputArgs, bool staticLink);
     void updateBuildLog(const std::string &newLogEntry);
     void processDebugData();
+    // returns view sharing storage when binary lies within storageRange (the range storage was copied from), otherwise a copy of binary
+    static std::shared_ptr<char[]> shareOrCopyBinary(const std::shared_ptr<char[]> &storage, ArrayRef<const uint8_t> storageRange, ArrayRef<const uint8_t> binary);
     L0::Device *device = nullptr;
 
     NEO::GraphicsAllocation *globalConstBuffer = nullptr;
@@ -72,20 +77,22 @@ struct ModuleTranslationUnit {
 
     std::string buildLog;
 
-    std::unique_ptr<char[]> irBinary;
+    // binaries created from a native binary share storage of single packed copy (views into it, no extra copies)
+    std::shared_ptr<char[]> irBinary;
     size_t irBinarySize = 0U;
 
-    std::unique_ptr<char[]> unpackedDeviceBinary;
+    std::shared_ptr<char[]> unpackedDeviceBinary;
     size_t unpackedDeviceBinarySize = 0U;
 
-    std::unique_ptr<char[]> packedDeviceBinary;
+    std::shared_ptr<char[]> packedDeviceBinary;
     size_t packedDeviceBinarySize = 0U;
 
-    std::unique_ptr<char[]> debugData;
+    std::shared_ptr<char[]> debugData;
     size_t debugDataSize = 0U;
     std::vector<char *> alignedvIsas;
 
     NEO::specConstValuesMap specConstantsValues;
+    std::shared_ptr<const NEO::PreparedSpirV> preparedSpirV;
     bool isBuiltIn{false};
     bool isGeneratedByIgc{true};
 };
@@ -164,11 +171,21 @@ struct ModuleImp : public Module {
         return this->type;
     }
 
+    bool isKernelMaterializationLazy() const {
+        return this->lazyKernelMaterialization;
+    }
+    ze_result_t materializeKernel(size_t kernelId);
+    ze_result_t materializeKernelByName(const char *kernelName);
+
   protected:
     MOCKABLE_VIRTUAL ze_result_t initializeTranslationUnit(const ze_module_desc_t *desc, NEO::Device *neoDevice);
     bool shouldBuildBeFailed(NEO::Device *neoDevice);
     ze_result_t allocateKernelImmutableDatas(size_t kernelsCount);
     ze_result_t initializeKernelImmutableDatas();
+    ze_result_t initializeKernelImmutableData(size_t kernelId);
+    bool isLazyKernelMaterializationAllowed() const;
+    void initializeKernelDependencies();
+    bool isIsaDeduplicationAllowed() const;
     void copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching);
     void verifyDebugCapabilities();
     void checkIfPrivateMemoryPerDispatchIsNeeded() override;
@@ -180,6 +197,7 @@ struct ModuleImp : public Module {
     bool populateHostGlobalSymbolsMap(std::unordered_map<std::string, std::string> &devToHostNameMapping);
     ze_result_t setIsaGraphicsAllocations();
     void transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
+    void transferKernelIsaToAllocation(NEO::Device *neoDevice, const std::unique_ptr<KernelImmutableData> &kernelImmData, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
     std::pair<const void *, size_t> getKernelHeapPointerAndSize(const std::unique_ptr<KernelImmutableData> &kernelImmData, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
     MOCKABLE_VIRTUAL size_t computeKernelIsaAllocationAlignedSizeWithPadding(size_t isaSize, bool lastKernel);
     MOCKABLE_VIRTUAL NEO::GraphicsAllocation *allocateKernelsIsaMemory(size_t size);
@@ -220,6 +238,13 @@ struct ModuleImp : public Module {
 
     NEO::Linker::PatchableSegments isaSegmentsForPatching;
     std::vector<std::vector<char>> patchedIsaTempStorage;
+
+    bool lazyKernelMaterialization = false;
+    std::vector<bool> materializedKernels;
+    std::unordered_map<std::string, size_t> kernelIdsByName;
+    // kernels whose ISA is called or addressed from ISA of given kernel
+    std::vector<std::vector<size_t>> kernelDependencyIds;
+    std::mutex kernelMaterializationMutex;
 };
 
 bool moveBuildOption(std::string &dstOptionsSet, std::string &srcOptionSet, NEO::ConstStringRef dstOptionName, NEO::ConstStringRef srcOptionName);
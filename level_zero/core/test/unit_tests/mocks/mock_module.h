@@ -59,12 +59,16 @@ struct WhiteBox<::L0::Module> : public ::L0::ModuleImp {
     using BaseClass::device;
     using BaseClass::exportedFunctionsSurface;
     using BaseClass::importedSymbolAllocations;
+    using BaseClass::initializeKernelDependencies;
     using BaseClass::isaSegmentsForPatching;
     using BaseClass::isFullyLinked;
     using BaseClass::isFunctionSymbolExportEnabled;
     using BaseClass::isGlobalSymbolExportEnabled;
+    using BaseClass::isIsaDeduplicationAllowed;
+    using BaseClass::kernelDependencyIds;
     using BaseClass::kernelImmDatas;
     using BaseClass::setIsaGraphicsAllocations;
+    using BaseClass::sharedIsaAllocation;
     using BaseClass::symbols;
     using BaseClass::translationUnit;
     using BaseClass::type;
@@ -178,6 +182,7 @@ struct MockCompilerInterfaceWithSpecConstants : public NEO::CompilerInterface {
                                             NEO::TranslationOutput &output) override {
 
         EXPECT_EQ(moduleNumSpecConstants, input.specializedValues.size());
+        receivedPreparedSrc = input.preparedSrc;
 
         return NEO::TranslationOutput::ErrorCode::success;
     }
@@ -192,6 +197,7 @@ struct MockCompilerInterfaceWithSpecConstants : public NEO::CompilerInterface {
 
     NEO::TranslationOutput::ErrorCode getSpecConstantsInfo(const NEO::Device &device,
                                                            ArrayRef<const char> srcSpirV, NEO::SpecConstantInfo &output) override {
+        getSpecConstantsInfoCalled++;
         output.idsBuffer.reset(new NEO::MockCIFBuffer());
         output.sizesBuffer.reset(new NEO::MockCIFBuffer());
         for (uint32_t i = 0; i < moduleNumSpecConstants; i++) {
@@ -201,6 +207,8 @@ struct MockCompilerInterfaceWithSpecConstants : public NEO::CompilerInterface {
         return NEO::TranslationOutput::ErrorCode::success;
     }
     uint32_t moduleNumSpecConstants = 0u;
+    uint32_t getSpecConstantsInfoCalled = 0u;
+    const NEO::PreparedSpirV *receivedPreparedSrc = nullptr;
     const std::vector<uint32_t> moduleSpecConstantsIds{2, 0, 1, 3, 5, 4};
     const std::vector<T1> moduleSpecConstantsValuesT1{10, 20, 30};
     const std::vector<T2> moduleSpecConstantsValuesT2{static_cast<T2>(std::numeric_limits<T1>::max()) + 60u, static_cast<T2>(std::numeric_limits<T1>::max()) + 50u, static_cast<T2>(std::numeric_limits<T1>::max()) + 40u};
@@ -22,6 +22,7 @@
 #include "shared/test/common/mocks/mock_memory_manager.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include "level_zero/api/driver_experimental/public/zex_cmdlist.h"
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 #include "level_zero/core/source/event/event.h"
@@ -2063,7 +2064,7 @@ TEST_F(CommandListCreate, givenImmediateCommandListWhenThereIsNoEnoughSpaceForIm
     whiteBoxCmdList->getCsr(false)->getInternalAllocationStorage()->getTemporaryAllocations().freeAllGraphicsAllocations(device->getNEODevice());
 }
 
-TEST_F(CommandListCreate, whenCreatingImmediateCommandListAndAppendCommandListsThenReturnsUnsupported) {
+TEST_F(CommandListCreate, whenCreatingImmediateCommandListAndAppendCommandListsWithoutCommandListsThenSuccessIsReturned) {
     const ze_command_queue_desc_t desc = {};
     ze_result_t returnValue;
     std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::renderCompute, returnValue));
@@ -2071,7 +2072,227 @@ TEST_F(CommandListCreate, whenCreatingImmediateCommandListAndAppendCommandListsT
 
     EXPECT_TRUE(commandList->isImmediateType());
     auto result = commandList->appendCommandLists(0u, nullptr, nullptr, 0u, nullptr);
-    EXPECT_EQ(result, ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
+    EXPECT_EQ(result, ZE_RESULT_SUCCESS);
+}
+
+TEST_F(CommandListCreate, givenImmediateCommandListWhenAppendingImmediateCommandListThenInvalidArgumentIsReturned) {
+    const ze_command_queue_desc_t desc = {};
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::renderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+
+    auto hCommandList = commandList->toHandle();
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->appendCommandLists(1u, &hCommandList, nullptr, 0u, nullptr));
+}
+
+TEST_F(CommandListCreate, givenImmediateCommandListWhenAppendingClosedRegularCommandListThenItIsSubmittedToImmediateCsr) {
+    const ze_command_queue_desc_t desc = {};
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::renderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    std::unique_ptr<L0::CommandList> regularCommandList(CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false));
+    ASSERT_NE(nullptr, regularCommandList);
+    regularCommandList->close();
+
+    auto csr = commandList->getCsr(false);
+    auto taskCountBefore = csr->peekTaskCount();
+
+    auto hRegularCommandList = regularCommandList->toHandle();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendCommandLists(1u, &hRegularCommandList, nullptr, 0u, nullptr));
+    EXPECT_EQ(taskCountBefore + 1, csr->peekTaskCount());
+}
+
+TEST_F(CommandListCreate, givenRegularCommandListWhenGraphCaptureIsRequestedThenUnsupportedFeatureIsReturned) {
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false));
+    ASSERT_NE(nullptr, commandList);
+
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->endGraphCapture(&hGraph));
+    EXPECT_FALSE(commandList->isCapturingGraph());
+}
+
+TEST_F(CommandListCreate, givenImmediateCommandListWhenGraphCaptureIsNotStartedThenEndingCaptureReturnsInvalidArgument) {
+    const ze_command_queue_desc_t desc = {};
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::renderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->endGraphCapture(&hGraph));
+    EXPECT_EQ(nullptr, hGraph);
+}
+
+TEST_F(CommandListCreate, givenImmediateCommandListCapturingGraphWhenCaptureIsStartedAgainOrCommandListsAreAppendedThenInvalidArgumentIsReturned) {
+    const ze_command_queue_desc_t desc = {};
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::renderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->beginGraphCapture());
+    EXPECT_TRUE(commandList->isCapturingGraph());
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->appendCommandLists(0u, nullptr, nullptr, 0u, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->endGraphCapture(nullptr));
+}
+
+TEST_F(CommandListCreate, givenImmediateCommandListCapturingGraphWhenAppendingBarrierThenItIsRecordedAndReplayedWithSingleSubmission) {
+    const ze_command_queue_desc_t desc = {};
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::renderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+
+    auto csr = commandList->getCsr(false);
+    auto immediateStream = commandList->getCmdContainer().getCommandStream();
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->beginGraphCapture());
+
+    auto usedBefore = immediateStream->getUsed();
+    auto taskCountBefore = csr->peekTaskCount();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendBarrier(nullptr, 0u, nullptr, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendBarrier(nullptr, 0u, nullptr, false));
+    EXPECT_EQ(usedBefore, immediateStream->getUsed());
+    EXPECT_EQ(taskCountBefore, csr->peekTaskCount());
+
+    ze_command_list_handle_t hGraph = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->endGraphCapture(&hGraph));
+    ASSERT_NE(nullptr, hGraph);
+    EXPECT_FALSE(commandList->isCapturingGraph());
+
+    auto graph = CommandList::fromHandle(hGraph);
+    EXPECT_FALSE(graph->isImmediateType());
+    EXPECT_NE(0u, graph->getCmdContainer().getCommandStream()->getUsed());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendCommandLists(1u, &hGraph, nullptr, 0u, nullptr));
+    EXPECT_EQ(taskCountBefore + 1, csr->peekTaskCount());
+
+    graph->destroy();
+}
+
+HWTEST2_F(CommandListCreate, givenInOrderImmediateCommandListWhenCapturedGraphIsReplayedMultipleTimesThenEachReplayIsSingleSubmissionAndPatchedCounterValuesAdvance, IsAtLeastXeHpCore) {
+    using MI_STORE_DATA_IMM = typename FamilyType::MI_STORE_DATA_IMM;
+
+    ze_command_queue_desc_t desc = {};
+    desc.flags = ZE_COMMAND_QUEUE_FLAG_IN_ORDER;
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::renderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    auto immCmdList = static_cast<WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>> *>(commandList.get());
+    ASSERT_TRUE(immCmdList->isInOrderExecutionEnabled());
+
+    void *dstPtr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, sizeof(uint64_t), 1u, &dstPtr));
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendWriteGlobalTimestamp(reinterpret_cast<uint64_t *>(dstPtr), nullptr, 0u, nullptr));
+    ze_command_list_handle_t hGraph = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->endGraphCapture(&hGraph));
+
+    auto graph = static_cast<WhiteBox<L0::CommandListCoreFamily<gfxCoreFamily>> *>(CommandList::fromHandle(hGraph));
+    ASSERT_TRUE(graph->isInOrderExecutionEnabled());
+    ASSERT_NE(0u, graph->inOrderPatchCmds.size());
+    auto graphCounterValue = graph->inOrderExecInfo->getCounterValue();
+
+    auto csr = commandList->getCsr(false);
+    for (uint64_t replay = 1; replay <= 3; replay++) {
+        auto taskCountBefore = csr->peekTaskCount();
+        auto immediateCounterBefore = immCmdList->inOrderExecInfo->getCounterValue();
+
+        EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendCommandLists(1u, &hGraph, nullptr, 0u, nullptr));
+
+        EXPECT_EQ(taskCountBefore + 1, csr->peekTaskCount());
+        EXPECT_EQ(immediateCounterBefore + 1, immCmdList->inOrderExecInfo->getCounterValue());
+        EXPECT_EQ(replay, graph->inOrderExecInfo->getRegularCmdListSubmissionCounter());
+
+        for (auto &patchCmd : graph->inOrderPatchCmds) {
+            if (patchCmd.patchCmdType == NEO::InOrderPatchCommandHelpers::PatchCmdType::sdi) {
+                auto sdiCmd = reinterpret_cast<MI_STORE_DATA_IMM *>(patchCmd.cmd1);
+                EXPECT_EQ(getLowPart(patchCmd.baseCounterValue + graphCounterValue * (replay - 1)), sdiCmd->getDataDword0());
+            }
+        }
+    }
+
+    graph->destroy();
+    context->freeMem(dstPtr);
+}
+
+TEST_F(CommandListCreate, givenImmediateCommandListCapturingGraphWhenCommandListIsDestroyedThenCapturedGraphIsReleased) {
+    const ze_command_queue_desc_t desc = {};
+    ze_result_t returnValue;
+    auto commandList = CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::renderCompute, returnValue);
+    ASSERT_NE(nullptr, commandList);
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendBarrier(nullptr, 0u, nullptr, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->destroy());
+}
+
+struct ImmediateCommandListGraphCaptureTest : public CommandListCreate {
+    void SetUp() override {
+        CommandListCreate::SetUp();
+        const ze_command_queue_desc_t desc = {};
+        ze_result_t returnValue;
+        commandList.reset(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::renderCompute, returnValue));
+        ASSERT_NE(nullptr, commandList);
+        ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->beginGraphCapture());
+
+        auto whiteBoxCmdList = CommandList::whiteboxCast(commandList.get());
+        graph = whiteBoxCmdList->captureTarget;
+        whiteBoxCmdList->captureTarget = &mockCaptureTarget;
+
+        csr = commandList->getCsr(false);
+        taskCountBefore = csr->peekTaskCount();
+        usedBefore = commandList->getCmdContainer().getCommandStream()->getUsed();
+    }
+
+    void TearDown() override {
+        if (commandList && csr) {
+            EXPECT_EQ(usedBefore, commandList->getCmdContainer().getCommandStream()->getUsed());
+            EXPECT_EQ(taskCountBefore, csr->peekTaskCount());
+
+            CommandList::whiteboxCast(commandList.get())->captureTarget = graph;
+            commandList.reset();
+        }
+        CommandListCreate::TearDown();
+    }
+
+    MockCommandList mockCaptureTarget;
+    std::unique_ptr<L0::CommandList> commandList;
+    L0::CommandList *graph = nullptr;
+    NEO::CommandStreamReceiver *csr = nullptr;
+    TaskCountType taskCountBefore = 0u;
+    size_t usedBefore = 0u;
+};
+
+TEST_F(ImmediateCommandListGraphCaptureTest, givenImmediateCommandListCapturingGraphWhenAppendingMultipleKernelsIndirectThenItIsForwardedToCaptureTarget) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchMultipleKernelsIndirect(0u, nullptr, nullptr, nullptr, nullptr, 0u, nullptr, false));
+    EXPECT_EQ(1u, mockCaptureTarget.appendLaunchMultipleKernelsIndirectCalled);
+}
+
+TEST_F(ImmediateCommandListGraphCaptureTest, givenImmediateCommandListCapturingGraphWhenAppendingMemAdviseThenItIsForwardedToCaptureTarget) {
+    int data = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendMemAdvise(device->toHandle(), &data, sizeof(data), ZE_MEMORY_ADVICE_SET_READ_MOSTLY));
+    EXPECT_EQ(1u, mockCaptureTarget.appendMemAdviseCalled);
+}
+
+TEST_F(ImmediateCommandListGraphCaptureTest, givenImmediateCommandListCapturingGraphWhenAppendingMemoryPrefetchThenItIsForwardedToCaptureTarget) {
+    int data = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendMemoryPrefetch(&data, sizeof(data)));
+    EXPECT_EQ(1u, mockCaptureTarget.appendMemoryPrefetchCalled);
+}
+
+TEST_F(ImmediateCommandListGraphCaptureTest, givenImmediateCommandListCapturingGraphWhenAppendingQueryKernelTimestampsThenItIsForwardedToCaptureTarget) {
+    uint64_t timestamps[2] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendQueryKernelTimestamps(0u, nullptr, timestamps, nullptr, nullptr, 0u, nullptr));
+    EXPECT_EQ(1u, mockCaptureTarget.appendQueryKernelTimestampsCalled);
+}
+
+TEST_F(CommandListCreate, givenNullCommandListWhenCallingGraphCaptureExtensionsThenInvalidArgumentIsReturned) {
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexCommandListBeginGraphCapture(nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexCommandListEndGraphCapture(nullptr, &hGraph));
 }
 
 TEST_F(CommandListCreate, givenCreatingRegularCommandlistAndppendCommandListsThenReturnInvalidArgument) {
@@ -211,7 +211,7 @@ HWTEST2_F(CommandListAppendWaitOnEvent, givenImmediateCmdListAndAppendingRegular
     ze_event_handle_t hEventHandle = event->toHandle();
     auto result = immCommandList->appendCommandLists(0u, nullptr, nullptr, 1u, &hEventHandle);
 
-    ASSERT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, result);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
 
     auto usedSpaceAfter = immCommandList->getCmdContainer().getCommandStream()->getUsed();
 
@@ -6,6 +6,8 @@
  */
 
 #include "shared/source/command_stream/scratch_space_controller.h"
+#include "shared/source/direct_submission/direct_submission_telemetry.h"
+#include "shared/source/direct_submission/dispatchers/render_dispatcher.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/state_base_address.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
@@ -18,6 +20,7 @@
 #include "shared/test/common/mocks/ult_device_factory.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include "level_zero/api/driver_experimental/public/zex_cmdqueue.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
 #include "level_zero/core/test/unit_tests/fixtures/module_fixture.h"
@@ -2215,5 +2218,50 @@ TEST_F(DeviceCreateCommandQueueTest, givenDeviceWhenCreateCommandQueueForValidOr
     }
 }
 
+TEST_F(CommandQueueCreate, givenNullArgumentsWhenGettingDirectSubmissionTelemetryThenInvalidArgumentIsReturned) {
+    zex_direct_submission_telemetry_t telemetry = {};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexCommandQueueGetDirectSubmissionTelemetry(nullptr, &telemetry));
+
+    const ze_command_queue_desc_t desc{};
+    ze_result_t returnValue;
+    auto commandQueue = CommandQueue::create(productFamily, device, neoDevice->getDefaultEngine().commandStreamReceiver, &desc, false, false, false, returnValue);
+    ASSERT_NE(nullptr, commandQueue);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexCommandQueueGetDirectSubmissionTelemetry(commandQueue->toHandle(), nullptr));
+    commandQueue->destroy();
+}
+
+HWTEST_F(CommandQueueCreate, givenDirectSubmissionTelemetryWhenGettingItFromCommandQueueThenTelemetryIsReturnedOnlyWhenCollected) {
+    DebugManagerStateRestore restorer;
+    auto csr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(neoDevice->getDefaultEngine().commandStreamReceiver);
+
+    const ze_command_queue_desc_t desc{};
+    ze_result_t returnValue;
+    auto commandQueue = CommandQueue::create(productFamily, device, csr, &desc, false, false, false, returnValue);
+    ASSERT_NE(nullptr, commandQueue);
+
+    zex_direct_submission_telemetry_t telemetry = {};
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, zexCommandQueueGetDirectSubmissionTelemetry(commandQueue->toHandle(), &telemetry));
+
+    debugManager.flags.DirectSubmissionTelemetry.set(1);
+    auto directSubmission = new NEO::MockDirectSubmissionHw<FamilyType, NEO::RenderDispatcher<FamilyType>>(*csr);
+    csr->directSubmission.reset(directSubmission);
+    directSubmission->telemetry->ringStarts = 2u;
+    directSubmission->telemetry->submissions = 5u;
+    directSubmission->telemetry->dispatchCpuTimeNs.record(3u);
+    directSubmission->telemetry->submitToGpuStartNs.record(1024u);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandQueueGetDirectSubmissionTelemetry(commandQueue->toHandle(), &telemetry));
+    EXPECT_EQ(2u, telemetry.ringStarts);
+    EXPECT_EQ(5u, telemetry.submissions);
+    EXPECT_EQ(0u, telemetry.ringStops);
+    EXPECT_EQ(1u, telemetry.dispatchCpuTimeNs[2]);
+    EXPECT_EQ(0u, telemetry.semaphoreSectionNs[2]);
+    EXPECT_EQ(1u, telemetry.submitToGpuStartNs[11]);
+
+    csr->directSubmission.reset();
+    commandQueue->destroy();
+}
+
 } // namespace ult
 } // namespace L0
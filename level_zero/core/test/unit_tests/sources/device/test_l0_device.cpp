@@ -39,6 +39,7 @@
 #include "level_zero/core/source/cache/cache_reservation.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 #include "level_zero/core/source/context/context_imp.h"
+#include "level_zero/core/source/device/bcs_split.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/driver/extension_function_address.h"
 #include "level_zero/core/source/driver/host_pointer_manager.h"
@@ -6211,6 +6212,15 @@ TEST(ExtensionLookupTest, givenLookupMapWhenAskingForZexCommandListAppendWaitOnM
     EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zexCommandListAppendWaitOnMemory64"));
 }
 
+TEST(ExtensionLookupTest, givenLookupMapWhenAskingForGraphCaptureExtensionFunctionsThenValidPointersReturned) {
+    EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zexCommandListBeginGraphCapture"));
+    EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zexCommandListEndGraphCapture"));
+}
+
+TEST(ExtensionLookupTest, givenLookupMapWhenAskingForZexCommandQueueGetDirectSubmissionTelemetryThenReturnCorrectValue) {
+    EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zexCommandQueueGetDirectSubmissionTelemetry"));
+}
+
 TEST(ExtensionLookupTest, givenLookupMapWhenAskingForBindlessImageExtensionFunctionsThenValidPointersReturned) {
     EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zeMemGetPitchFor2dImage"));
     EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zeImageGetDeviceOffsetExp"));
@@ -6220,5 +6230,146 @@ TEST(ExtensionLookupTest, givenLookupMapWhenAskingForZeIntelGetDriverVersionStri
     EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zeIntelGetDriverVersionString"));
 }
 
+TEST(BcsSplitPlannerTest, givenAdaptivePlanningDisabledWhenPlanningChunksThenSizeIsSplitEvenly) {
+    BcsSplit::Planner planner;
+    BcsSplit::Planner::ChunkSizes chunks;
+
+    planner.addSample(NEO::TransferDirection::localToLocal, 0u, 3u, MemoryConstants::megaByte, 1000u);
+    planner.planChunks(NEO::TransferDirection::localToLocal, 3u, 10u, chunks);
+
+    ASSERT_EQ(3u, chunks.size());
+    EXPECT_EQ(3u, chunks[0]);
+    EXPECT_EQ(3u, chunks[1]);
+    EXPECT_EQ(4u, chunks[2]);
+}
+
+TEST(BcsSplitPlannerTest, givenNotAllEnginesMeasuredWhenPlanningChunksThenSizeIsSplitEvenly) {
+    BcsSplit::Planner planner;
+    planner.enabled = true;
+    BcsSplit::Planner::ChunkSizes chunks;
+
+    planner.addSample(NEO::TransferDirection::hostToLocal, 0u, 2u, MemoryConstants::megaByte, 1000u);
+    planner.planChunks(NEO::TransferDirection::hostToLocal, 2u, 2 * MemoryConstants::megaByte, chunks);
+
+    ASSERT_EQ(2u, chunks.size());
+    EXPECT_EQ(MemoryConstants::megaByte, chunks[0]);
+    EXPECT_EQ(MemoryConstants::megaByte, chunks[1]);
+}
+
+TEST(BcsSplitPlannerTest, givenMeasuredEnginesWhenPlanningLargeCopyThenChunksAreProportionalToThroughput) {
+    BcsSplit::Planner planner;
+    planner.enabled = true;
+    planner.splitOverheadNs = 0.0;
+    BcsSplit::Planner::ChunkSizes chunks;
+
+    planner.addSample(NEO::TransferDirection::localToLocal, 0u, 2u, 1000u, 1000u);
+    planner.addSample(NEO::TransferDirection::localToLocal, 1u, 2u, 3000u, 1000u);
+    planner.planChunks(NEO::TransferDirection::localToLocal, 2u, 4000u, chunks);
+
+    ASSERT_EQ(2u, chunks.size());
+    EXPECT_EQ(1000u, chunks[0]);
+    EXPECT_EQ(3000u, chunks[1]);
+}
+
+TEST(BcsSplitPlannerTest, givenMeasuredEnginesWhenPlanningCopyBelowLearnedThresholdThenOnlyFastestEngineIsUsed) {
+    BcsSplit::Planner planner;
+    planner.enabled = true;
+    planner.splitOverheadNs = 10000.0;
+    BcsSplit::Planner::ChunkSizes chunks;
+
+    planner.addSample(NEO::TransferDirection::localToHost, 0u, 2u, 1000u, 1000u);
+    planner.addSample(NEO::TransferDirection::localToHost, 1u, 2u, 2000u, 1000u);
+    planner.planChunks(NEO::TransferDirection::localToHost, 2u, 4096u, chunks);
+
+    ASSERT_EQ(2u, chunks.size());
+    EXPECT_EQ(0u, chunks[0]);
+    EXPECT_EQ(4096u, chunks[1]);
+
+    planner.planChunks(NEO::TransferDirection::hostToLocal, 2u, 4096u, chunks);
+    EXPECT_EQ(2048u, chunks[0]);
+    EXPECT_EQ(2048u, chunks[1]);
+}
+
+TEST(BcsSplitPlannerTest, givenSamplesOfDifferentSizesWhenGettingSplitOverheadThenFixedCostOfCopyIsReturned) {
+    BcsSplit::Planner planner;
+    planner.enabled = true;
+
+    EXPECT_EQ(BcsSplit::Planner::defaultSplitOverheadNs, planner.getSplitOverheadNs(NEO::TransferDirection::localToLocal));
+
+    // 1 byte per ns with 5us fixed cost
+    planner.addSample(NEO::TransferDirection::localToLocal, 0u, 2u, 10000u, 15000u);
+    planner.addSample(NEO::TransferDirection::localToLocal, 0u, 2u, 10000u, 15000u);
+    EXPECT_EQ(BcsSplit::Planner::defaultSplitOverheadNs, planner.getSplitOverheadNs(NEO::TransferDirection::localToLocal));
+
+    planner.addSample(NEO::TransferDirection::localToLocal, 0u, 2u, 100000u, 105000u);
+    planner.addSample(NEO::TransferDirection::localToLocal, 0u, 2u, 1000000u, 1005000u);
+    EXPECT_NEAR(5000.0, planner.getSplitOverheadNs(NEO::TransferDirection::localToLocal), 1.0);
+    EXPECT_EQ(BcsSplit::Planner::defaultSplitOverheadNs, planner.getSplitOverheadNs(NEO::TransferDirection::hostToLocal));
+
+    planner.learnOverhead = false;
+    planner.splitOverheadNs = 1000.0;
+    EXPECT_EQ(1000.0, planner.getSplitOverheadNs(NEO::TransferDirection::localToLocal));
+}
+
+TEST(BcsSplitPlannerTest, givenLearnedOverheadWhenPlanningChunksThenLearnedOverheadIsUsed) {
+    BcsSplit::Planner planner;
+    planner.enabled = true;
+    planner.splitOverheadNs = 0.0;
+    BcsSplit::Planner::ChunkSizes chunks;
+
+    // 1 byte per ns with 1ms fixed cost on both engines
+    for (auto engine : {0u, 1u}) {
+        planner.addSample(NEO::TransferDirection::localToLocal, engine, 2u, 1000000u, 2000000u);
+        planner.addSample(NEO::TransferDirection::localToLocal, engine, 2u, 3000000u, 4000000u);
+    }
+    planner.planChunks(NEO::TransferDirection::localToLocal, 2u, 1000000u, chunks);
+
+    ASSERT_EQ(2u, chunks.size());
+    EXPECT_EQ(1000000u, chunks[0] + chunks[1]);
+    EXPECT_TRUE(chunks[0] == 0u || chunks[1] == 0u);
+}
+
+TEST(BcsSplitPlannerTest, givenIdleEngineWhenPlanningChunksRepeatedlyThenSizeIsPeriodicallySplitEvenlyAndEngineIsUsedAgainWhenFaster) {
+    BcsSplit::Planner planner;
+    planner.enabled = true;
+    planner.learnOverhead = false;
+    planner.splitOverheadNs = 10000.0;
+    BcsSplit::Planner::ChunkSizes chunks;
+
+    planner.addSample(NEO::TransferDirection::localToHost, 0u, 2u, 1000u, 1000u);
+    planner.addSample(NEO::TransferDirection::localToHost, 1u, 2u, 2000u, 1000u);
+
+    for (uint32_t i = 0; i + 1 < BcsSplit::Planner::explorationInterval; i++) {
+        planner.planChunks(NEO::TransferDirection::localToHost, 2u, 4096u, chunks);
+        EXPECT_EQ(0u, chunks[0]);
+        EXPECT_EQ(4096u, chunks[1]);
+    }
+
+    planner.planChunks(NEO::TransferDirection::localToHost, 2u, 4096u, chunks);
+    EXPECT_EQ(2048u, chunks[0]);
+    EXPECT_EQ(2048u, chunks[1]);
+
+    for (uint32_t i = 0; i < 8; i++) {
+        planner.addSample(NEO::TransferDirection::localToHost, 0u, 2u, 2048u, 256u);
+    }
+    planner.planChunks(NEO::TransferDirection::localToHost, 2u, 4096u, chunks);
+    EXPECT_EQ(4096u, chunks[0]);
+    EXPECT_EQ(0u, chunks[1]);
+}
+
+TEST(BcsSplitPlannerTest, givenMeasuredEnginesWhenPlannerIsResetThenSizeIsSplitEvenly) {
+    BcsSplit::Planner planner;
+    planner.enabled = true;
+    BcsSplit::Planner::ChunkSizes chunks;
+
+    planner.addSample(NEO::TransferDirection::localToLocal, 0u, 2u, 1000u, 1000u);
+    planner.addSample(NEO::TransferDirection::localToLocal, 1u, 2u, 3000u, 1000u);
+    planner.reset();
+    planner.planChunks(NEO::TransferDirection::localToLocal, 2u, 4000u, chunks);
+
+    EXPECT_EQ(2000u, chunks[0]);
+    EXPECT_EQ(2000u, chunks[1]);
+}
+
 } // namespace ult
 } // namespace L0
@@ -902,6 +902,39 @@ TEST_F(ModuleSpecConstantsCharTests, givenSpecializationConstantsSetWithCharSize
     runTest();
 }
 
+TEST_F(ModuleSpecConstantsLongTests, givenSpecializationConstantsSetWhenBuildingModuleThenPreparedSpirVIsPassedToTheCompiler) {
+    runTest();
+    EXPECT_EQ(1u, mockCompiler->getSpecConstantsInfoCalled);
+    EXPECT_NE(nullptr, mockCompiler->receivedPreparedSrc);
+}
+
+TEST_F(ModuleSpecConstantsLongTests, givenSameSpirVWhenProcessingSpecConstantsInfoMultipleTimesThenSpecConstantsInfoIsQueriedOnce) {
+    const char spirV[] = "spirv";
+    const char otherSpirV[] = "other_spirv";
+    specConstants.numConstants = 1u;
+    specConstants.pConstantIds = mockCompiler->moduleSpecConstantsIds.data();
+    specConstantsPointerValues.push_back(&mockCompiler->moduleSpecConstantsValuesT2[0]);
+    specConstants.pConstantValues = specConstantsPointerValues.data();
+
+    auto translationUnit = std::make_unique<MockModuleTranslationUnit>(device);
+    EXPECT_TRUE(translationUnit->processSpecConstantInfo(mockCompiler, &specConstants, spirV, sizeof(spirV)));
+    auto preparedSpirV = translationUnit->preparedSpirV;
+    ASSERT_NE(nullptr, preparedSpirV);
+    EXPECT_EQ(sizeof(spirV), preparedSpirV->size);
+    EXPECT_EQ(mockCompiler->moduleSpecConstantsIds, preparedSpirV->specConstantsIds);
+
+    auto otherTranslationUnit = std::make_unique<MockModuleTranslationUnit>(device);
+    EXPECT_TRUE(otherTranslationUnit->processSpecConstantInfo(mockCompiler, &specConstants, spirV, sizeof(spirV)));
+    EXPECT_EQ(preparedSpirV, otherTranslationUnit->preparedSpirV);
+    EXPECT_EQ(1u, mockCompiler->getSpecConstantsInfoCalled);
+    EXPECT_EQ(translationUnit->specConstantsValues, otherTranslationUnit->specConstantsValues);
+
+    EXPECT_TRUE(otherTranslationUnit->processSpecConstantInfo(mockCompiler, &specConstants, otherSpirV, sizeof(otherSpirV)));
+    EXPECT_NE(preparedSpirV, otherTranslationUnit->preparedSpirV);
+    EXPECT_EQ(2u, mockCompiler->getSpecConstantsInfoCalled);
+    delete mockTranslationUnit;
+}
+
 TEST_F(ModuleSpecConstantsLongTests, givenSpecializationConstantsSetWhenCompilerReturnsErrorThenModuleInitFails) {
     class FailingMockCompilerInterfaceWithSpecConstants : public MockCompilerInterfaceWithSpecConstants<uint32_t, uint64_t> {
       public:
@@ -3225,6 +3258,55 @@ HWTEST_F(ModuleTranslationUnitTest, WhenCreatingFromZebinThenDontAppendAllowZebi
     EXPECT_STREQ(expectedOptions, moduleTu.options.c_str());
 }
 
+HWTEST_F(ModuleTranslationUnitTest, WhenCreatingFromZebinThenUnpackedBinaryAndIrShareStorageWithSinglePackedCopy) {
+    ZebinTestData::ValidEmptyProgram zebin;
+    const uint8_t spirv[] = {0x03, 0x02, 0x23, 0x07, 0x10, 0x20, 0x30, 0x40};
+    zebin.appendSection(NEO::Zebin::Elf::SHT_ZEBIN_SPIRV, NEO::Zebin::Elf::SectionNames::spv, ArrayRef<const uint8_t>(spirv));
+    zebin.elfHeader->machine = device->getNEODevice()->getHardwareInfo().platform.eProductFamily;
+    const auto expectedBinary = zebin.storage;
+
+    L0::ModuleTranslationUnit moduleTu(this->device);
+    auto result = moduleTu.createFromNativeBinary(reinterpret_cast<const char *>(zebin.storage.data()), zebin.storage.size());
+    EXPECT_EQ(result, ZE_RESULT_SUCCESS);
+    std::fill(zebin.storage.begin(), zebin.storage.end(), 0u);
+
+    ASSERT_NE(nullptr, moduleTu.packedDeviceBinary);
+    ASSERT_EQ(expectedBinary.size(), moduleTu.packedDeviceBinarySize);
+    EXPECT_EQ(0, memcmp(expectedBinary.data(), moduleTu.packedDeviceBinary.get(), expectedBinary.size()));
+    EXPECT_EQ(moduleTu.packedDeviceBinary.get(), moduleTu.unpackedDeviceBinary.get());
+    EXPECT_EQ(moduleTu.packedDeviceBinarySize, moduleTu.unpackedDeviceBinarySize);
+
+    ASSERT_NE(nullptr, moduleTu.irBinary);
+    ASSERT_EQ(sizeof(spirv), moduleTu.irBinarySize);
+    EXPECT_GE(moduleTu.irBinary.get(), moduleTu.packedDeviceBinary.get());
+    EXPECT_LE(moduleTu.irBinary.get() + moduleTu.irBinarySize, moduleTu.packedDeviceBinary.get() + moduleTu.packedDeviceBinarySize);
+    EXPECT_EQ(0, memcmp(spirv, moduleTu.irBinary.get(), sizeof(spirv)));
+
+    moduleTu.packedDeviceBinary.reset();
+    moduleTu.unpackedDeviceBinary.reset();
+    EXPECT_EQ(0, memcmp(spirv, moduleTu.irBinary.get(), sizeof(spirv)));
+}
+
+TEST(ModuleTranslationUnitShareOrCopyBinaryTest, givenBinaryOutsideOfStorageRangeWhenSharingThenCopyIsReturned) {
+    std::shared_ptr<char[]> storage = makeCopy<char>("abcdef", 6);
+    ArrayRef<const uint8_t> storageRange = ArrayRef<const uint8_t>::fromAny(storage.get(), 6);
+    const char other[] = "xyz";
+
+    auto shared = L0::ModuleTranslationUnit::shareOrCopyBinary(storage, storageRange, ArrayRef<const uint8_t>::fromAny(storage.get() + 2, 3));
+    EXPECT_EQ(storage.get() + 2, shared.get());
+
+    auto copied = L0::ModuleTranslationUnit::shareOrCopyBinary(storage, storageRange, ArrayRef<const uint8_t>::fromAny(other, 3));
+    ASSERT_NE(nullptr, copied);
+    EXPECT_NE(other, copied.get());
+    EXPECT_EQ(0, memcmp(other, copied.get(), 3));
+
+    auto copiedWithoutStorage = L0::ModuleTranslationUnit::shareOrCopyBinary(nullptr, {}, ArrayRef<const uint8_t>::fromAny(other, 3));
+    ASSERT_NE(nullptr, copiedWithoutStorage);
+    EXPECT_EQ(0, memcmp(other, copiedWithoutStorage.get(), 3));
+
+    EXPECT_EQ(nullptr, L0::ModuleTranslationUnit::shareOrCopyBinary(storage, storageRange, {}));
+}
+
 HWTEST2_F(ModuleTranslationUnitTest, givenLargeGrfAndSimd16WhenProcessingBinaryThenKernelGroupSizeReducedToFitWithinSubslice, IsWithinXeGfxFamily) {
     std::string validZeInfo = std::string("version :\'") + versionToString(NEO::Zebin::ZeInfo::zeInfoDecoderVersion) + R"===('
 kernels:
@@ -4900,5 +4982,290 @@ HWTEST2_F(MultiTileModuleTest, givenTwoKernelPrivateAllocsWhichExceedGlobalMemSi
     this->modules[0]->checkIfPrivateMemoryPerDispatchIsNeeded();
     EXPECT_TRUE(this->modules[0]->shouldAllocatePrivateMemoryPerDispatch());
 }
+
+struct ModuleLazyKernelMaterializationFixture : public ModuleFixture {
+    void setUp() {
+        debugManager.flags.EnableLazyKernelMaterialization.set(1);
+        debugManager.flags.ForceExtendedKernelIsaSize.set(16);
+        ModuleFixture::setUp(true);
+    }
+
+    std::unique_ptr<WhiteBox<::L0::Module>> createLazyModule(ModuleType type) {
+        zebinData = std::make_unique<ZebinTestData::ZebinWithL0TestCommonModule>(device->getHwInfo());
+
+        ze_module_desc_t moduleDesc = {};
+        moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+        moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>(zebinData->storage.data());
+        moduleDesc.inputSize = zebinData->storage.size();
+
+        auto newModule = std::make_unique<WhiteBox<::L0::Module>>(device, nullptr, type);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, newModule->initialize(&moduleDesc, neoDevice));
+        return newModule;
+    }
+};
+using ModuleLazyKernelMaterializationTest = Test<ModuleLazyKernelMaterializationFixture>;
+
+HWTEST_F(ModuleLazyKernelMaterializationTest, givenLazyKernelMaterializationWhenModuleIsCreatedThenIsaIsCopiedOnlyForCreatedKernel) {
+    auto lazyModule = createLazyModule(ModuleType::user);
+    ASSERT_TRUE(lazyModule->isKernelMaterializationLazy());
+    ASSERT_EQ(nullptr, lazyModule->getKernelsIsaParentAllocation());
+
+    auto &kernelImmDatas = lazyModule->getKernelImmutableDataVector();
+    ASSERT_EQ(zebinData->numOfKernels, kernelImmDatas.size());
+    for (auto &kernelImmData : kernelImmDatas) {
+        EXPECT_FALSE(kernelImmData->isIsaCopiedToAllocation());
+        EXPECT_NE(nullptr, kernelImmData->getKernelInfo());
+    }
+
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.pKernelName = kernelImmDatas[1]->getDescriptor().kernelMetadata.kernelName.c_str();
+    ze_kernel_handle_t kernelHandle = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, lazyModule->createKernel(&kernelDesc, &kernelHandle));
+
+    EXPECT_FALSE(kernelImmDatas[0]->isIsaCopiedToAllocation());
+    EXPECT_TRUE(kernelImmDatas[1]->isIsaCopiedToAllocation());
+
+    auto residencyCount = kernelImmDatas[1]->getResidencyContainer().size();
+    ze_kernel_handle_t secondKernelHandle = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, lazyModule->createKernel(&kernelDesc, &secondKernelHandle));
+    EXPECT_EQ(residencyCount, kernelImmDatas[1]->getResidencyContainer().size());
+
+    Kernel::fromHandle(secondKernelHandle)->destroy();
+    Kernel::fromHandle(kernelHandle)->destroy();
+}
+
+TEST_F(ModuleLazyKernelMaterializationTest, givenLazyKernelMaterializationWhenGettingKernelFunctionPointerThenKernelIsaIsCopied) {
+    auto lazyModule = createLazyModule(ModuleType::user);
+    ASSERT_TRUE(lazyModule->isKernelMaterializationLazy());
+
+    auto &kernelImmDatas = lazyModule->getKernelImmutableDataVector();
+    void *functionPointer = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, lazyModule->getFunctionPointer(kernelImmDatas[0]->getDescriptor().kernelMetadata.kernelName.c_str(), &functionPointer));
+    EXPECT_EQ(reinterpret_cast<void *>(kernelImmDatas[0]->getIsaGraphicsAllocation()->getGpuAddress()), functionPointer);
+    EXPECT_TRUE(kernelImmDatas[0]->isIsaCopiedToAllocation());
+    EXPECT_FALSE(kernelImmDatas[1]->isIsaCopiedToAllocation());
+}
+
+TEST_F(ModuleLazyKernelMaterializationTest, givenLazyKernelMaterializationWhenGettingFunctionPointerOfSymbolInKernelIsaThenKernelContainingSymbolIsMaterialized) {
+    auto lazyModule = createLazyModule(ModuleType::user);
+    ASSERT_TRUE(lazyModule->isKernelMaterializationLazy());
+
+    auto &kernelImmDatas = lazyModule->getKernelImmutableDataVector();
+    NEO::Linker::RelocatedSymbol<NEO::SymbolInfo> functionSymbol;
+    functionSymbol.symbol.segment = NEO::SegmentType::instructions;
+    functionSymbol.symbol.instructionSegmentId = 1u;
+    functionSymbol.gpuAddress = kernelImmDatas[1]->getIsaGraphicsAllocation()->getGpuAddress() + 0x40;
+    lazyModule->symbols["function"] = functionSymbol;
+
+    void *functionPointer = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, lazyModule->getFunctionPointer("function", &functionPointer));
+    EXPECT_EQ(reinterpret_cast<void *>(functionSymbol.gpuAddress), functionPointer);
+    EXPECT_FALSE(kernelImmDatas[0]->isIsaCopiedToAllocation());
+    EXPECT_TRUE(kernelImmDatas[1]->isIsaCopiedToAllocation());
+}
+
+TEST_F(ModuleLazyKernelMaterializationTest, givenKernelCallingFunctionInIsaOfOtherKernelWhenKernelIsCreatedThenBothKernelsAreMaterialized) {
+    auto lazyModule = createLazyModule(ModuleType::user);
+    ASSERT_TRUE(lazyModule->isKernelMaterializationLazy());
+    auto &kernelImmDatas = lazyModule->getKernelImmutableDataVector();
+    ASSERT_LE(2u, kernelImmDatas.size());
+
+    NEO::SymbolInfo functionSymbol;
+    functionSymbol.segment = NEO::SegmentType::instructions;
+    functionSymbol.instructionSegmentId = 1u;
+    NEO::LinkerInput::RelocationInfo call;
+    call.symbolName = "function";
+    call.relocationSegment = NEO::SegmentType::instructions;
+
+    auto linkerInput = std::make_unique<::WhiteBox<NEO::LinkerInput>>();
+    linkerInput->symbols["function"] = functionSymbol;
+    linkerInput->textRelocations.resize(kernelImmDatas.size());
+    linkerInput->textRelocations[0].push_back(call);
+    lazyModule->translationUnit->programInfo.linkerInput = std::move(linkerInput);
+    lazyModule->initializeKernelDependencies();
+
+    ASSERT_EQ(1u, lazyModule->kernelDependencyIds[0].size());
+    EXPECT_EQ(1u, lazyModule->kernelDependencyIds[0][0]);
+    EXPECT_TRUE(lazyModule->kernelDependencyIds[1].empty());
+
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.pKernelName = kernelImmDatas[0]->getDescriptor().kernelMetadata.kernelName.c_str();
+    ze_kernel_handle_t kernelHandle = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, lazyModule->createKernel(&kernelDesc, &kernelHandle));
+    EXPECT_TRUE(kernelImmDatas[0]->isIsaCopiedToAllocation());
+    EXPECT_TRUE(kernelImmDatas[1]->isIsaCopiedToAllocation());
+    EXPECT_NE(nullptr, kernelImmDatas[1]->getCrossThreadDataTemplate());
+
+    Kernel::fromHandle(kernelHandle)->destroy();
+}
+
+TEST_F(ModuleLazyKernelMaterializationTest, givenKernelDependencyOnExternalFunctionWhenInitializingKernelDependenciesThenKernelContainingFunctionIsDependency) {
+    auto lazyModule = createLazyModule(ModuleType::user);
+    ASSERT_TRUE(lazyModule->isKernelMaterializationLazy());
+    auto &kernelImmDatas = lazyModule->getKernelImmutableDataVector();
+    ASSERT_LE(2u, kernelImmDatas.size());
+
+    NEO::SymbolInfo functionSymbol;
+    functionSymbol.segment = NEO::SegmentType::instructions;
+    functionSymbol.instructionSegmentId = 0u;
+
+    auto linkerInput = std::make_unique<::WhiteBox<NEO::LinkerInput>>();
+    linkerInput->symbols["externalFunction"] = functionSymbol;
+    linkerInput->kernelDependencies.push_back({"externalFunction", kernelImmDatas[1]->getDescriptor().kernelMetadata.kernelName});
+    linkerInput->kernelDependencies.push_back({"externalFunction", "unknownKernel"});
+    lazyModule->translationUnit->programInfo.linkerInput = std::move(linkerInput);
+    lazyModule->initializeKernelDependencies();
+
+    EXPECT_TRUE(lazyModule->kernelDependencyIds[0].empty());
+    ASSERT_EQ(1u, lazyModule->kernelDependencyIds[1].size());
+    EXPECT_EQ(0u, lazyModule->kernelDependencyIds[1][0]);
+}
+
+TEST_F(ModuleLazyKernelMaterializationTest, givenKernelsSharingIsaAllocationWhenModuleIsCreatedWithLazyKernelMaterializationThenIsaIsCopiedUpfrontAndKernelDataIsInitializedOnFirstUse) {
+    debugManager.flags.ForceExtendedKernelIsaSize.set(-1);
+    auto lazyModule = createLazyModule(ModuleType::user);
+    if (nullptr == lazyModule->sharedIsaAllocation) {
+        GTEST_SKIP();
+    }
+    ASSERT_TRUE(lazyModule->isKernelMaterializationLazy());
+
+    auto &kernelImmDatas = lazyModule->getKernelImmutableDataVector();
+    for (auto &kernelImmData : kernelImmDatas) {
+        EXPECT_TRUE(kernelImmData->isIsaCopiedToAllocation());
+        EXPECT_EQ(nullptr, kernelImmData->getCrossThreadDataTemplate());
+    }
+
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.pKernelName = kernelImmDatas[1]->getDescriptor().kernelMetadata.kernelName.c_str();
+    ze_kernel_handle_t kernelHandle = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, lazyModule->createKernel(&kernelDesc, &kernelHandle));
+    EXPECT_EQ(nullptr, kernelImmDatas[0]->getCrossThreadDataTemplate());
+    EXPECT_NE(nullptr, kernelImmDatas[1]->getCrossThreadDataTemplate());
+
+    Kernel::fromHandle(kernelHandle)->destroy();
+}
+
+TEST_F(ModuleLazyKernelMaterializationTest, givenBuiltinModuleWhenLazyKernelMaterializationIsEnabledThenModuleIsMaterializedUpfront) {
+    auto builtinModule = createLazyModule(ModuleType::builtin);
+    EXPECT_FALSE(builtinModule->isKernelMaterializationLazy());
+}
+
+TEST_F(ModuleLazyKernelMaterializationTest, givenLazyKernelMaterializationDisabledWhenModuleIsCreatedThenIsaOfAllKernelsIsCopied) {
+    debugManager.flags.EnableLazyKernelMaterialization.set(0);
+    auto eagerModule = createLazyModule(ModuleType::user);
+    EXPECT_FALSE(eagerModule->isKernelMaterializationLazy());
+    for (auto &kernelImmData : eagerModule->getKernelImmutableDataVector()) {
+        EXPECT_TRUE(kernelImmData->isIsaCopiedToAllocation());
+    }
+}
+
+TEST_F(ModuleLazyKernelMaterializationTest, givenUnresolvedSymbolsWhenModuleIsCreatedWithLazyKernelMaterializationThenAllKernelsAreInitializedForDynamicLinking) {
+    zebinData = std::make_unique<ZebinTestData::ZebinWithL0TestCommonModule>(device->getHwInfo());
+
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>(zebinData->storage.data());
+    moduleDesc.inputSize = zebinData->storage.size();
+
+    auto unlinkedModule = std::make_unique<WhiteBox<::L0::Module>>(device, nullptr, ModuleType::user);
+
+    NEO::Linker::RelocationInfo unresolvedRelocation;
+    unresolvedRelocation.symbolName = "unresolved";
+    auto linkerInput = std::make_unique<::WhiteBox<NEO::LinkerInput>>();
+    linkerInput->dataRelocations.push_back(unresolvedRelocation);
+    linkerInput->traits.requiresPatchingOfGlobalVariablesBuffer = true;
+    unlinkedModule->unresolvedExternalsInfo.push_back({unresolvedRelocation});
+    unlinkedModule->translationUnit->programInfo.linkerInput = std::move(linkerInput);
+    unlinkedModule->initialize(&moduleDesc, neoDevice);
+
+    EXPECT_FALSE(unlinkedModule->isFullyLinked);
+    EXPECT_FALSE(unlinkedModule->isKernelMaterializationLazy());
+    for (auto &kernelImmData : unlinkedModule->getKernelImmutableDataVector()) {
+        EXPECT_FALSE(kernelImmData->isIsaCopiedToAllocation());
+        EXPECT_NE(nullptr, kernelImmData->getCrossThreadDataTemplate());
+    }
+}
+
+struct ModuleIsaDeduplicationFixture : public ModuleFixture {
+    void setUp() {
+        debugManager.flags.EnableIsaDeduplication.set(1);
+        ModuleFixture::setUp(true);
+        zebinData = std::make_unique<ZebinTestData::ZebinWithL0TestCommonModule>(device->getHwInfo());
+    }
+
+    std::unique_ptr<WhiteBox<::L0::Module>> createModuleFromZebin(ModuleType type) {
+        ze_module_desc_t moduleDesc = {};
+        moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+        moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>(zebinData->storage.data());
+        moduleDesc.inputSize = zebinData->storage.size();
+
+        auto newModule = std::make_unique<WhiteBox<::L0::Module>>(device, nullptr, type);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, newModule->initialize(&moduleDesc, neoDevice));
+        return newModule;
+    }
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<ZebinTestData::ZebinWithL0TestCommonModule> zebinData;
+};
+using ModuleIsaDeduplicationTest = Test<ModuleIsaDeduplicationFixture>;
+
+TEST_F(ModuleIsaDeduplicationTest, givenIsaDeduplicationEnabledWhenModulesWithIdenticalIsaAreCreatedThenIsaAllocationIsSharedAndUploadedOnce) {
+    auto firstModule = createModuleFromZebin(ModuleType::user);
+    if (nullptr == firstModule->sharedIsaAllocation) {
+        GTEST_SKIP();
+    }
+    EXPECT_TRUE(firstModule->isIsaDeduplicationAllowed());
+    EXPECT_TRUE(firstModule->sharedIsaAllocation->isDeduplicated());
+
+    auto secondModule = createModuleFromZebin(ModuleType::user);
+    EXPECT_EQ(firstModule->sharedIsaAllocation.get(), secondModule->sharedIsaAllocation.get());
+
+    auto &firstKernelImmDatas = firstModule->getKernelImmutableDataVector();
+    auto &secondKernelImmDatas = secondModule->getKernelImmutableDataVector();
+    ASSERT_EQ(firstKernelImmDatas.size(), secondKernelImmDatas.size());
+    for (size_t i = 0; i < firstKernelImmDatas.size(); i++) {
+        EXPECT_EQ(firstKernelImmDatas[i]->getIsaGraphicsAllocation(), secondKernelImmDatas[i]->getIsaGraphicsAllocation());
+        EXPECT_EQ(firstKernelImmDatas[i]->getIsaOffsetInParentAllocation(), secondKernelImmDatas[i]->getIsaOffsetInParentAllocation());
+        EXPECT_TRUE(secondKernelImmDatas[i]->isIsaCopiedToAllocation());
+
+        auto &heapInfo = secondKernelImmDatas[i]->getKernelInfo()->heapInfo;
+        auto isaCpuPtr = secondKernelImmDatas[i]->getIsaGraphicsAllocation()->getUnderlyingBuffer();
+        if (isaCpuPtr != nullptr) {
+            EXPECT_EQ(0, memcmp(ptrOffset(isaCpuPtr, secondKernelImmDatas[i]->getIsaOffsetInParentAllocation()), heapInfo.pKernelHeap, heapInfo.kernelHeapSize));
+        }
+    }
+
+    auto builtinModule = createModuleFromZebin(ModuleType::builtin);
+    EXPECT_NE(firstModule->sharedIsaAllocation.get(), builtinModule->sharedIsaAllocation.get());
+
+    auto sharedIsaAllocation = secondModule->sharedIsaAllocation.get();
+    firstModule.reset();
+    EXPECT_EQ(sharedIsaAllocation, secondModule->sharedIsaAllocation.get());
+    EXPECT_TRUE(secondModule->sharedIsaAllocation->isDeduplicated());
+}
+
+TEST_F(ModuleIsaDeduplicationTest, givenIsaDeduplicationDisabledWhenModulesWithIdenticalIsaAreCreatedThenSeparateIsaAllocationsAreUsed) {
+    debugManager.flags.EnableIsaDeduplication.set(0);
+    auto firstModule = createModuleFromZebin(ModuleType::user);
+    if (nullptr == firstModule->sharedIsaAllocation) {
+        GTEST_SKIP();
+    }
+    EXPECT_FALSE(firstModule->isIsaDeduplicationAllowed());
+    EXPECT_FALSE(firstModule->sharedIsaAllocation->isDeduplicated());
+
+    auto secondModule = createModuleFromZebin(ModuleType::user);
+    EXPECT_NE(firstModule->sharedIsaAllocation.get(), secondModule->sharedIsaAllocation.get());
+    EXPECT_NE(firstModule->getKernelImmutableDataVector()[0]->getIsaOffsetInParentAllocation(), secondModule->getKernelImmutableDataVector()[0]->getIsaOffsetInParentAllocation());
+}
+
+TEST_F(ModuleIsaDeduplicationTest, givenIsaRequiringPatchingWhenCheckingIfIsaDeduplicationIsAllowedThenReturnFalse) {
+    auto moduleWithRelocations = std::make_unique<WhiteBox<::L0::Module>>(device, nullptr, ModuleType::user);
+    EXPECT_TRUE(moduleWithRelocations->isIsaDeduplicationAllowed());
+
+    auto linkerInput = std::make_unique<::WhiteBox<NEO::LinkerInput>>();
+    linkerInput->traits.requiresPatchingOfInstructionSegments = true;
+    moduleWithRelocations->translationUnit->programInfo.linkerInput = std::move(linkerInput);
+    EXPECT_FALSE(moduleWithRelocations->isIsaDeduplicationAllowed());
+}
 } // namespace ult
 } // namespace L0
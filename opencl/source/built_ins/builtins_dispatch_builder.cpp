@@ -8,6 +8,7 @@
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/debug_helpers.h"
@@ -107,11 +108,17 @@ class BuiltInOp<EBuiltInOps::copyBufferToBuffer> : public BuiltinDispatchInfoBui
         }
 
         // Set-up work sizes
+        const BakedDispatchInfosKey bakedDispatchInfosKey = {leftSize, middleSizeEls, rightSize, isSrcMisaligned};
+        if (restoreBakedDispatchInfos(bakedDispatchInfosKey, multiDispatchInfo)) {
+            return true;
+        }
+        const auto firstDispatchInfoIndex = multiDispatchInfo.size();
         // Note for split walker, it would be just builder.SetDipatchGeometry(GWS, ELWS, OFFSET)
         kernelSplit1DBuilder.setDispatchGeometry(SplitDispatch::RegionCoordX::left, Vec3<size_t>{leftSize, 0, 0}, Vec3<size_t>{0, 0, 0}, Vec3<size_t>{0, 0, 0});
         kernelSplit1DBuilder.setDispatchGeometry(SplitDispatch::RegionCoordX::middle, Vec3<size_t>{middleSizeEls, 0, 0}, Vec3<size_t>{0, 0, 0}, Vec3<size_t>{0, 0, 0});
         kernelSplit1DBuilder.setDispatchGeometry(SplitDispatch::RegionCoordX::right, Vec3<size_t>{rightSize, 0, 0}, Vec3<size_t>{0, 0, 0}, Vec3<size_t>{0, 0, 0});
         kernelSplit1DBuilder.bake(multiDispatchInfo);
+        storeBakedDispatchInfos(bakedDispatchInfosKey, multiDispatchInfo, firstDispatchInfoIndex);
 
         return true;
     }
@@ -263,8 +270,14 @@ class BuiltInOp<EBuiltInOps::copyBufferRect> : public BuiltinDispatchInfoBuilder
         kernelNoSplit3DBuilder.setArg(5, sizeof(OffsetType) * 2, kDstPitch);
 
         // Set-up work sizes
+        const BakedDispatchInfosKey bakedDispatchInfosKey = {operationParams.size.x, operationParams.size.y, operationParams.size.z, is3D};
+        if (restoreBakedDispatchInfos(bakedDispatchInfosKey, multiDispatchInfo)) {
+            return true;
+        }
+        const auto firstDispatchInfoIndex = multiDispatchInfo.size();
         kernelNoSplit3DBuilder.setDispatchGeometry(operationParams.size, Vec3<size_t>{0, 0, 0}, Vec3<size_t>{0, 0, 0});
         kernelNoSplit3DBuilder.bake(multiDispatchInfo);
+        storeBakedDispatchInfos(bakedDispatchInfosKey, multiDispatchInfo, firstDispatchInfoIndex);
 
         return true;
     }
@@ -382,11 +395,17 @@ class BuiltInOp<EBuiltInOps::fillBuffer> : public BuiltinDispatchInfoBuilder {
         kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::right, 3, static_cast<OffsetType>(operationParams.srcMemObj->getSize()));
 
         // Set-up work sizes
+        const BakedDispatchInfosKey bakedDispatchInfosKey = {leftSize, middleSizeEls, rightSize, 0u};
+        if (restoreBakedDispatchInfos(bakedDispatchInfosKey, multiDispatchInfo)) {
+            return true;
+        }
+        const auto firstDispatchInfoIndex = multiDispatchInfo.size();
         // Note for split walker, it would be just builder.SetDipatchGeomtry(GWS, ELWS, OFFSET)
         kernelSplit1DBuilder.setDispatchGeometry(SplitDispatch::RegionCoordX::left, Vec3<size_t>{leftSize, 0, 0}, Vec3<size_t>{0, 0, 0}, Vec3<size_t>{0, 0, 0});
         kernelSplit1DBuilder.setDispatchGeometry(SplitDispatch::RegionCoordX::middle, Vec3<size_t>{middleSizeEls, 0, 0}, Vec3<size_t>{0, 0, 0}, Vec3<size_t>{0, 0, 0});
         kernelSplit1DBuilder.setDispatchGeometry(SplitDispatch::RegionCoordX::right, Vec3<size_t>{rightSize, 0, 0}, Vec3<size_t>{0, 0, 0}, Vec3<size_t>{0, 0, 0});
         kernelSplit1DBuilder.bake(multiDispatchInfo);
+        storeBakedDispatchInfos(bakedDispatchInfosKey, multiDispatchInfo, firstDispatchInfoIndex);
 
         return true;
     }
@@ -906,4 +925,47 @@ std::unique_ptr<Program> BuiltinDispatchInfoBuilder::createProgramFromCode(const
     return ret;
 }
 
+bool BuiltinDispatchInfoBuilder::isBakedDispatchInfosCacheEnabled() {
+    return debugManager.flags.EnableBuiltinDispatchInfoCache.get() != 0;
+}
+
+size_t BuiltinDispatchInfoBuilder::peekBakedDispatchInfosCacheSize() const {
+    std::lock_guard<std::mutex> lock(bakedDispatchInfosMutex);
+    return bakedDispatchInfos.size();
+}
+
+bool BuiltinDispatchInfoBuilder::restoreBakedDispatchInfos(const BakedDispatchInfosKey &key, MultiDispatchInfo &multiDispatchInfo) const {
+    if (!isBakedDispatchInfosCacheEnabled()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(bakedDispatchInfosMutex);
+    auto it = bakedDispatchInfos.find(key);
+    if (it == bakedDispatchInfos.end()) {
+        return false;
+    }
+    for (const auto &baked : it->second) {
+        multiDispatchInfo.push({&clDevice, baked.kernel, baked.dim, baked.gws, baked.elws, baked.offset, baked.agws, baked.lws, baked.twgs, baked.nwgs, baked.swgs});
+    }
+    return true;
+}
+
+void BuiltinDispatchInfoBuilder::storeBakedDispatchInfos(const BakedDispatchInfosKey &key, const MultiDispatchInfo &multiDispatchInfo, size_t firstDispatchInfoIndex) const {
+    if (!isBakedDispatchInfosCacheEnabled()) {
+        return;
+    }
+    BakedDispatchInfos baked;
+    for (auto dispatchInfo = multiDispatchInfo.begin() + firstDispatchInfoIndex; dispatchInfo != multiDispatchInfo.end(); ++dispatchInfo) {
+        baked.push_back({dispatchInfo->getKernel(), dispatchInfo->getDim(),
+                         dispatchInfo->getGWS(), dispatchInfo->getEnqueuedWorkgroupSize(), dispatchInfo->getOffset(),
+                         dispatchInfo->getActualWorkgroupSize(), dispatchInfo->getLocalWorkgroupSize(),
+                         dispatchInfo->getTotalNumberOfWorkgroups(), dispatchInfo->getNumberOfWorkgroups(), dispatchInfo->getStartOfWorkgroups()});
+    }
+
+    std::lock_guard<std::mutex> lock(bakedDispatchInfosMutex);
+    if (bakedDispatchInfos.size() >= maxBakedDispatchInfosCacheSize) {
+        bakedDispatchInfos.clear();
+    }
+    bakedDispatchInfos.emplace(key, std::move(baked));
+}
+
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,14 +9,18 @@
 #include "shared/source/built_ins/built_in_ops_base.h"
 #include "shared/source/command_stream/transfer_direction.h"
 #include "shared/source/helpers/vec.h"
+#include "shared/source/utilities/stackvec.h"
 
 #include "opencl/source/kernel/multi_device_kernel.h"
 #include "opencl/source/program/program.h"
 
 #include "CL/cl.h"
 
+#include <array>
 #include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace NEO {
@@ -85,7 +89,33 @@ class BuiltinDispatchInfoBuilder {
 
     static std::unique_ptr<Program> createProgramFromCode(const BuiltinCode &bc, const ClDeviceVector &device);
 
+    size_t peekBakedDispatchInfosCacheSize() const;
+
   protected:
+    // Work sizes computed by DispatchInfoBuilder::bake for a given geometry of a built-in operation.
+    // Kernels of a built-in operation are fixed, so the same geometry always bakes into the same dispatches.
+    struct BakedDispatchInfo {
+        Kernel *kernel = nullptr;
+        uint32_t dim = 0;
+        Vec3<size_t> gws{0, 0, 0};
+        Vec3<size_t> elws{0, 0, 0};
+        Vec3<size_t> offset{0, 0, 0};
+        Vec3<size_t> agws{0, 0, 0};
+        Vec3<size_t> lws{0, 0, 0};
+        Vec3<size_t> twgs{0, 0, 0};
+        Vec3<size_t> nwgs{0, 0, 0};
+        Vec3<size_t> swgs{0, 0, 0};
+    };
+    using BakedDispatchInfosKey = std::array<size_t, 4>;
+    using BakedDispatchInfos = StackVec<BakedDispatchInfo, 3>;
+    static constexpr size_t maxBakedDispatchInfosCacheSize = 256u;
+
+    static bool isBakedDispatchInfosCacheEnabled();
+    // appends cached dispatches to multiDispatchInfo, returns false when geometry was not baked yet
+    bool restoreBakedDispatchInfos(const BakedDispatchInfosKey &key, MultiDispatchInfo &multiDispatchInfo) const;
+    // stores dispatches appended to multiDispatchInfo starting from firstDispatchInfoIndex
+    void storeBakedDispatchInfos(const BakedDispatchInfosKey &key, const MultiDispatchInfo &multiDispatchInfo, size_t firstDispatchInfoIndex) const;
+
     template <typename KernelNameT, typename... KernelsDescArgsT>
     void grabKernels(KernelNameT &&kernelName, MultiDeviceKernel *&kernelDst, KernelsDescArgsT &&...kernelsDesc) {
         auto rootDeviceIndex = clDevice.getRootDeviceIndex();
@@ -107,6 +137,8 @@ class BuiltinDispatchInfoBuilder {
     std::vector<std::unique_ptr<MultiDeviceKernel>> usedKernels;
     BuiltIns &kernelsLib;
     ClDevice &clDevice;
+    mutable std::mutex bakedDispatchInfosMutex;
+    mutable std::map<BakedDispatchInfosKey, BakedDispatchInfos> bakedDispatchInfos;
 };
 
 class BuiltInDispatchBuilderOp {
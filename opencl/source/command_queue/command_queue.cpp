@@ -1088,6 +1088,25 @@ bool CommandQueue::bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandT
     return false;
 }
 
+bool CommandQueue::imageCpuWriteAllowed(Image *image, cl_bool blocking, GraphicsAllocation *mapAllocation,
+                                        cl_uint numEventsInWaitList, const cl_event *eventWaitList) {
+    if (debugManager.flags.DoCpuCopyOnWriteImage.get() != 1) {
+        return false;
+    }
+
+    // writing on CPU waits for previous commands, non blocking writes must not stall the pipeline
+    if (blocking == CL_FALSE || mapAllocation != nullptr) {
+        return false;
+    }
+
+    // if we are blocked by user events, we can't service the call on CPU
+    if (Event::checkUserEventDependencies(numEventsInWaitList, eventWaitList)) {
+        return false;
+    }
+
+    return image->isCpuTiledTransferPreferred(device->getRootDeviceIndex());
+}
+
 bool CommandQueue::queueDependenciesClearRequired() const {
     return isOOQEnabled() || debugManager.flags.OmitTimestampPacketDependencies.get();
 }
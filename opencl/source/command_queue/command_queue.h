@@ -407,6 +407,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     void overrideEngine(aub_stream::EngineType engineType, EngineUsage engineUsage);
     bool bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandType, cl_bool blocking, size_t size, void *ptr,
                               cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+    bool imageCpuWriteAllowed(Image *image, cl_bool blocking, GraphicsAllocation *mapAllocation,
+                              cl_uint numEventsInWaitList, const cl_event *eventWaitList);
     void providePerformanceHint(TransferProperties &transferProperties);
     bool queueDependenciesClearRequired() const;
     bool blitEnqueueAllowed(const CsrSelectionArgs &args) const;
@@ -462,6 +462,8 @@ class CommandQueueHw : public CommandQueue {
                                                             const cl_event *eventWaitList, cl_event *event);
     cl_int enqueueMarkerForReadWriteOperation(MemObj *memObj, void *ptr, cl_command_type commandType, cl_bool blocking, cl_uint numEventsInWaitList,
                                               const cl_event *eventWaitList, cl_event *event);
+    cl_int enqueueWriteImageOnCpu(Image *image, const size_t *origin, const size_t *region, size_t inputRowPitch, size_t inputSlicePitch,
+                                  const void *ptr, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event);
 
     MOCKABLE_VIRTUAL void dispatchAuxTranslationBuiltin(MultiDispatchInfo &multiDispatchInfo, AuxTranslationDirection auxTranslationDirection);
     void setupBlitAuxTranslation(MultiDispatchInfo &multiDispatchInfo);
@@ -85,6 +85,21 @@ cl_int CommandQueueHw<Family>::enqueueReadWriteBufferOnCpuWithoutMemoryTransfer(
     return retVal;
 }
 
+template <typename Family>
+cl_int CommandQueueHw<Family>::enqueueWriteImageOnCpu(Image *image, const size_t *origin, const size_t *region, size_t inputRowPitch, size_t inputSlicePitch,
+                                                      const void *ptr, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) {
+    cl_int retVal = CL_SUCCESS;
+    EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
+
+    auto elementSize = image->getSurfaceFormatInfo().surfaceFormat.imageElementSizeInBytes;
+    TransferProperties transferProperties(image, CL_COMMAND_WRITE_IMAGE, 0, true, const_cast<size_t *>(origin), const_cast<size_t *>(region),
+                                          const_cast<void *>(ptr), true, getDevice().getRootDeviceIndex());
+    transferProperties.hostPtrRowPitch = inputRowPitch ? inputRowPitch : region[0] * elementSize;
+    transferProperties.hostPtrSlicePitch = inputSlicePitch ? inputSlicePitch : transferProperties.hostPtrRowPitch * region[1];
+    cpuDataTransferHandler(transferProperties, eventsRequest, retVal);
+    return retVal;
+}
+
 template <typename Family>
 cl_int CommandQueueHw<Family>::enqueueMarkerForReadWriteOperation(MemObj *memObj, void *ptr, cl_command_type commandType, cl_bool blocking, cl_uint numEventsInWaitList,
                                                                   const cl_event *eventWaitList, cl_event *event) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/get_info.h"
+#include "shared/source/utilities/cpu_memory_copy.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/source/utilities/logger.h"
 
@@ -152,14 +153,28 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
             }
             break;
         case CL_COMMAND_READ_BUFFER:
-            memcpy_s(transferProperties.ptr, transferProperties.size[0], transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
+            CpuMemoryCopy::copy(transferProperties.ptr, transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], true);
             eventCompleted = true;
             break;
         case CL_COMMAND_WRITE_BUFFER:
-            memcpy_s(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.size[0]);
+            CpuMemoryCopy::copy(transferProperties.getCpuPtrForReadWrite(), transferProperties.ptr, transferProperties.size[0], false);
             eventCompleted = true;
             modifySimulationFlags = true;
             break;
+        case CL_COMMAND_WRITE_IMAGE: {
+            auto image = castToObjectOrAbort<Image>(transferProperties.memObj);
+            if (!image->writeTiledImageOnCpu(transferProperties.ptr, transferProperties.hostPtrRowPitch, transferProperties.hostPtrSlicePitch,
+                                             transferProperties.offset.data(), transferProperties.size.data(), getDevice().getRootDeviceIndex())) {
+                // fall back to GPU copy, non blocking write is never serviced on CPU so finish completes it before event is signaled
+                auto gpuWriteResult = enqueueWriteImage(image, CL_FALSE, transferProperties.offset.data(), transferProperties.size.data(),
+                                                        transferProperties.hostPtrRowPitch, transferProperties.hostPtrSlicePitch, transferProperties.ptr,
+                                                        nullptr, 0, nullptr, nullptr);
+                err.set(gpuWriteResult == CL_SUCCESS ? finish() : gpuWriteResult);
+            }
+            eventCompleted = true;
+            modifySimulationFlags = true;
+            break;
+        }
         case CL_COMMAND_MARKER:
             break;
         default:
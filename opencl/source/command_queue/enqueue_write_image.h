@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -51,6 +51,11 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteImage(
                                                   numEventsInWaitList, eventWaitList, event);
     }
 
+    if (imageCpuWriteAllowed(dstImage, blockingWrite, mapAllocation, numEventsInWaitList, eventWaitList)) {
+        return enqueueWriteImageOnCpu(dstImage, origin, region, inputRowPitch, inputSlicePitch, ptr,
+                                      numEventsInWaitList, eventWaitList, event);
+    }
+
     size_t hostPtrSize = calculateHostPtrSizeForImage(region, inputRowPitch, inputSlicePitch, dstImage);
     void *srcPtr = const_cast<void *>(ptr);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/event/event.h"
 
 #include <iterator>
@@ -39,17 +40,22 @@ void AsyncEventsHandler::registerEvent(Event *event) {
 
 Event *AsyncEventsHandler::processList() {
     TaskCountType lowestTaskCount = CompletionStamp::notReady;
-    Event *sleepCandidate = nullptr;
+    Event *sleepCandidate = processSubmittedEvents(lowestTaskCount);
     pendingList.clear();
 
     for (auto event : list) {
         event->updateExecutionStatus();
         if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
-            pendingList.push_back(event);
             if (event->peekTaskCount() < lowestTaskCount) {
                 sleepCandidate = event;
                 lowestTaskCount = event->peekTaskCount();
             }
+            if (isWaitingOnlyForCompletion(*event)) {
+                auto &csr = event->getCommandQueue()->getGpgpuCommandStreamReceiver();
+                submittedEvents[&csr].emplace(event->peekTaskCount(), event);
+            } else {
+                pendingList.push_back(event);
+            }
         } else {
             event->decRefInternal();
         }
@@ -59,6 +65,46 @@ Event *AsyncEventsHandler::processList() {
     return sleepCandidate;
 }
 
+Event *AsyncEventsHandler::processSubmittedEvents(TaskCountType &lowestTaskCount) {
+    Event *sleepCandidate = nullptr;
+
+    for (auto csrIt = submittedEvents.begin(); csrIt != submittedEvents.end();) {
+        auto &events = csrIt->second;
+
+        // csr completes tasks in order, so the walk stops at the first event which is still not completed
+        auto eventIt = events.begin();
+        while (eventIt != events.end()) {
+            auto event = eventIt->second;
+            event->updateExecutionStatus();
+            if (event->peekHasCallbacks()) {
+                break;
+            }
+            event->decRefInternal();
+            eventIt = events.erase(eventIt);
+        }
+
+        if (events.empty()) {
+            csrIt = submittedEvents.erase(csrIt);
+            continue;
+        }
+
+        if (events.begin()->first < lowestTaskCount) {
+            sleepCandidate = events.begin()->second;
+            lowestTaskCount = events.begin()->first;
+        }
+        ++csrIt;
+    }
+
+    return sleepCandidate;
+}
+
+bool AsyncEventsHandler::isWaitingOnlyForCompletion(Event &event) {
+    return (event.peekExecutionStatus() == CL_SUBMITTED) &&
+           (event.getCommandQueue() != nullptr) &&
+           (event.peekTaskCount() != CompletionStamp::notReady) &&
+           !event.isExternallySynchronized();
+}
+
 void *AsyncEventsHandler::asyncProcess(void *arg) {
     auto self = reinterpret_cast<AsyncEventsHandler *>(arg);
     std::unique_lock<std::mutex> lock(self->asyncMtx, std::defer_lock);
@@ -73,7 +119,7 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
             self->releaseEvents();
             break;
         }
-        if (self->list.empty()) {
+        if (self->isListEmpty()) {
             self->asyncCond.wait(lock);
         }
         lock.unlock();
@@ -119,6 +165,12 @@ void AsyncEventsHandler::releaseEvents() {
         event->decRefInternal();
     }
     list.clear();
+    for (auto &csrEvents : submittedEvents) {
+        for (auto &event : csrEvents.second) {
+            event.second->decRefInternal();
+        }
+    }
+    submittedEvents.clear();
     UNRECOVERABLE_IF(!registerList.empty()) // transferred before release
 }
 } // namespace NEO
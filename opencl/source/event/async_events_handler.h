@@ -1,18 +1,22 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/command_stream/task_count_helper.h"
+
 #include <atomic>
 #include <condition_variable>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <vector>
 
 namespace NEO {
+class CommandStreamReceiver;
 class Event;
 class Thread;
 
@@ -24,7 +28,12 @@ class AsyncEventsHandler {
     void closeThread();
 
   protected:
+    using SubmittedEventsList = std::multimap<TaskCountType, Event *>;
+
     Event *processList();
+    Event *processSubmittedEvents(TaskCountType &lowestTaskCount);
+    bool isListEmpty() const { return list.empty() && submittedEvents.empty(); }
+    static bool isWaitingOnlyForCompletion(Event &event);
     static void *asyncProcess(void *arg);
     void releaseEvents();
     MOCKABLE_VIRTUAL void openThread();
@@ -32,6 +41,8 @@ class AsyncEventsHandler {
     std::vector<Event *> registerList;
     std::vector<Event *> list;
     std::vector<Event *> pendingList;
+    // submitted events waiting only for completion, ordered by task count per gpgpu csr
+    std::map<CommandStreamReceiver *, SubmittedEventsList> submittedEvents;
 
     std::unique_ptr<Thread> thread;
     std::mutex asyncMtx;
@@ -29,6 +29,7 @@
 #include "opencl/source/context/context.h"
 #include "opencl/source/event/async_events_handler.h"
 #include "opencl/source/event/event_tracker.h"
+#include "opencl/source/event/events_trace_recorder.h"
 #include "opencl/source/helpers/get_info_status_mapper.h"
 #include "opencl/source/helpers/hardware_commands_helper.h"
 #include "opencl/source/helpers/task_information.h"
@@ -51,6 +52,9 @@ Event::Event(
     if (NEO::debugManager.flags.EventsTrackerEnable.get()) {
         EventsTracker::getEventsTracker().notifyCreation(this);
     }
+    if (NEO::debugManager.flags.EventsTraceEnable.get()) {
+        EventsTraceRecorder::getEventsTraceRecorder().notifyCreation(this, cmdQueue, cmdType);
+    }
     flushStamp.reset(new FlushStampTracker(true));
 
     DBG_LOG(EventsDebugEnable, "Event()", this);
@@ -140,6 +144,10 @@ Event::~Event() {
 
     // in case event did not unblock child events before
     unblockEventsBlockedByThis(executionStatus);
+
+    if (NEO::debugManager.flags.EventsTraceEnable.get()) {
+        EventsTraceRecorder::getEventsTraceRecorder().notifyDestruction(this);
+    }
 }
 
 cl_int Event::getEventProfilingInfo(cl_profiling_info paramName,
@@ -571,6 +579,9 @@ void Event::addChild(Event &childEvent) {
     if (debugManager.flags.TrackParentEvents.get()) {
         childEvent.parentEvents.push_back(this);
     }
+    if (debugManager.flags.EventsTraceEnable.get()) {
+        EventsTraceRecorder::getEventsTraceRecorder().notifyDependencyAdded(this, &childEvent);
+    }
     if (executionStatus == CL_COMPLETE) {
         unblockEventsBlockedByThis(CL_COMPLETE);
     }
@@ -651,6 +662,9 @@ void Event::transitionExecutionStatus(int32_t newExecutionStatus) const {
     if (NEO::debugManager.flags.EventsTrackerEnable.get()) {
         EventsTracker::getEventsTracker().notifyTransitionedExecutionStatus();
     }
+    if (NEO::debugManager.flags.EventsTraceEnable.get()) {
+        EventsTraceRecorder::getEventsTraceRecorder().notifyTransitionedExecutionStatus(this, executionStatus);
+    }
 }
 
 void Event::submitCommand(bool abortTasks) {
@@ -0,0 +1,393 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/event/events_trace_recorder.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/io_functions.h"
+
+#include "opencl/source/helpers/cl_helper.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <unordered_map>
+
+namespace NEO {
+
+namespace {
+std::atomic<uint64_t> recordersCount{0u};
+
+struct ThreadRingCache {
+    ~ThreadRingCache() {
+        if (ring) {
+            ring->release();
+        }
+    }
+    uint64_t recorderId = 0u;
+    std::shared_ptr<EventTraceRecordsRing> ring;
+};
+thread_local ThreadRingCache threadRingCache;
+} // namespace
+
+std::mutex EventsTraceRecorder::globalRecorderMutex;
+std::unique_ptr<EventsTraceRecorder> EventsTraceRecorder::globalEventsTraceRecorder = nullptr;
+
+bool EventTraceRecordsRing::push(const EventTraceRecord &record) {
+    auto currentWriteIndex = writeIndex.load(std::memory_order_relaxed);
+    if (currentWriteIndex - readIndex.load(std::memory_order_acquire) == capacity) {
+        return false;
+    }
+    records[currentWriteIndex & (capacity - 1)] = record;
+    writeIndex.store(currentWriteIndex + 1, std::memory_order_release);
+    return true;
+}
+
+size_t EventTraceRecordsRing::pop(EventTraceRecord *outRecords, size_t maxCount) {
+    auto currentReadIndex = readIndex.load(std::memory_order_relaxed);
+    auto available = static_cast<size_t>(writeIndex.load(std::memory_order_acquire) - currentReadIndex);
+    auto count = std::min(available, maxCount);
+    for (size_t i = 0; i < count; i++) {
+        outRecords[i] = records[(currentReadIndex + i) & (capacity - 1)];
+    }
+    readIndex.store(currentReadIndex + count, std::memory_order_release);
+    return count;
+}
+
+bool EventTraceRecordsRing::tryAcquire() {
+    bool expected = false;
+    return acquired.compare_exchange_strong(expected, true, std::memory_order_acq_rel);
+}
+
+void EventTraceRecordsRing::release() {
+    acquired.store(false, std::memory_order_release);
+}
+
+EventsTraceRecorder::EventsTraceRecorder() : recorderId(++recordersCount) {
+}
+
+EventsTraceRecorder::~EventsTraceRecorder() {
+    // draining thread is normally already stopped by shutdown, joining it here is fallback for leaked execution environment
+    stopDrainingThread();
+    flush();
+    if (traceFile) {
+        IoFunctions::fclosePtr(traceFile);
+    }
+}
+
+EventsTraceRecorder &EventsTraceRecorder::getEventsTraceRecorder() {
+    std::lock_guard<std::mutex> autolock(globalRecorderMutex);
+
+    if (!EventsTraceRecorder::globalEventsTraceRecorder) {
+        EventsTraceRecorder::globalEventsTraceRecorder = std::unique_ptr<EventsTraceRecorder>{new EventsTraceRecorder()};
+        EventsTraceRecorder::globalEventsTraceRecorder->startDrainingThread();
+    }
+    return *EventsTraceRecorder::globalEventsTraceRecorder;
+}
+
+void EventsTraceRecorder::shutdownEventsTraceRecorder() {
+    std::lock_guard<std::mutex> autolock(globalRecorderMutex);
+    if (EventsTraceRecorder::globalEventsTraceRecorder) {
+        EventsTraceRecorder::globalEventsTraceRecorder->shutdown();
+    }
+}
+
+void EventsTraceRecorder::shutdown() {
+    stopDrainingThread();
+    flush();
+    if (debugManager.flags.EventsTraceDumpDot.get()) {
+        dumpDot();
+    }
+}
+
+void EventsTraceRecorder::notifyCreation(const Event *event, const CommandQueue *cmdQueue, uint32_t cmdType) {
+    record(EventTraceRecord::Type::created, event, cmdQueue, nullptr, static_cast<int32_t>(cmdType));
+}
+
+void EventsTraceRecorder::notifyDestruction(const Event *event) {
+    record(EventTraceRecord::Type::destroyed, event, nullptr, nullptr, 0);
+}
+
+void EventsTraceRecorder::notifyTransitionedExecutionStatus(const Event *event, int32_t executionStatus) {
+    record(EventTraceRecord::Type::statusChanged, event, nullptr, nullptr, executionStatus);
+}
+
+void EventsTraceRecorder::notifyDependencyAdded(const Event *event, const Event *dependentEvent) {
+    record(EventTraceRecord::Type::dependencyAdded, event, nullptr, dependentEvent, 0);
+}
+
+void EventsTraceRecorder::record(EventTraceRecord::Type type, const void *event, const void *cmdQueue, const void *dependentEvent, int32_t value) {
+    EventTraceRecord traceRecord;
+    traceRecord.timestampNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    traceRecord.event = reinterpret_cast<uintptr_t>(event);
+    traceRecord.cmdQueue = reinterpret_cast<uintptr_t>(cmdQueue);
+    traceRecord.dependentEvent = reinterpret_cast<uintptr_t>(dependentEvent);
+    traceRecord.type = type;
+    traceRecord.value = value;
+
+    if (!getThreadRing().push(traceRecord)) {
+        droppedRecordsCount++;
+    }
+}
+
+EventTraceRecordsRing &EventsTraceRecorder::getThreadRing() {
+    if (threadRingCache.recorderId != recorderId) {
+        if (threadRingCache.ring) {
+            threadRingCache.ring->release();
+        }
+        threadRingCache.ring = acquireRing();
+        threadRingCache.recorderId = recorderId;
+    }
+    return *threadRingCache.ring;
+}
+
+std::shared_ptr<EventTraceRecordsRing> EventsTraceRecorder::acquireRing() {
+    std::lock_guard<std::mutex> lock(ringsMutex);
+    // reuse rings of exited threads, so rings count is bounded by number of concurrently notifying threads
+    for (auto &ring : rings) {
+        if (ring->tryAcquire()) {
+            return ring;
+        }
+    }
+    rings.push_back(std::make_shared<EventTraceRecordsRing>());
+    rings.back()->tryAcquire();
+    return rings.back();
+}
+
+void EventsTraceRecorder::startDrainingThread() {
+    drainingThread = Thread::create(drainRecords, reinterpret_cast<void *>(this));
+}
+
+void EventsTraceRecorder::stopDrainingThread() {
+    {
+        std::lock_guard<std::mutex> lock(wakeupMutex);
+        keepDraining = false;
+    }
+    wakeupCondition.notify_one();
+    if (drainingThread) {
+        drainingThread->join();
+        drainingThread.reset();
+    }
+}
+
+void *EventsTraceRecorder::drainRecords(void *self) {
+    auto recorder = reinterpret_cast<EventsTraceRecorder *>(self);
+    std::unique_lock<std::mutex> lock(recorder->wakeupMutex);
+    while (recorder->keepDraining) {
+        recorder->wakeupCondition.wait_for(lock, std::chrono::milliseconds(drainIntervalMs));
+        lock.unlock();
+        recorder->drain();
+        lock.lock();
+    }
+    return nullptr;
+}
+
+void EventsTraceRecorder::flush() {
+    drain();
+}
+
+void EventsTraceRecorder::drain() {
+    std::lock_guard<std::mutex> drainLock(drainMutex);
+
+    std::vector<EventTraceRecordsRing *> ringsToDrain;
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        ringsToDrain.reserve(rings.size());
+        for (auto &ring : rings) {
+            ringsToDrain.push_back(ring.get());
+        }
+    }
+
+    EventTraceRecord batch[drainBatchSize];
+    for (auto ring : ringsToDrain) {
+        size_t count = 0u;
+        while ((count = ring->pop(batch, drainBatchSize)) != 0u) {
+            if (!headerWritten) {
+                EventsTraceHeader header;
+                writeTraceData(&header, sizeof(header));
+                headerWritten = true;
+            }
+            writeTraceData(batch, count * sizeof(EventTraceRecord));
+        }
+    }
+    if (traceFile) {
+        IoFunctions::fflushPtr(traceFile);
+    }
+}
+
+void EventsTraceRecorder::writeTraceData(const void *data, size_t size) {
+    if (traceFile == nullptr) {
+        auto time = std::chrono::system_clock::now();
+        traceFileName = "eg_trace" + std::to_string(reinterpret_cast<uintptr_t>(this)) + "_" + std::to_string(time.time_since_epoch().count());
+        traceFile = IoFunctions::fopenPtr((traceFileName + ".bin").c_str(), "wb");
+        if (traceFile == nullptr) {
+            return;
+        }
+    }
+    IoFunctions::fwritePtr(data, 1, size, traceFile);
+}
+
+bool EventsTraceRecorder::readTraceData(std::vector<uint8_t> &trace) {
+    if (traceFile == nullptr) {
+        return false;
+    }
+    size_t traceSize = 0u;
+    auto traceData = loadDataFromFile((traceFileName + ".bin").c_str(), traceSize);
+    if (traceData == nullptr) {
+        return false;
+    }
+    trace.assign(reinterpret_cast<const uint8_t *>(traceData.get()), reinterpret_cast<const uint8_t *>(traceData.get()) + traceSize);
+    return true;
+}
+
+void EventsTraceRecorder::writeDotData(const std::string &dot) {
+    writeDataToFile((traceFileName + ".dot").c_str(), dot.c_str(), dot.size());
+}
+
+void EventsTraceRecorder::dumpDot() {
+    std::lock_guard<std::mutex> drainLock(drainMutex);
+    std::vector<uint8_t> trace;
+    if (!readTraceData(trace)) {
+        return;
+    }
+    std::stringstream dot;
+    if (convertToDot({trace.data(), trace.size()}, dot)) {
+        writeDotData(dot.str());
+    }
+}
+
+bool EventsTraceRecorder::convertToDot(ArrayRef<const uint8_t> trace, std::ostream &out) {
+    EventsTraceHeader header;
+    if (trace.size() < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, trace.begin(), sizeof(header));
+    auto recordsDataSize = trace.size() - sizeof(header);
+    if ((header.magic != EventsTraceHeader::traceMagic) || (header.version != EventsTraceHeader::traceVersion) ||
+        (header.recordSize != sizeof(EventTraceRecord)) || (recordsDataSize % sizeof(EventTraceRecord) != 0)) {
+        return false;
+    }
+
+    // records are grouped per thread in file, restore global order
+    std::vector<EventTraceRecord> records(recordsDataSize / sizeof(EventTraceRecord));
+    if (!records.empty()) {
+        memcpy(records.data(), trace.begin() + sizeof(header), recordsDataSize);
+    }
+    std::stable_sort(records.begin(), records.end(), [](const EventTraceRecord &lhs, const EventTraceRecord &rhs) {
+        return lhs.timestampNs < rhs.timestampNs;
+    });
+
+    struct TracedEvent {
+        uint64_t ptr = 0u;
+        uint64_t cmdQueue = 0u;
+        uint32_t cmdType = 0u;
+        int32_t executionStatus = CL_QUEUED;
+        bool destroyed = false;
+    };
+    std::vector<TracedEvent> events;
+    std::vector<std::pair<size_t, size_t>> edges;
+    std::vector<uint64_t> cmdQueues;
+    std::unordered_map<uint64_t, size_t> liveEvents;
+
+    // event addresses may be reused after destruction, so every creation starts new node
+    auto getEventId = [&](uint64_t ptr, bool createIfNotFound) -> int64_t {
+        auto it = liveEvents.find(ptr);
+        if (it != liveEvents.end()) {
+            return static_cast<int64_t>(it->second);
+        }
+        if (!createIfNotFound) {
+            return -1;
+        }
+        events.push_back({});
+        events.back().ptr = ptr;
+        liveEvents[ptr] = events.size() - 1;
+        return static_cast<int64_t>(events.size() - 1);
+    };
+
+    for (auto &traceRecord : records) {
+        switch (traceRecord.type) {
+        case EventTraceRecord::Type::created: {
+            liveEvents.erase(traceRecord.event);
+            auto &tracedEvent = events[getEventId(traceRecord.event, true)];
+            tracedEvent.cmdQueue = traceRecord.cmdQueue;
+            tracedEvent.cmdType = static_cast<uint32_t>(traceRecord.value);
+            if (traceRecord.cmdQueue != 0u && std::find(cmdQueues.begin(), cmdQueues.end(), traceRecord.cmdQueue) == cmdQueues.end()) {
+                cmdQueues.push_back(traceRecord.cmdQueue);
+            }
+            break;
+        }
+        case EventTraceRecord::Type::destroyed: {
+            auto eventId = getEventId(traceRecord.event, false);
+            if (eventId >= 0) {
+                events[eventId].destroyed = true;
+                liveEvents.erase(traceRecord.event);
+            }
+            break;
+        }
+        case EventTraceRecord::Type::statusChanged: {
+            auto eventId = getEventId(traceRecord.event, false);
+            if (eventId >= 0) {
+                events[eventId].executionStatus = traceRecord.value;
+            }
+            break;
+        }
+        case EventTraceRecord::Type::dependencyAdded: {
+            auto parentId = static_cast<size_t>(getEventId(traceRecord.event, true));
+            auto childId = static_cast<size_t>(getEventId(traceRecord.dependentEvent, true));
+            edges.push_back({parentId, childId});
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+
+    static const char *status[] = {
+        "CL_COMPLETE",
+        "CL_RUNNING",
+        "CL_SUBMITTED",
+        "CL_QUEUED",
+        "ABORTED"};
+
+    out << "digraph events_trace {\n";
+    out << "node [shape=record]\n";
+    for (auto cmdQueue : cmdQueues) {
+        out << "cq" << cmdQueue << "[label=\"{------CmdQueue, ptr=0x" << std::hex << cmdQueue << std::dec << "------}\",color=blue];\n";
+    }
+    for (size_t eventId = 0; eventId < events.size(); eventId++) {
+        auto &tracedEvent = events[eventId];
+        bool isUserEvent = (tracedEvent.cmdType == CL_COMMAND_USER);
+
+        // clamp to aborted
+        uint32_t statusId = (tracedEvent.executionStatus < 0) ? (CL_QUEUED + 1) : std::min(static_cast<uint32_t>(tracedEvent.executionStatus), static_cast<uint32_t>(CL_QUEUED));
+        const char *color = ((statusId == CL_COMPLETE) || (statusId > CL_QUEUED)) ? "green" : (((statusId == CL_SUBMITTED) && (isUserEvent == false)) ? "yellow" : "red");
+
+        std::string eventType = isUserEvent ? "USER_EVENT" : "-----EVENT ";
+        std::string commandType = "";
+        if (isUserEvent == false && tracedEvent.cmdType != 0u) {
+            commandType = NEO::cmdTypetoString(tracedEvent.cmdType);
+        }
+
+        out << "e" << eventId << "[label=\"{------" << eventType << " ptr=0x" << std::hex << tracedEvent.ptr << std::dec << "------"
+            << "|" << commandType << "|" << status[statusId]
+            << "|" << (tracedEvent.destroyed ? "RELEASED" : "ALIVE") << "}\",color=" << color << "];\n";
+        if (tracedEvent.cmdQueue != 0u) {
+            out << "cq" << tracedEvent.cmdQueue << "->e" << eventId << ";\n";
+        }
+    }
+    for (auto &edge : edges) {
+        out << "e" << edge.first << "->e" << edge.second << ";\n";
+    }
+    out << "\n}\n";
+    return true;
+}
+
+} // namespace NEO
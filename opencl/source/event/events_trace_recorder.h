@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/arrayref.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace NEO {
+
+class CommandQueue;
+class Event;
+class Thread;
+
+// Fixed size record of single event graph change. Trace file contains EventsTraceHeader followed by records.
+struct EventTraceRecord {
+    enum class Type : uint32_t {
+        created,
+        destroyed,
+        statusChanged,
+        dependencyAdded
+    };
+
+    uint64_t timestampNs = 0u;
+    uint64_t event = 0u;
+    uint64_t cmdQueue = 0u;
+    uint64_t dependentEvent = 0u;
+    Type type = Type::created;
+    int32_t value = 0; // command type for created, execution status for statusChanged
+};
+static_assert(sizeof(EventTraceRecord) == 40u, "EventTraceRecord is part of trace file format");
+
+struct EventsTraceHeader {
+    static constexpr uint32_t traceMagic = 0x52544745; // "EGTR"
+    static constexpr uint32_t traceVersion = 1u;
+
+    uint32_t magic = traceMagic;
+    uint32_t version = traceVersion;
+    uint32_t recordSize = sizeof(EventTraceRecord);
+    uint32_t reserved = 0u;
+};
+
+// Single producer single consumer ring, written only by owning thread and read only by draining side.
+// Ring is released when owning thread exits and may be acquired by another thread, records left in it are still drained.
+class EventTraceRecordsRing : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t capacity = 1024u;
+    static_assert((capacity & (capacity - 1)) == 0, "capacity must be power of 2");
+
+    bool push(const EventTraceRecord &record);
+    size_t pop(EventTraceRecord *outRecords, size_t maxCount);
+
+    bool tryAcquire();
+    void release();
+    bool isAcquired() const { return acquired.load(std::memory_order_acquire); }
+
+  protected:
+    EventTraceRecord records[capacity];
+    alignas(64) std::atomic<uint64_t> writeIndex{0u};
+    alignas(64) std::atomic<uint64_t> readIndex{0u};
+    std::atomic<bool> acquired{false};
+};
+
+// Low overhead alternative to EventsTracker: notifications only append records to per thread rings,
+// background thread drains them to binary file which can be converted to dot format offline or at shutdown.
+// Draining thread is stopped by shutdownEventsTraceRecorder from ClExecutionEnvironment destruction,
+// records notified later are written when recorder is destroyed.
+class EventsTraceRecorder : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t drainBatchSize = 256u;
+    static constexpr uint32_t drainIntervalMs = 10u;
+
+    static EventsTraceRecorder &getEventsTraceRecorder();
+    static void shutdownEventsTraceRecorder();
+    static bool convertToDot(ArrayRef<const uint8_t> trace, std::ostream &out);
+
+    MOCKABLE_VIRTUAL ~EventsTraceRecorder();
+
+    void notifyCreation(const Event *event, const CommandQueue *cmdQueue, uint32_t cmdType);
+    void notifyDestruction(const Event *event);
+    void notifyTransitionedExecutionStatus(const Event *event, int32_t executionStatus);
+    void notifyDependencyAdded(const Event *event, const Event *dependentEvent);
+
+    void flush();
+    void shutdown();
+    uint64_t getDroppedRecordsCount() const { return droppedRecordsCount.load(); }
+
+  protected:
+    EventsTraceRecorder();
+
+    void record(EventTraceRecord::Type type, const void *event, const void *cmdQueue, const void *dependentEvent, int32_t value);
+    EventTraceRecordsRing &getThreadRing();
+    std::shared_ptr<EventTraceRecordsRing> acquireRing();
+    void startDrainingThread();
+    void stopDrainingThread();
+    void drain();
+    static void *drainRecords(void *self);
+
+    void dumpDot();
+
+    MOCKABLE_VIRTUAL void writeTraceData(const void *data, size_t size);
+    MOCKABLE_VIRTUAL bool readTraceData(std::vector<uint8_t> &trace);
+    MOCKABLE_VIRTUAL void writeDotData(const std::string &dot);
+
+    static std::mutex globalRecorderMutex;
+    static std::unique_ptr<EventsTraceRecorder> globalEventsTraceRecorder;
+
+    const uint64_t recorderId;
+
+    std::mutex ringsMutex;
+    // shared with thread local caches, which release rings on thread exit even after recorder is destroyed
+    std::vector<std::shared_ptr<EventTraceRecordsRing>> rings;
+
+    std::mutex drainMutex;
+    bool headerWritten = false;
+    FILE *traceFile = nullptr;
+    std::string traceFileName;
+
+    std::unique_ptr<Thread> drainingThread;
+    std::mutex wakeupMutex;
+    std::condition_variable wakeupCondition;
+    bool keepDraining = true;
+
+    std::atomic<uint64_t> droppedRecordsCount{0u};
+};
+
+} // namespace NEO
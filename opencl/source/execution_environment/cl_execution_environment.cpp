@@ -9,6 +9,7 @@
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 #include "opencl/source/event/async_events_handler.h"
+#include "opencl/source/event/events_trace_recorder.h"
 
 namespace NEO {
 
@@ -22,6 +23,7 @@ AsyncEventsHandler *ClExecutionEnvironment::getAsyncEventsHandler() const {
 
 ClExecutionEnvironment::~ClExecutionEnvironment() {
     asyncEventsHandler->closeThread();
+    EventsTraceRecorder::shutdownEventsTraceRecorder();
 };
 void ClExecutionEnvironment::prepareRootDeviceEnvironments(uint32_t numRootDevices) {
     ExecutionEnvironment::prepareRootDeviceEnvironments(numRootDevices);
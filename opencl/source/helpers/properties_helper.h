@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,6 +47,8 @@ struct TransferProperties {
     MemObj *memObj = nullptr;
     void *ptr = nullptr;
     void *lockedPtr = nullptr;
+    size_t hostPtrRowPitch = 0;
+    size_t hostPtrSlicePitch = 0;
     cl_command_type cmdType = 0;
     cl_map_flags mapFlags = 0;
     uint32_t mipLevel = 0;
@@ -909,6 +909,10 @@ cl_int Kernel::setArg(uint32_t argIndex, size_t argSize, const void *argVal) {
         if (argIndex >= kernelArgHandlers.size()) {
             return CL_INVALID_ARG_INDEX;
         }
+        if (isArgBufferUnchanged(argIndex, argSize, argVal)) {
+            kernelArguments[argIndex].value = argVal;
+            return CL_SUCCESS;
+        }
         argWasUncacheable = kernelArguments[argIndex].isStatelessUncacheable;
         auto argHandler = kernelArgHandlers[argIndex];
         retVal = (this->*argHandler)(argIndex, argSize, argVal);
@@ -1076,12 +1080,40 @@ cl_int Kernel::setArgSvmAlloc(uint32_t argIndex, void *svmPtr, GraphicsAllocatio
 void Kernel::storeKernelArg(uint32_t argIndex, KernelArgType argType, void *argObject,
                             const void *argValue, size_t argSize,
                             GraphicsAllocation *argSvmAlloc, cl_mem_flags argSvmFlags) {
+    auto requiredResidency = isArgRequiringResidency(kernelArguments[argIndex]);
     kernelArguments[argIndex].type = argType;
     kernelArguments[argIndex].object = argObject;
     kernelArguments[argIndex].value = argValue;
     kernelArguments[argIndex].size = argSize;
     kernelArguments[argIndex].svmAllocation = argSvmAlloc;
     kernelArguments[argIndex].svmFlags = argSvmFlags;
+    kernelArguments[argIndex].memObjAllocationsStamp = 0u;
+    if (requiredResidency != isArgRequiringResidency(kernelArguments[argIndex])) {
+        updateArgsRequiringResidency();
+    }
+}
+
+void Kernel::updateArgsRequiringResidency() {
+    argsRequiringResidency.clear();
+    for (uint32_t argIndex = 0; argIndex < static_cast<uint32_t>(kernelArguments.size()); argIndex++) {
+        if (isArgRequiringResidency(kernelArguments[argIndex])) {
+            argsRequiringResidency.push_back(argIndex);
+        }
+    }
+}
+
+bool Kernel::isArgBufferUnchanged(uint32_t argIndex, size_t argSize, const void *argVal) const {
+    const auto &argInfo = kernelArguments[argIndex];
+    if (!argInfo.isPatched || argInfo.type != BUFFER_OBJ || argInfo.memObjAllocationsStamp == 0u ||
+        argSize != sizeof(cl_mem) || argVal == nullptr) {
+        return false;
+    }
+    auto clMemObj = *reinterpret_cast<const cl_mem *>(argVal);
+    if (clMemObj == nullptr || clMemObj != argInfo.object) {
+        return false;
+    }
+    auto buffer = castToObject<Buffer>(clMemObj);
+    return buffer && buffer->getAllocationsStamp() == argInfo.memObjAllocationsStamp;
 }
 
 void Kernel::storeKernelArgAllocIdMemoryManagerCounter(uint32_t argIndex, uint32_t allocIdMemoryManagerCounter) {
@@ -1218,28 +1250,25 @@ uint32_t Kernel::getMaxWorkGroupCount(const cl_uint workDim, const size_t *local
 }
 
 inline void Kernel::makeArgsResident(CommandStreamReceiver &commandStreamReceiver) {
-    auto numArgs = kernelInfo.kernelDescriptor.payloadMappings.explicitArgs.size();
-    for (decltype(numArgs) argIndex = 0; argIndex < numArgs; argIndex++) {
-        if (kernelArguments[argIndex].object) {
-            if (kernelArguments[argIndex].type == SVM_ALLOC_OBJ) {
-                auto pSVMAlloc = (GraphicsAllocation *)kernelArguments[argIndex].object;
-                auto pageFaultManager = executionEnvironment.memoryManager->getPageFaultManager();
-                if (pageFaultManager &&
-                    this->isUnifiedMemorySyncRequired) {
-                    pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(pSVMAlloc->getGpuAddress()));
-                }
-                commandStreamReceiver.makeResident(*pSVMAlloc);
-            } else if (Kernel::isMemObj(kernelArguments[argIndex].type)) {
-                auto clMem = const_cast<cl_mem>(static_cast<const _cl_mem *>(kernelArguments[argIndex].object));
-                auto memObj = castToObjectOrAbort<MemObj>(clMem);
-                auto image = castToObject<Image>(clMem);
-                if (image && image->isImageFromImage()) {
-                    commandStreamReceiver.setSamplerCacheFlushRequired(CommandStreamReceiver::SamplerCacheFlushState::samplerCacheFlushBefore);
-                }
-                commandStreamReceiver.makeResident(*memObj->getGraphicsAllocation(commandStreamReceiver.getRootDeviceIndex()));
-                if (memObj->getMcsAllocation()) {
-                    commandStreamReceiver.makeResident(*memObj->getMcsAllocation());
-                }
+    for (auto argIndex : argsRequiringResidency) {
+        if (kernelArguments[argIndex].type == SVM_ALLOC_OBJ) {
+            auto pSVMAlloc = (GraphicsAllocation *)kernelArguments[argIndex].object;
+            auto pageFaultManager = executionEnvironment.memoryManager->getPageFaultManager();
+            if (pageFaultManager &&
+                this->isUnifiedMemorySyncRequired) {
+                pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(pSVMAlloc->getGpuAddress()));
+            }
+            commandStreamReceiver.makeResident(*pSVMAlloc);
+        } else {
+            auto clMem = const_cast<cl_mem>(static_cast<const _cl_mem *>(kernelArguments[argIndex].object));
+            auto memObj = castToObjectOrAbort<MemObj>(clMem);
+            auto image = castToObject<Image>(clMem);
+            if (image && image->isImageFromImage()) {
+                commandStreamReceiver.setSamplerCacheFlushRequired(CommandStreamReceiver::SamplerCacheFlushState::samplerCacheFlushBefore);
+            }
+            commandStreamReceiver.makeResident(*memObj->getGraphicsAllocation(commandStreamReceiver.getRootDeviceIndex()));
+            if (memObj->getMcsAllocation()) {
+                commandStreamReceiver.makeResident(*memObj->getMcsAllocation());
             }
         }
     }
@@ -1420,6 +1449,9 @@ void Kernel::makeResident(CommandStreamReceiver &commandStreamReceiver) {
 }
 
 void Kernel::getResidency(std::vector<Surface *> &dst) {
+    constexpr size_t maxKernelWideSurfaces = 5u; // private, constant, global, exported functions and isa
+    dst.reserve(dst.size() + maxKernelWideSurfaces + kernelSvmGfxAllocations.size() + argsRequiringResidency.size());
+
     if (privateSurface) {
         GeneralSurface *surface = new GeneralSurface(privateSurface);
         dst.push_back(surface);
@@ -1446,24 +1478,21 @@ void Kernel::getResidency(std::vector<Surface *> &dst) {
         dst.push_back(surface);
     }
 
-    auto numArgs = kernelInfo.kernelDescriptor.payloadMappings.explicitArgs.size();
-    for (decltype(numArgs) argIndex = 0; argIndex < numArgs; argIndex++) {
-        if (kernelArguments[argIndex].object) {
-            if (kernelArguments[argIndex].type == SVM_ALLOC_OBJ) {
-                bool needsMigration = false;
-                auto pageFaultManager = executionEnvironment.memoryManager->getPageFaultManager();
-                if (pageFaultManager &&
-                    this->isUnifiedMemorySyncRequired) {
-                    needsMigration = true;
-                }
-                auto pSVMAlloc = (GraphicsAllocation *)kernelArguments[argIndex].object;
-                dst.push_back(new GeneralSurface(pSVMAlloc, needsMigration));
-            } else if (Kernel::isMemObj(kernelArguments[argIndex].type)) {
-                auto clMem = const_cast<cl_mem>(static_cast<const _cl_mem *>(kernelArguments[argIndex].object));
-                auto memObj = castToObject<MemObj>(clMem);
-                DEBUG_BREAK_IF(memObj == nullptr);
-                dst.push_back(new MemObjSurface(memObj));
+    for (auto argIndex : argsRequiringResidency) {
+        if (kernelArguments[argIndex].type == SVM_ALLOC_OBJ) {
+            bool needsMigration = false;
+            auto pageFaultManager = executionEnvironment.memoryManager->getPageFaultManager();
+            if (pageFaultManager &&
+                this->isUnifiedMemorySyncRequired) {
+                needsMigration = true;
             }
+            auto pSVMAlloc = (GraphicsAllocation *)kernelArguments[argIndex].object;
+            dst.push_back(new GeneralSurface(pSVMAlloc, needsMigration));
+        } else {
+            auto clMem = const_cast<cl_mem>(static_cast<const _cl_mem *>(kernelArguments[argIndex].object));
+            auto memObj = castToObject<MemObj>(clMem);
+            DEBUG_BREAK_IF(memObj == nullptr);
+            dst.push_back(new MemObjSurface(memObj));
         }
     }
 
@@ -1602,6 +1631,11 @@ cl_int Kernel::setArgBuffer(uint32_t argIndex,
 
         kernelArguments[argIndex].isStatelessUncacheable = argAsPtr.isPureStateful() ? false : buffer->isMemObjUncacheable();
 
+        // setting the same buffer again can be skipped, unless its state is programmed differently on every call
+        if (!buffer->peekSharingHandler() && !isAuxTranslationKernel && !debugManager.flags.AddPatchInfoCommentsForAUBDump.get()) {
+            kernelArguments[argIndex].memObjAllocationsStamp = buffer->getAllocationsStamp();
+        }
+
         return CL_SUCCESS;
     } else {
         storeKernelArg(argIndex, BUFFER_OBJ, nullptr, argVal, argSize);
@@ -16,6 +16,7 @@
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/unified_memory/unified_memory.h"
 #include "shared/source/utilities/logger.h"
+#include "shared/source/utilities/stackvec.h"
 
 #include "opencl/extensions/public/cl_ext_private.h"
 #include "opencl/source/cl_device/cl_device.h"
@@ -69,6 +70,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
         KernelArgType type;
         uint32_t allocId;
         uint32_t allocIdMemoryManagerCounter;
+        uint64_t memObjAllocationsStamp = 0u;
         bool isPatched = false;
         bool isStatelessUncacheable = false;
         bool isSetToNullptr = false;
@@ -288,6 +290,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     // residency for kernel surfaces
     MOCKABLE_VIRTUAL void makeResident(CommandStreamReceiver &commandStreamReceiver);
     MOCKABLE_VIRTUAL void getResidency(std::vector<Surface *> &dst);
+    const StackVec<uint32_t, 16> &getArgsRequiringResidency() const { return argsRequiringResidency; }
     void resetSharedObjectsPatchAddresses();
     bool isUsingSharedObjArgs() const { return usingSharedObjArgs; }
     bool hasUncacheableStatelessArgs() const { return statelessUncacheableArgsCount > 0; }
@@ -445,6 +448,11 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     Kernel(Program *programArg, const KernelInfo &kernelInfo, ClDevice &clDevice);
 
     void makeArgsResident(CommandStreamReceiver &commandStreamReceiver);
+    static bool isArgRequiringResidency(const SimpleKernelArgInfo &argInfo) {
+        return argInfo.object && (argInfo.type == SVM_ALLOC_OBJ || Kernel::isMemObj(argInfo.type));
+    }
+    void updateArgsRequiringResidency();
+    bool isArgBufferUnchanged(uint32_t argIndex, size_t argSize, const void *argVal) const;
 
     void *patchBufferOffset(const ArgDescPointer &argAsPtr, void *svmPtr, GraphicsAllocation *svmAlloc);
 
@@ -478,6 +486,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     std::unordered_map<KernelConfig, KernelSubmissionData, KernelConfigHash> kernelSubmissionMap;
 
     std::vector<SimpleKernelArgInfo> kernelArguments;
+    StackVec<uint32_t, 16> argsRequiringResidency; // indices of args with svm or mem obj set, updated by storeKernelArg
     std::vector<KernelArgHandler> kernelArgHandlers;
     std::vector<GraphicsAllocation *> kernelSvmGfxAllocations;
     std::vector<GraphicsAllocation *> kernelUnifiedMemoryGfxAllocations;
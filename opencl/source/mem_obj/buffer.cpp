@@ -24,6 +24,7 @@
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/migration_sync_data.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/cpu_memory_copy.h"
 
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/command_queue/command_queue.h"
@@ -733,19 +734,19 @@ bool Buffer::bufferRectPitchSet(const size_t *bufferOrigin,
     return true;
 }
 
-void Buffer::transferData(void *dst, void *src, size_t copySize, size_t copyOffset) {
+void Buffer::transferData(void *dst, void *src, size_t copySize, size_t copyOffset, bool dstReadByCpu) {
     DBG_LOG(LogMemoryObject, __FUNCTION__, " hostPtr: ", hostPtr, ", size: ", copySize, ", offset: ", copyOffset, ", memoryStorage: ", memoryStorage);
     auto dstPtr = ptrOffset(dst, copyOffset);
     auto srcPtr = ptrOffset(src, copyOffset);
-    memcpy_s(dstPtr, copySize, srcPtr, copySize);
+    CpuMemoryCopy::copy(dstPtr, srcPtr, copySize, dstReadByCpu);
 }
 
 void Buffer::transferDataToHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) {
-    transferData(hostPtr, memoryStorage, copySize[0], copyOffset[0]);
+    transferData(hostPtr, memoryStorage, copySize[0], copyOffset[0], true);
 }
 
 void Buffer::transferDataFromHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) {
-    transferData(memoryStorage, hostPtr, copySize[0], copyOffset[0]);
+    transferData(memoryStorage, hostPtr, copySize[0], copyOffset[0], false);
 }
 
 size_t Buffer::calculateHostPtrSize(const size_t *origin, const size_t *region, size_t rowPitch, size_t slicePitch) {
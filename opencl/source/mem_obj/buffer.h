@@ -211,7 +211,7 @@ class Buffer : public MemObj {
                                                                             bool &compressionEnabled, bool localMemoryEnabled);
     static bool isReadOnlyMemoryPermittedByFlags(const MemoryProperties &properties);
 
-    void transferData(void *dst, void *src, size_t copySize, size_t copyOffset);
+    void transferData(void *dst, void *src, size_t copySize, size_t copyOffset, bool dstReadByCpu);
 
     void appendSurfaceStateArgs(EncodeSurfaceStateArgs &args);
 };
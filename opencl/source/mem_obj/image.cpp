@@ -325,6 +325,7 @@ Image *Image::create(Context *context,
         auto allocationInSystemMemory = MemoryPoolHelper::isSystemMemoryPool(memory->getMemoryPool());
         bool isCpuTransferPreferred = imgInfo.linearStorage && defaultGfxCoreHelper.isCpuImageTransferPreferred(defaultHwInfo);
         bool isCpuTransferPreferredInSystemMemory = imgInfo.linearStorage && allocationInSystemMemory;
+        bool isCpuTiledTransferPreferred = !imgInfo.linearStorage && image->isCpuTiledTransferPreferred(defaultRootDeviceIndex);
 
         if (isCpuTransferPreferredInSystemMemory) {
             void *pDestinationAddress = memory->getUnderlyingBuffer();
@@ -340,13 +341,21 @@ Image *Image::create(Context *context,
             context->getMemoryManager()->unlockResource(memory);
 
         } else {
-            auto cmdQ = context->getSpecialQueue(defaultRootDeviceIndex);
-            if (isNV12Image(&image->getImageFormat())) {
-                errcodeRet = image->writeNV12Planes(hostPtr, hostPtrRowPitch, defaultRootDeviceIndex);
-            } else {
-                errcodeRet = cmdQ->enqueueWriteImage(image, CL_TRUE, &copyOrigin[0], &copyRegion[0],
-                                                     hostPtrRowPitch, hostPtrSlicePitch,
-                                                     hostPtr, image->getMapAllocation(defaultRootDeviceIndex), 0, nullptr, nullptr);
+            bool isCpuTiledTransferDone = false;
+            if (isCpuTiledTransferPreferred) {
+                isCpuTiledTransferDone = image->writeTiledImageOnCpu(hostPtr, hostPtrRowPitch, hostPtrSlicePitch, &copyOrigin[0], &copyRegion[0], defaultRootDeviceIndex);
+            }
+
+            // GPU copy is also fallback when tiled image couldn't be written on CPU
+            if (!isCpuTiledTransferDone) {
+                auto cmdQ = context->getSpecialQueue(defaultRootDeviceIndex);
+                if (isNV12Image(&image->getImageFormat())) {
+                    errcodeRet = image->writeNV12Planes(hostPtr, hostPtrRowPitch, defaultRootDeviceIndex);
+                } else {
+                    errcodeRet = cmdQ->enqueueWriteImage(image, CL_TRUE, &copyOrigin[0], &copyRegion[0],
+                                                         hostPtrRowPitch, hostPtrSlicePitch,
+                                                         hostPtr, image->getMapAllocation(defaultRootDeviceIndex), 0, nullptr, nullptr);
+                }
             }
         }
         auto migrationSyncData = image->getMultiGraphicsAllocation().getMigrationSyncData();
@@ -941,6 +950,47 @@ Image *Image::redescribe() {
     return image;
 }
 
+bool Image::isCpuTiledTransferPreferred(uint32_t rootDeviceIndex) const {
+    size_t maxSize = MemoryConstants::megaByte;
+    if (debugManager.flags.CpuTiledImageTransferMaxSize.get() != -1) {
+        maxSize = static_cast<size_t>(debugManager.flags.CpuTiledImageTransferMaxSize.get()) * MemoryConstants::kiloByte;
+    }
+
+    auto allocation = getGraphicsAllocation(rootDeviceIndex);
+    auto gmm = allocation->getDefaultGmm();
+    if (gmm == nullptr || gmm->isCompressionEnabled() || !allocation->isAllocationLockable() ||
+        !MemoryPoolHelper::isSystemMemoryPool(allocation->getMemoryPool()) || !isTiledAllocation()) {
+        return false;
+    }
+
+    // setup cost of GPU copy dominates only for small images, planar formats need per plane copies,
+    // images created from other image share its GMM resource which may describe different format
+    return allocation->getUnderlyingBufferSize() <= maxSize &&
+           !isImage1d(imageDesc) &&
+           !isImageFromImage() &&
+           !isMipMapped(this) &&
+           !isNV12Image(&imageFormat) &&
+           imageDesc.num_samples <= 1;
+}
+
+bool Image::writeTiledImageOnCpu(const void *hostPtr, size_t hostPtrRowPitch, size_t hostPtrSlicePitch, const size_t *origin, const size_t *region, uint32_t rootDeviceIndex) {
+    auto allocation = getGraphicsAllocation(rootDeviceIndex);
+    auto memoryManager = context->getMemoryManager();
+
+    auto gpuPtr = memoryManager->lockResource(allocation);
+    if (gpuPtr == nullptr) {
+        return false;
+    }
+
+    // GMM swizzles linear host data into tiled layout of the resource
+    auto result = allocation->getDefaultGmm()->resourceCopyBltRegion(const_cast<void *>(hostPtr), gpuPtr,
+                                                                       static_cast<uint32_t>(hostPtrRowPitch), static_cast<uint32_t>(hostPtrSlicePitch),
+                                                                       static_cast<uint32_t>(surfaceFormatInfo.surfaceFormat.imageElementSizeInBytes),
+                                                                       origin, region, 1u);
+    memoryManager->unlockResource(allocation);
+    return result != 0;
+}
+
 void Image::transferDataToHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) {
     transferData(hostPtr, hostPtrRowPitch, hostPtrSlicePitch,
                  memoryStorage, imageDesc.image_row_pitch, imageDesc.image_slice_pitch,
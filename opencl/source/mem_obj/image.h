@@ -188,6 +188,8 @@ class Image : public MemObj {
     static cl_int validateRegionAndOrigin(const size_t *origin, const size_t *region, const cl_image_desc &imgDesc);
 
     cl_int writeNV12Planes(const void *hostPtr, size_t hostPtrRowPitch, uint32_t rootDeviceIndex);
+    bool isCpuTiledTransferPreferred(uint32_t rootDeviceIndex) const;
+    bool writeTiledImageOnCpu(const void *hostPtr, size_t hostPtrRowPitch, size_t hostPtrSlicePitch, const size_t *origin, const size_t *region, uint32_t rootDeviceIndex);
     void setMcsSurfaceInfo(const McsSurfaceInfo &info) { mcsSurfaceInfo = info; }
     const McsSurfaceInfo &getMcsSurfaceInfo() { return mcsSurfaceInfo; }
     void setPlane(const GMM_YUV_PLANE_ENUM plane) { this->plane = plane; }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,8 @@
 
 #include "shared/source/helpers/ptr_math.h"
 
+#include <algorithm>
+
 using namespace NEO;
 
 size_t MapOperationsHandler::size() const {
@@ -26,10 +28,16 @@ bool MapOperationsHandler::add(void *ptr, size_t ptrLength, cl_map_flags &mapFla
         return false;
     }
 
-    mappedPointers.push_back(mapInfo);
+    mappedPointers.emplace(reinterpret_cast<uintptr_t>(ptr), mapInfo);
+    maxMappedPtrLength = std::max(maxMappedPtrLength, ptrLength);
     return true;
 }
 
+MapOperationsHandler::MappedPointers::iterator MapOperationsHandler::lowerBoundForAddress(uintptr_t address) {
+    auto lowestStartAddress = (address > maxMappedPtrLength) ? (address - maxMappedPtrLength) : 0u;
+    return mappedPointers.lower_bound(lowestStartAddress);
+}
+
 bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
     if (inputMapInfo.readOnly) {
         return false;
@@ -37,9 +45,10 @@ bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
     auto inputStartPtr = inputMapInfo.ptr;
     auto inputEndPtr = ptrOffset(inputStartPtr, inputMapInfo.ptrLength);
 
-    for (auto &mapInfo : mappedPointers) {
-        auto mappedStartPtr = mapInfo.ptr;
-        auto mappedEndPtr = ptrOffset(mappedStartPtr, mapInfo.ptrLength);
+    auto endIt = mappedPointers.upper_bound(reinterpret_cast<uintptr_t>(inputEndPtr));
+    for (auto it = lowerBoundForAddress(reinterpret_cast<uintptr_t>(inputStartPtr)); it != endIt; it++) {
+        auto mappedStartPtr = it->second.ptr;
+        auto mappedEndPtr = ptrOffset(mappedStartPtr, it->second.ptrLength);
 
         // Requested ptr starts before or inside existing ptr range and overlapping end
         if (inputStartPtr < mappedEndPtr && inputEndPtr >= mappedStartPtr) {
@@ -52,24 +61,24 @@ bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
 bool MapOperationsHandler::find(void *mappedPtr, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        if (mapInfo.ptr == mappedPtr) {
-            outMapInfo = mapInfo;
-            return true;
-        }
+    auto it = mappedPointers.lower_bound(reinterpret_cast<uintptr_t>(mappedPtr));
+    if (it == mappedPointers.end() || it->second.ptr != mappedPtr) {
+        return false;
     }
-    return false;
+    outMapInfo = it->second;
+    return true;
 }
 
 bool NEO::MapOperationsHandler::findInfoForHostPtr(const void *ptr, size_t size, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        void *ptrStart = mapInfo.ptr;
-        void *ptrEnd = ptrOffset(mapInfo.ptr, mapInfo.ptrLength);
+    auto endIt = mappedPointers.upper_bound(reinterpret_cast<uintptr_t>(ptr));
+    for (auto it = lowerBoundForAddress(reinterpret_cast<uintptr_t>(ptr)); it != endIt; it++) {
+        void *ptrStart = it->second.ptr;
+        void *ptrEnd = ptrOffset(it->second.ptr, it->second.ptrLength);
 
         if (ptrStart <= ptr && ptrOffset(ptr, size) <= ptrEnd) {
-            outMapInfo = mapInfo;
+            outMapInfo = it->second;
             return true;
         }
     }
@@ -79,25 +88,32 @@ bool NEO::MapOperationsHandler::findInfoForHostPtr(const void *ptr, size_t size,
 void MapOperationsHandler::remove(void *mappedPtr) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    auto endIter = mappedPointers.end();
-    for (auto it = mappedPointers.begin(); it != endIter; it++) {
-        if (it->ptr == mappedPtr) {
-            std::iter_swap(it, mappedPointers.end() - 1);
-            mappedPointers.pop_back();
-            break;
-        }
+    auto it = mappedPointers.lower_bound(reinterpret_cast<uintptr_t>(mappedPtr));
+    if (it != mappedPointers.end() && it->second.ptr == mappedPtr) {
+        mappedPointers.erase(it);
+    }
+    if (mappedPointers.empty()) {
+        maxMappedPtrLength = 0u;
     }
 }
 
+NEO::MapOperationsStorage::Shard &NEO::MapOperationsStorage::getShard(cl_mem memObj) {
+    // memory objects are heap allocated, so low address bits carry no entropy
+    auto address = reinterpret_cast<uintptr_t>(memObj);
+    return shards[(address ^ (address >> 6) ^ (address >> 12)) % shardsCount];
+}
+
 MapOperationsHandler &NEO::MapOperationsStorage::getHandler(cl_mem memObj) {
-    std::lock_guard<std::mutex> lock(mutex);
-    return handlers[memObj];
+    auto &shard = getShard(memObj);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.handlers[memObj];
 }
 
 MapOperationsHandler *NEO::MapOperationsStorage::getHandlerIfExists(cl_mem memObj) {
-    std::lock_guard<std::mutex> lock(mutex);
-    auto iterator = handlers.find(memObj);
-    if (iterator == handlers.end()) {
+    auto &shard = getShard(memObj);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto iterator = shard.handlers.find(memObj);
+    if (iterator == shard.handlers.end()) {
         return nullptr;
     }
 
@@ -105,17 +121,20 @@ MapOperationsHandler *NEO::MapOperationsStorage::getHandlerIfExists(cl_mem memOb
 }
 
 bool NEO::MapOperationsStorage::getInfoForHostPtr(const void *ptr, size_t size, MapInfo &outInfo) {
-    std::lock_guard<std::mutex> lock(mutex);
-    for (auto &entry : handlers) {
-        if (entry.second.findInfoForHostPtr(ptr, size, outInfo)) {
-            return true;
+    for (auto &shard : shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto &entry : shard.handlers) {
+            if (entry.second.findInfoForHostPtr(ptr, size, outInfo)) {
+                return true;
+            }
         }
     }
     return false;
 }
 
 void NEO::MapOperationsStorage::removeHandler(cl_mem memObj) {
-    std::lock_guard<std::mutex> lock(mutex);
-    auto iterator = handlers.find(memObj);
-    handlers.erase(iterator);
+    auto &shard = getShard(memObj);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto iterator = shard.handlers.find(memObj);
+    shard.handlers.erase(iterator);
 }
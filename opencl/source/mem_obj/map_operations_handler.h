@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,9 @@
 #pragma once
 #include "opencl/source/helpers/properties_helper.h"
 
+#include <array>
+#include <cstdint>
+#include <map>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
@@ -25,8 +28,15 @@ class MapOperationsHandler {
     size_t size() const;
 
   protected:
+    using MappedPointers = std::multimap<uintptr_t, MapInfo>;
+
     bool isOverlapping(MapInfo &inputMapInfo);
-    std::vector<MapInfo> mappedPointers;
+    // returns first mapping which may contain addresses starting from given address
+    MappedPointers::iterator lowerBoundForAddress(uintptr_t address);
+
+    // sorted by start address, mapping may start at most maxMappedPtrLength bytes before address it contains
+    MappedPointers mappedPointers;
+    size_t maxMappedPtrLength = 0u;
     mutable std::mutex mtx;
 };
 
@@ -40,8 +50,15 @@ class MapOperationsStorage {
     void removeHandler(cl_mem memObj);
 
   protected:
-    std::mutex mutex;
-    HandlersMap handlers{};
+    struct Shard {
+        std::mutex mutex;
+        HandlersMap handlers{};
+    };
+    static constexpr size_t shardsCount = 16u;
+
+    Shard &getShard(cl_mem memObj);
+
+    std::array<Shard, shardsCount> shards;
 };
 
 } // namespace NEO
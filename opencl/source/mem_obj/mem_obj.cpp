@@ -24,6 +24,7 @@
 #include "opencl/source/sharings/sharing.h"
 
 #include <algorithm>
+#include <atomic>
 
 namespace NEO {
 
@@ -294,12 +295,19 @@ void MemObj::resetGraphicsAllocation(GraphicsAllocation *newGraphicsAllocation)
     TakeOwnershipWrapper<MemObj> lock(*this);
     checkUsageAndReleaseOldAllocation(newGraphicsAllocation->getRootDeviceIndex());
     multiGraphicsAllocation.addAllocation(newGraphicsAllocation);
+    allocationsStamp = obtainAllocationsStamp();
 }
 
 void MemObj::removeGraphicsAllocation(uint32_t rootDeviceIndex) {
     TakeOwnershipWrapper<MemObj> lock(*this);
     checkUsageAndReleaseOldAllocation(rootDeviceIndex);
     multiGraphicsAllocation.removeAllocation(rootDeviceIndex);
+    allocationsStamp = obtainAllocationsStamp();
+}
+
+uint64_t MemObj::obtainAllocationsStamp() {
+    static std::atomic<uint64_t> lastAllocationsStamp{0u};
+    return ++lastAllocationsStamp;
 }
 
 bool MemObj::readMemObjFlagsInvalid() {
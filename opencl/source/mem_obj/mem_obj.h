@@ -138,6 +138,8 @@ class MemObj : public BaseObject<_cl_mem> {
     size_t calculateMappedPtrLength(const MemObjSizeArray &size) const { return calculateOffsetForMapping(size); }
     cl_mem_object_type peekClMemObjType() const { return memObjectType; }
     size_t getOffset() const { return offset; }
+    // unique across memory objects, changes whenever graphics allocations of this object are replaced
+    uint64_t getAllocationsStamp() const { return allocationsStamp; }
     MemoryManager *getMemoryManager() const {
         return memoryManager;
     }
@@ -172,6 +174,7 @@ class MemObj : public BaseObject<_cl_mem> {
     void getOsSpecificMemObjectInfo(const cl_mem_info &paramName, size_t *srcParamSize, void **srcParam);
     void storeProperties(const cl_mem_properties *properties);
     void checkUsageAndReleaseOldAllocation(uint32_t rootDeviceIndex);
+    static uint64_t obtainAllocationsStamp();
 
     Context *context;
     cl_mem_object_type memObjectType;
@@ -198,6 +201,7 @@ class MemObj : public BaseObject<_cl_mem> {
     MultiGraphicsAllocation mapAllocations;
     std::shared_ptr<SharingHandler> sharingHandler;
     std::vector<uint64_t> propertiesVector;
+    uint64_t allocationsStamp = obtainAllocationsStamp();
 
     MemObjDestructorCallbacks destructorCallbacks;
 };
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/external_functions.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
@@ -12,6 +13,7 @@
 #include "shared/source/device_binary_format/zebin/zebin_decoder.h"
 #include "shared/source/device_binary_format/zebin/zeinfo_decoder.h"
 #include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/compiler_product_helper.h"
 #include "shared/source/helpers/debug_helpers.h"
@@ -223,6 +225,9 @@ cl_int Program::processGenBinary(const ClDevice &clDevice) {
         SingleDeviceBinary binary = {};
         binary.deviceBinary = blob;
         binary.targetDevice = NEO::getTargetDevice(clDevice.getRootDeviceEnvironment());
+        if (auto compilerInterface = clDevice.getRootDeviceEnvironment().compilerInterface.get()) {
+            binary.decodedMetadataCache = compilerInterface->getEnabledCache();
+        }
 
         auto &gfxCoreHelper = clDevice.getGfxCoreHelper();
         std::tie(decodedSingleDeviceBinary.decodeError, std::ignore) = NEO::decodeSingleDeviceBinary(decodedSingleDeviceBinary.programInfo, binary, decodedSingleDeviceBinary.decodeErrors, decodedSingleDeviceBinary.decodeWarnings, gfxCoreHelper);
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+#include "opencl/source/mem_obj/image.h"
+#include "opencl/test/unit_test/aub_tests/command_stream/aub_command_stream_fixture.h"
+#include "opencl/test/unit_test/command_queue/command_enqueue_fixture.h"
+
+#include <memory>
+#include <vector>
+
+using namespace NEO;
+
+// Images written on CPU with GMM CPU blit are read back with GPU and compared with the same data written with GPU copy
+struct AUBCpuTiledImageTransfer
+    : public AUBCommandStreamFixture,
+      public ::testing::TestWithParam<uint32_t /*cl_mem_object_type*/> {
+    typedef AUBCommandStreamFixture CommandStreamFixture;
+
+    using AUBCommandStreamFixture::setUp;
+
+    static constexpr size_t width = 17;
+    static constexpr size_t height = 13;
+    static constexpr size_t elementSize = 4; // sizeof CL_RGBA * CL_UNSIGNED_INT8
+
+    void SetUp() override {
+        if (!(defaultHwInfo->capabilityTable.supportsImages)) {
+            GTEST_SKIP();
+        }
+        CommandStreamFixture::setUp();
+
+        imageFormat.image_channel_data_type = CL_UNSIGNED_INT8;
+        imageFormat.image_channel_order = CL_RGBA;
+
+        imageDesc.image_type = GetParam();
+        imageDesc.image_width = width;
+        imageDesc.image_height = height;
+        if (imageDesc.image_type == CL_MEM_OBJECT_IMAGE3D) {
+            imageDesc.image_depth = 5;
+            slices = 5;
+        } else if (imageDesc.image_type == CL_MEM_OBJECT_IMAGE2D_ARRAY) {
+            imageDesc.image_array_size = 5;
+            slices = 5;
+        }
+
+        hostMemory.resize(width * height * slices * elementSize);
+        for (size_t i = 0; i < hostMemory.size(); i++) {
+            hostMemory[i] = static_cast<uint8_t>(i * 7 + 3);
+        }
+    }
+
+    void TearDown() override {
+        CommandStreamFixture::tearDown();
+    }
+
+    Image *createImage(cl_mem_flags flags, void *hostPtr) {
+        cl_int retVal = CL_SUCCESS;
+        auto surfaceFormat = Image::getSurfaceFormatFromTable(flags, &imageFormat, context->getDevice(0)->getHardwareInfo().capabilityTable.supportsOcl21Features);
+        auto image = Image::create(context, ClMemoryPropertiesHelper::createMemoryProperties(flags, 0, 0, &context->getDevice(0)->getDevice()),
+                                   flags, 0, surfaceFormat, &imageDesc, hostPtr, retVal);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        return image;
+    }
+
+    template <typename FamilyType>
+    void expectImageContents(Image *image, const std::vector<uint8_t> &expectedMemory) {
+        std::vector<uint8_t> readMemory(expectedMemory.size());
+        size_t imgOrigin[] = {0, 0, 0};
+        size_t imgRegion[] = {width, height, slices};
+        auto retVal = pCmdQ->enqueueReadImage(image, CL_TRUE, imgOrigin, imgRegion, 0, 0, readMemory.data(), nullptr, 0, nullptr, nullptr);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+
+        retVal = pCmdQ->finish();
+        EXPECT_EQ(CL_SUCCESS, retVal);
+
+        AUBCommandStreamFixture::expectMemory<FamilyType>(readMemory.data(), expectedMemory.data(), expectedMemory.size());
+    }
+
+    uint32_t getRootDeviceIndex() {
+        return context->getDevice(0)->getRootDeviceIndex();
+    }
+
+    DebugManagerStateRestore restorer;
+    cl_image_format imageFormat = {};
+    cl_image_desc imageDesc = {};
+    size_t slices = 1;
+    std::vector<uint8_t> hostMemory;
+};
+
+HWTEST_P(AUBCpuTiledImageTransfer, givenImageCreatedWithCopyHostPtrOnCpuWhenReadingImageThenContentsMatchImageCreatedWithGpuCopy) {
+    debugManager.flags.CpuTiledImageTransferMaxSize.set(0);
+    std::unique_ptr<Image> gpuWrittenImage(createImage(CL_MEM_COPY_HOST_PTR, hostMemory.data()));
+    ASSERT_NE(nullptr, gpuWrittenImage);
+
+    debugManager.flags.CpuTiledImageTransferMaxSize.set(-1);
+    std::unique_ptr<Image> cpuWrittenImage(createImage(CL_MEM_COPY_HOST_PTR, hostMemory.data()));
+    ASSERT_NE(nullptr, cpuWrittenImage);
+    if (!cpuWrittenImage->isCpuTiledTransferPreferred(getRootDeviceIndex())) {
+        GTEST_SKIP();
+    }
+
+    expectImageContents<FamilyType>(gpuWrittenImage.get(), hostMemory);
+    expectImageContents<FamilyType>(cpuWrittenImage.get(), hostMemory);
+}
+
+HWTEST_P(AUBCpuTiledImageTransfer, givenRegionWrittenOnCpuWhenReadingImageThenContentsMatchRegionWrittenWithGpuCopy) {
+    const size_t origin[] = {1, 2, slices > 1 ? 1u : 0u};
+    const size_t region[] = {width - 3, height - 4, slices > 1 ? slices - 2 : 1u};
+    const size_t inputRowPitch = region[0] * elementSize;
+    const size_t inputSlicePitch = inputRowPitch * region[1];
+
+    std::vector<uint8_t> expectedMemory(hostMemory.size(), 0xFF);
+    for (size_t z = 0; z < region[2]; z++) {
+        for (size_t y = 0; y < region[1]; y++) {
+            auto dstOffset = (((z + origin[2]) * height + y + origin[1]) * width + origin[0]) * elementSize;
+            memcpy(&expectedMemory[dstOffset], &hostMemory[z * inputSlicePitch + y * inputRowPitch], inputRowPitch);
+        }
+    }
+
+    for (int32_t cpuCopyOnWriteImage : {0, 1}) {
+        debugManager.flags.DoCpuCopyOnWriteImage.set(cpuCopyOnWriteImage);
+        std::unique_ptr<Image> image(createImage(CL_MEM_READ_WRITE, nullptr));
+        ASSERT_NE(nullptr, image);
+        if (cpuCopyOnWriteImage == 1 && !image->isCpuTiledTransferPreferred(getRootDeviceIndex())) {
+            GTEST_SKIP();
+        }
+        memset(image->getCpuAddress(), 0xFF, image->getSize());
+
+        auto retVal = pCmdQ->enqueueWriteImage(image.get(), CL_TRUE, origin, region, inputRowPitch, inputSlicePitch,
+                                               hostMemory.data(), nullptr, 0, nullptr, nullptr);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+
+        expectImageContents<FamilyType>(image.get(), expectedMemory);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    AUBCpuTiledImageTransfer_,
+    AUBCpuTiledImageTransfer,
+    ::testing::Values(CL_MEM_OBJECT_IMAGE2D, CL_MEM_OBJECT_IMAGE2D_ARRAY, CL_MEM_OBJECT_IMAGE3D));
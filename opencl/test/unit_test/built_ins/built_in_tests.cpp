@@ -876,6 +876,73 @@ TEST_F(BuiltInTests, GivenCopyBufferToBufferWhenDispatchInfoIsCreatedThenSizeIsA
     EXPECT_TRUE(compareBuiltinOpParams(multiDispatchInfo.peekBuiltinOpParams(), builtinOpsParams));
 }
 
+TEST_F(BuiltInTests, givenCopyBufferToBufferWithSameGeometryWhenDispatchInfoIsCreatedAgainThenCachedWorkSizesAreReusedAndArgsAreUpdated) {
+    BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::copyBufferToBuffer, *pClDevice);
+    const auto initialCacheSize = builder.peekBakedDispatchInfosCacheSize();
+
+    AlignedBuffer src;
+    AlignedBuffer dst;
+
+    BuiltinOpParams builtinOpsParams;
+    builtinOpsParams.srcMemObj = &src;
+    builtinOpsParams.dstMemObj = &dst;
+    builtinOpsParams.size = {src.getSize() / 2, 0, 0};
+
+    MultiDispatchInfo firstMultiDispatchInfo(builtinOpsParams);
+    ASSERT_TRUE(builder.buildDispatchInfos(firstMultiDispatchInfo));
+    EXPECT_EQ(initialCacheSize + 1, builder.peekBakedDispatchInfosCacheSize());
+
+    builtinOpsParams.srcOffset.x = 4;
+    MultiDispatchInfo secondMultiDispatchInfo(builtinOpsParams);
+    ASSERT_TRUE(builder.buildDispatchInfos(secondMultiDispatchInfo));
+    EXPECT_EQ(initialCacheSize + 1, builder.peekBakedDispatchInfosCacheSize());
+
+    ASSERT_EQ(firstMultiDispatchInfo.size(), secondMultiDispatchInfo.size());
+    for (size_t i = 0; i < firstMultiDispatchInfo.size(); i++) {
+        const auto &first = *(firstMultiDispatchInfo.begin() + i);
+        const auto &second = *(secondMultiDispatchInfo.begin() + i);
+        EXPECT_EQ(first.getKernel(), second.getKernel());
+        EXPECT_EQ(&first.getClDevice(), &second.getClDevice());
+        EXPECT_EQ(first.getDim(), second.getDim());
+        EXPECT_EQ(first.getGWS(), second.getGWS());
+        EXPECT_EQ(first.getLocalWorkgroupSize(), second.getLocalWorkgroupSize());
+        EXPECT_EQ(first.getTotalNumberOfWorkgroups(), second.getTotalNumberOfWorkgroups());
+        EXPECT_EQ(first.getNumberOfWorkgroups(), second.getNumberOfWorkgroups());
+    }
+
+    const Kernel *kernel = secondMultiDispatchInfo.begin()->getKernel();
+    const auto crossThreadOffset = kernel->getKernelInfo().getArgDescriptorAt(2).as<ArgDescValue>().elements[0].offset;
+    EXPECT_EQ(4u, *reinterpret_cast<const uint32_t *>(ptrOffset(kernel->getCrossThreadData(), crossThreadOffset)));
+
+    builtinOpsParams.size.x += MemoryConstants::cacheLineSize;
+    MultiDispatchInfo thirdMultiDispatchInfo(builtinOpsParams);
+    ASSERT_TRUE(builder.buildDispatchInfos(thirdMultiDispatchInfo));
+    EXPECT_EQ(initialCacheSize + 2, builder.peekBakedDispatchInfosCacheSize());
+}
+
+TEST_F(BuiltInTests, givenBuiltinDispatchInfoCacheDisabledWhenDispatchInfoIsCreatedThenWorkSizesAreNotCached) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBuiltinDispatchInfoCache.set(0);
+
+    BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::fillBuffer, *pClDevice);
+    const auto initialCacheSize = builder.peekBakedDispatchInfosCacheSize();
+
+    AlignedBuffer src;
+    AlignedBuffer dst;
+
+    BuiltinOpParams builtinOpsParams;
+    builtinOpsParams.srcMemObj = &src;
+    builtinOpsParams.dstMemObj = &dst;
+    builtinOpsParams.size = {dst.getSize(), 0, 0};
+
+    for (int i = 0; i < 2; i++) {
+        MultiDispatchInfo multiDispatchInfo(builtinOpsParams);
+        ASSERT_TRUE(builder.buildDispatchInfos(multiDispatchInfo));
+        EXPECT_EQ(1u, multiDispatchInfo.size());
+        EXPECT_EQ(initialCacheSize, builder.peekBakedDispatchInfosCacheSize());
+    }
+}
+
 TEST_F(BuiltInTests, givenBigOffsetAndSizeWhenBuilderCopyBufferToBufferStatelessIsUsedThenParamsAreCorrect) {
 
     if (is32bit) {
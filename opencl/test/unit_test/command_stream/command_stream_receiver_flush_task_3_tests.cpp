@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,6 +20,7 @@
 #include "shared/test/common/mocks/mock_submissions_aggregator.h"
 #include "shared/test/common/mocks/mock_svm_manager.h"
 #include "shared/test/common/test_macros/hw_test.h"
+#include "shared/test/unit_test/direct_submission/direct_submission_controller_mock.h"
 
 #include "opencl/source/helpers/hardware_commands_helper.h"
 #include "opencl/source/helpers/task_information.h"
@@ -2092,3 +2093,39 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenWaitForCompletionWithTimeoutI
     mockCsr.submissionAggregator->recordCommandBuffer(cmdBuffer.release());
     EXPECT_EQ(NEO::WaitStatus::notReady, mockCsr.waitForCompletionWithTimeout(WaitParams{false, false, 0}, 1));
 }
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenRingStoppedByDirectSubmissionControllerWhenBatchedSubmissionsAreFlushedThenControllerIsNotifiedAndStopsRingAgainAfterTimeout) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.overrideDispatchPolicy(DispatchMode::batchedDispatch);
+    commandStreamReceiver.useNewResourceImplicitFlush = false;
+    commandStreamReceiver.useGpuIdleImplicitFlush = false;
+    commandStreamReceiver.callBaseStopDirectSubmission = false;
+
+    auto controller = new DirectSubmissionControllerMock();
+    pDevice->executionEnvironment->directSubmissionController.reset(controller);
+    controller->registerDirectSubmission(&commandStreamReceiver);
+    controller->checkNewSubmissions();
+    controller->cpuTimestamp += controller->timeout;
+    controller->checkNewSubmissions();
+    EXPECT_TRUE(controller->directSubmissions[&commandStreamReceiver].isStopped);
+    commandStreamReceiver.stopDirectSubmissionCalled = false;
+
+    flushTask(commandStreamReceiver);
+    EXPECT_FALSE(commandStreamReceiver.submissionAggregator->peekCmdBufferList().peekIsEmpty());
+    EXPECT_TRUE(controller->pendingSubmissions.empty());
+
+    commandStreamReceiver.directSubmissionAvailable = true;
+    EXPECT_TRUE(commandStreamReceiver.flushBatchedSubmissions());
+    EXPECT_EQ(1u, controller->pendingSubmissions.size());
+
+    controller->checkNewSubmissions();
+    EXPECT_FALSE(controller->directSubmissions[&commandStreamReceiver].isStopped);
+
+    controller->cpuTimestamp += controller->timeout;
+    controller->checkNewSubmissions();
+    EXPECT_TRUE(controller->directSubmissions[&commandStreamReceiver].isStopped);
+    EXPECT_TRUE(commandStreamReceiver.stopDirectSubmissionCalled);
+
+    commandStreamReceiver.directSubmissionAvailable = false;
+    controller->unregisterDirectSubmission(&commandStreamReceiver);
+}
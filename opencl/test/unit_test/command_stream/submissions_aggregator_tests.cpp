@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/submissions_aggregator.h"
 #include "shared/source/helpers/flush_stamp.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_csr.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
@@ -545,6 +546,39 @@ TEST(SubmissionsAggregator, givenCommandBuffersRequiringDifferentSliceCountSetti
     EXPECT_EQ(1u, cmdBuffer->inspectionId);
 }
 
+TEST(SubmissionsAggregator, givenLatencyCapDisabledWhenRecordingCommandBufferThenRecordTimeIsNotSet) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.BatchedSubmissionsLatencyCap.set(-1);
+    MockSubmissionAggregator submissionsAggregator;
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    CommandBuffer *cmdBuffer = new CommandBuffer(*device);
+
+    submissionsAggregator.recordCommandBuffer(cmdBuffer);
+    EXPECT_EQ(std::chrono::steady_clock::time_point{}, cmdBuffer->recordTime);
+}
+
+TEST(SubmissionsAggregator, givenRecordedCommandBuffersWhenCheckingLatencyCapThenAgeOfOldestCommandBufferIsCompared) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.BatchedSubmissionsLatencyCap.set(0);
+    MockSubmissionAggregator submissionsAggregator;
+    EXPECT_FALSE(submissionsAggregator.isLatencyCapExceeded(std::chrono::microseconds(0), std::chrono::steady_clock::now()));
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    CommandBuffer *cmdBuffer = new CommandBuffer(*device);
+    CommandBuffer *cmdBuffer2 = new CommandBuffer(*device);
+
+    submissionsAggregator.recordCommandBuffer(cmdBuffer);
+    submissionsAggregator.recordCommandBuffer(cmdBuffer2);
+    EXPECT_LE(cmdBuffer->recordTime, cmdBuffer2->recordTime);
+
+    cmdBuffer2->recordTime = cmdBuffer->recordTime + std::chrono::microseconds(100);
+    auto now = cmdBuffer->recordTime + std::chrono::microseconds(50);
+
+    EXPECT_TRUE(submissionsAggregator.isLatencyCapExceeded(std::chrono::microseconds(50), now));
+    EXPECT_FALSE(submissionsAggregator.isLatencyCapExceeded(std::chrono::microseconds(51), now));
+}
+
 struct SubmissionsAggregatorTests : public ::testing::Test {
     void SetUp() override {
         device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
@@ -680,3 +714,51 @@ HWTEST_F(SubmissionsAggregatorTests, givenMultipleCmdBuffersWhenNotAggregatedDur
     castToObject<Event>(event1)->release();
     castToObject<Event>(event2)->release();
 }
+
+HWTEST_F(SubmissionsAggregatorTests, givenBatchedSubmissionsLatencyCapWhenCmdBuffersFromMultipleQueuesAreRecordedThenTheyAreFlushedOnlyWhenCapIsExceeded) {
+    DebugManagerStateRestore restorer;
+    MockKernelWithInternals kernel(*device.get());
+    CommandQueueHw<FamilyType> cmdQ1(context.get(), device.get(), 0, false);
+    CommandQueueHw<FamilyType> cmdQ2(context.get(), device.get(), 0, false);
+    auto mockCsr = new MockCsrHw2<FamilyType>(*device->executionEnvironment, device->getRootDeviceIndex(), device->getDeviceBitfield());
+    mockCsr->useNewResourceImplicitFlush = false;
+    mockCsr->useGpuIdleImplicitFlush = false;
+    size_t gws = 1;
+
+    overrideCsr(mockCsr);
+    auto &cmdBufferList = mockCsr->peekSubmissionAggregator()->peekCmdBufferList();
+
+    debugManager.flags.BatchedSubmissionsLatencyCap.set(std::numeric_limits<int32_t>::max());
+    cmdQ1.enqueueKernel(kernel, 1, nullptr, &gws, nullptr, 0, nullptr, nullptr);
+    cmdQ2.enqueueKernel(kernel, 1, nullptr, &gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(2u, cmdBufferList.peekHead()->countThisAndAllConnected());
+
+    debugManager.flags.BatchedSubmissionsLatencyCap.set(0);
+    cmdQ1.enqueueKernel(kernel, 1, nullptr, &gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_TRUE(cmdBufferList.peekIsEmpty());
+}
+
+HWTEST_F(SubmissionsAggregatorTests, givenBatchedSubmissionsMemoryBudgetExceededWhenFlushThenCmdBuffersFromMultipleQueuesAreNotAggregated) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.BatchedSubmissionsMemoryBudget.set(0);
+
+    MockKernelWithInternals kernel(*device.get());
+    CommandQueueHw<FamilyType> cmdQ1(context.get(), device.get(), 0, false);
+    CommandQueueHw<FamilyType> cmdQ2(context.get(), device.get(), 0, false);
+    auto mockCsr = new MockCsrHw2<FamilyType>(*device->executionEnvironment, device->getRootDeviceIndex(), device->getDeviceBitfield());
+    mockCsr->useNewResourceImplicitFlush = false;
+    mockCsr->useGpuIdleImplicitFlush = false;
+    size_t gws = 1;
+
+    overrideCsr(mockCsr);
+    mockCsr->taskCount = 5;
+    mockCsr->flushStamp->setStamp(5);
+
+    cmdQ1.enqueueKernel(kernel, 1, nullptr, &gws, nullptr, 0, nullptr, nullptr);
+    cmdQ2.enqueueKernel(kernel, 1, nullptr, &gws, nullptr, 0, nullptr, nullptr);
+
+    mockCsr->flushBatchedSubmissions();
+
+    EXPECT_EQ(6u, cmdQ1.flushStamp->peekStamp());
+    EXPECT_EQ(7u, cmdQ2.flushStamp->peekStamp());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -388,3 +388,82 @@ TEST_F(AsyncEventsHandlerTests, WhenReturningThenAsyncProcessWillCallProcessList
 
     event->release();
 }
+
+TEST_F(AsyncEventsHandlerTests, givenSubmittedEventsWithCallbacksWhenProcessedThenTheyAreOrderedByTaskCountPerCsr) {
+    int event1Counter(0), event2Counter(0), event3Counter(0);
+
+    event1->setTaskStamp(0, 3);
+    event2->setTaskStamp(0, 1);
+    event3->setTaskStamp(0, 2);
+
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &event1Counter);
+    handler->registerEvent(event1.get());
+    event2->addCallback(&this->callbackFcn, CL_COMPLETE, &event2Counter);
+    handler->registerEvent(event2.get());
+    event3->addCallback(&this->callbackFcn, CL_COMPLETE, &event3Counter);
+    handler->registerEvent(event3.get());
+
+    auto sleepCandidate = handler->process();
+    EXPECT_EQ(event2.get(), sleepCandidate);
+
+    auto &csr = commandQueue->getGpgpuCommandStreamReceiver();
+    ASSERT_EQ(1u, handler->submittedEvents.size());
+    auto &csrEvents = handler->submittedEvents[&csr];
+    ASSERT_EQ(3u, csrEvents.size());
+    auto eventIt = csrEvents.begin();
+    EXPECT_EQ(event2.get(), (eventIt++)->second);
+    EXPECT_EQ(event3.get(), (eventIt++)->second);
+    EXPECT_EQ(event1.get(), (eventIt++)->second);
+
+    *csr.getTagAddress() = 2;
+    sleepCandidate = handler->process();
+    EXPECT_EQ(event1.get(), sleepCandidate);
+    EXPECT_EQ(0, event1Counter);
+    EXPECT_EQ(1, event2Counter);
+    EXPECT_EQ(1, event3Counter);
+    EXPECT_EQ(1u, handler->submittedEvents[&csr].size());
+
+    *csr.getTagAddress() = 3;
+    sleepCandidate = handler->process();
+    EXPECT_EQ(nullptr, sleepCandidate);
+    EXPECT_EQ(1, event1Counter);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+}
+
+TEST_F(AsyncEventsHandlerTests, givenSubmittedEventsWhenLowestTaskCountIsNotCompletedThenOtherEventsAreNotPolled) {
+    event1->setTaskStamp(0, 1);
+    event2->setTaskStamp(0, 2);
+    event3->setTaskStamp(0, 3);
+
+    for (auto &event : {event1.get(), event2.get(), event3.get()}) {
+        event->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+        handler->registerEvent(event);
+    }
+    handler->process();
+
+    auto isCompletedCalledBefore = commandQueue->isCompletedCalled;
+    handler->process();
+    EXPECT_EQ(isCompletedCalledBefore + 1, commandQueue->isCompletedCalled);
+    EXPECT_EQ(0, counter);
+
+    *commandQueue->getGpgpuCommandStreamReceiver().getTagAddress() = 3;
+    handler->process();
+    EXPECT_EQ(3, counter);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+}
+
+TEST_F(AsyncEventsHandlerTests, givenSubmittedEventsWhenReleasingEventsThenUnreferenceAll) {
+    event1->setTaskStamp(0, 1);
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    handler->registerEvent(event1.get());
+    handler->process();
+    EXPECT_EQ(1u, handler->submittedEvents.size());
+    EXPECT_EQ(3, event1->getRefInternalCount());
+
+    handler->allowAsyncProcess.store(false);
+    MockHandler::asyncProcess(handler.get());
+    EXPECT_TRUE(handler->peekIsListEmpty());
+    EXPECT_EQ(2, event1->getRefInternalCount());
+
+    event1->setStatus(CL_COMPLETE);
+}
@@ -0,0 +1,319 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "opencl/source/event/events_trace_recorder.h"
+
+#include "CL/cl.h"
+
+#include <atomic>
+#include <cstring>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+class MockEventsTraceRecorder : public EventsTraceRecorder {
+  public:
+    using EventsTraceRecorder::rings;
+
+    void writeTraceData(const void *data, size_t size) override {
+        auto bytes = reinterpret_cast<const uint8_t *>(data);
+        traceData.insert(traceData.end(), bytes, bytes + size);
+    }
+
+    bool readTraceData(std::vector<uint8_t> &trace) override {
+        trace = traceData;
+        return true;
+    }
+
+    void writeDotData(const std::string &dot) override {
+        dotData = dot;
+        writeDotDataCalled++;
+    }
+
+    size_t getRecordsCount() const {
+        return (traceData.size() - sizeof(EventsTraceHeader)) / sizeof(EventTraceRecord);
+    }
+
+    std::vector<uint8_t> traceData;
+    std::string dotData;
+    uint32_t writeDotDataCalled = 0u;
+};
+
+class WhiteBoxEventsTraceRecorder : public EventsTraceRecorder {
+  public:
+    using EventsTraceRecorder::drainingThread;
+    using EventsTraceRecorder::globalEventsTraceRecorder;
+};
+
+TEST(EventTraceRecordsRing, givenFullRingWhenPushingThenRecordIsRejectedUntilRecordsArePopped) {
+    auto ring = std::make_unique<EventTraceRecordsRing>();
+    EventTraceRecord record;
+    for (size_t i = 0; i < EventTraceRecordsRing::capacity; i++) {
+        record.value = static_cast<int32_t>(i);
+        EXPECT_TRUE(ring->push(record));
+    }
+    EXPECT_FALSE(ring->push(record));
+
+    EventTraceRecord popped[2];
+    EXPECT_EQ(2u, ring->pop(popped, 2));
+    EXPECT_EQ(0, popped[0].value);
+    EXPECT_EQ(1, popped[1].value);
+    EXPECT_TRUE(ring->push(record));
+}
+
+TEST(EventsTraceRecorder, givenNotificationsWhenFlushingThenHeaderAndRecordsAreWritten) {
+    MockEventsTraceRecorder recorder;
+    int event = 0;
+    int childEvent = 0;
+    int cmdQueue = 0;
+
+    recorder.flush();
+    EXPECT_TRUE(recorder.traceData.empty());
+
+    recorder.notifyCreation(reinterpret_cast<Event *>(&event), reinterpret_cast<CommandQueue *>(&cmdQueue), CL_COMMAND_NDRANGE_KERNEL);
+    recorder.notifyDependencyAdded(reinterpret_cast<Event *>(&event), reinterpret_cast<Event *>(&childEvent));
+    recorder.notifyTransitionedExecutionStatus(reinterpret_cast<Event *>(&event), CL_COMPLETE);
+    recorder.notifyDestruction(reinterpret_cast<Event *>(&event));
+    recorder.flush();
+
+    ASSERT_EQ(sizeof(EventsTraceHeader) + 4 * sizeof(EventTraceRecord), recorder.traceData.size());
+    EventsTraceHeader header;
+    memcpy(&header, recorder.traceData.data(), sizeof(header));
+    EXPECT_EQ(EventsTraceHeader::traceMagic, header.magic);
+    EXPECT_EQ(EventsTraceHeader::traceVersion, header.version);
+    EXPECT_EQ(sizeof(EventTraceRecord), header.recordSize);
+
+    EventTraceRecord records[4];
+    memcpy(records, recorder.traceData.data() + sizeof(header), sizeof(records));
+    EXPECT_EQ(EventTraceRecord::Type::created, records[0].type);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&event), records[0].event);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&cmdQueue), records[0].cmdQueue);
+    EXPECT_EQ(CL_COMMAND_NDRANGE_KERNEL, records[0].value);
+    EXPECT_EQ(EventTraceRecord::Type::dependencyAdded, records[1].type);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&childEvent), records[1].dependentEvent);
+    EXPECT_EQ(EventTraceRecord::Type::statusChanged, records[2].type);
+    EXPECT_EQ(CL_COMPLETE, records[2].value);
+    EXPECT_EQ(EventTraceRecord::Type::destroyed, records[3].type);
+    EXPECT_LE(records[0].timestampNs, records[3].timestampNs);
+
+    recorder.flush();
+    EXPECT_EQ(sizeof(EventsTraceHeader) + 4 * sizeof(EventTraceRecord), recorder.traceData.size());
+}
+
+TEST(EventsTraceRecorder, givenNotificationsFromMultipleThreadsWhenFlushingThenEachThreadUsesOwnRingAndAllRecordsAreWritten) {
+    MockEventsTraceRecorder recorder;
+    constexpr size_t threadsCount = 4u;
+    constexpr size_t recordsPerThread = 100u;
+
+    // threads are kept alive until all of them notified, otherwise rings of exited threads could be reused
+    std::atomic<size_t> threadsDone{0u};
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadsCount; i++) {
+        threads.push_back(std::thread([&recorder, &threadsDone]() {
+            for (size_t j = 0; j < recordsPerThread; j++) {
+                recorder.notifyTransitionedExecutionStatus(nullptr, CL_SUBMITTED);
+            }
+            threadsDone++;
+            while (threadsDone.load() != threadsCount) {
+                std::this_thread::yield();
+            }
+        }));
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    recorder.flush();
+
+    EXPECT_EQ(threadsCount, recorder.rings.size());
+    EXPECT_EQ(threadsCount * recordsPerThread, recorder.getRecordsCount());
+    EXPECT_EQ(0u, recorder.getDroppedRecordsCount());
+}
+
+TEST(EventsTraceRecorder, givenThreadExitedWhenOtherThreadNotifiesThenRingOfExitedThreadIsReusedAndAllRecordsAreWritten) {
+    MockEventsTraceRecorder recorder;
+    constexpr size_t recordsPerThread = 10u;
+
+    for (size_t i = 0; i < 3; i++) {
+        std::thread thread([&recorder]() {
+            for (size_t j = 0; j < recordsPerThread; j++) {
+                recorder.notifyTransitionedExecutionStatus(nullptr, CL_SUBMITTED);
+            }
+        });
+        thread.join();
+    }
+    ASSERT_EQ(1u, recorder.rings.size());
+    EXPECT_FALSE(recorder.rings[0]->isAcquired());
+
+    recorder.flush();
+    EXPECT_EQ(3 * recordsPerThread, recorder.getRecordsCount());
+    EXPECT_EQ(0u, recorder.getDroppedRecordsCount());
+}
+
+TEST(EventsTraceRecorder, givenRecorderDestroyedBeforeThreadExitWhenThreadExitsThenRingIsReleased) {
+    std::weak_ptr<EventTraceRecordsRing> ring;
+    std::atomic<bool> recorderDestroyed{false};
+    std::atomic<bool> notified{false};
+    auto recorder = std::make_unique<MockEventsTraceRecorder>();
+    std::thread thread([&]() {
+        recorder->notifyTransitionedExecutionStatus(nullptr, CL_SUBMITTED);
+        notified = true;
+        while (!recorderDestroyed.load()) {
+            std::this_thread::yield();
+        }
+    });
+    while (!notified.load()) {
+        std::this_thread::yield();
+    }
+    ASSERT_EQ(1u, recorder->rings.size());
+    ring = recorder->rings[0];
+    EXPECT_TRUE(ring.lock()->isAcquired());
+
+    recorder.reset();
+    EXPECT_FALSE(ring.expired());
+    recorderDestroyed = true;
+    thread.join();
+    EXPECT_TRUE(ring.expired());
+}
+
+TEST(EventsTraceRecorder, givenFullRingWhenNotifyingThenRecordIsDroppedAndCounted) {
+    MockEventsTraceRecorder recorder;
+    for (size_t i = 0; i < EventTraceRecordsRing::capacity + 2; i++) {
+        recorder.notifyTransitionedExecutionStatus(nullptr, CL_SUBMITTED);
+    }
+    EXPECT_EQ(2u, recorder.getDroppedRecordsCount());
+
+    recorder.flush();
+    EXPECT_EQ(EventTraceRecordsRing::capacity, recorder.getRecordsCount());
+}
+
+TEST(EventsTraceRecorder, givenTraceWhenConvertingToDotThenEventsQueuesAndDependenciesAreDumped) {
+    MockEventsTraceRecorder recorder;
+    int event = 0;
+    int userEvent = 0;
+    int cmdQueue = 0;
+
+    recorder.notifyCreation(reinterpret_cast<Event *>(&userEvent), nullptr, CL_COMMAND_USER);
+    recorder.notifyCreation(reinterpret_cast<Event *>(&event), reinterpret_cast<CommandQueue *>(&cmdQueue), CL_COMMAND_NDRANGE_KERNEL);
+    recorder.notifyDependencyAdded(reinterpret_cast<Event *>(&userEvent), reinterpret_cast<Event *>(&event));
+    recorder.notifyTransitionedExecutionStatus(reinterpret_cast<Event *>(&event), CL_SUBMITTED);
+    recorder.notifyTransitionedExecutionStatus(reinterpret_cast<Event *>(&userEvent), -1);
+    recorder.notifyDestruction(reinterpret_cast<Event *>(&userEvent));
+    recorder.flush();
+
+    std::stringstream out;
+    EXPECT_TRUE(EventsTraceRecorder::convertToDot({recorder.traceData.data(), recorder.traceData.size()}, out));
+
+    std::stringstream cmdQueueLabel;
+    cmdQueueLabel << "cq" << reinterpret_cast<uintptr_t>(&cmdQueue);
+    std::stringstream expected;
+    expected << "digraph events_trace {\n"
+             << "node [shape=record]\n"
+             << cmdQueueLabel.str() << "[label=\"{------CmdQueue, ptr=0x" << std::hex << reinterpret_cast<uintptr_t>(&cmdQueue) << std::dec << "------}\",color=blue];\n"
+             << "e0[label=\"{------USER_EVENT ptr=0x" << std::hex << reinterpret_cast<uintptr_t>(&userEvent) << std::dec << "------||ABORTED|RELEASED}\",color=green];\n"
+             << "e1[label=\"{-----------EVENT  ptr=0x" << std::hex << reinterpret_cast<uintptr_t>(&event) << std::dec << "------|CL_COMMAND_NDRANGE_KERNEL|CL_SUBMITTED|ALIVE}\",color=yellow];\n"
+             << cmdQueueLabel.str() << "->e1;\n"
+             << "e0->e1;\n"
+             << "\n}\n";
+    EXPECT_STREQ(expected.str().c_str(), out.str().c_str());
+}
+
+TEST(EventsTraceRecorder, givenEventAddressReusedAfterDestructionWhenConvertingToDotThenSeparateNodesAreDumped) {
+    MockEventsTraceRecorder recorder;
+    int event = 0;
+
+    recorder.notifyCreation(reinterpret_cast<Event *>(&event), nullptr, CL_COMMAND_MARKER);
+    recorder.notifyDestruction(reinterpret_cast<Event *>(&event));
+    recorder.notifyCreation(reinterpret_cast<Event *>(&event), nullptr, CL_COMMAND_BARRIER);
+    recorder.flush();
+
+    std::stringstream out;
+    EXPECT_TRUE(EventsTraceRecorder::convertToDot({recorder.traceData.data(), recorder.traceData.size()}, out));
+
+    std::stringstream eventPtr;
+    eventPtr << "ptr=0x" << std::hex << reinterpret_cast<uintptr_t>(&event) << "------";
+    EXPECT_NE(std::string::npos, out.str().find("e0[label=\"{-----------EVENT  " + eventPtr.str() + "|CL_COMMAND_MARKER|CL_QUEUED|RELEASED}"));
+    EXPECT_NE(std::string::npos, out.str().find("e1[label=\"{-----------EVENT  " + eventPtr.str() + "|CL_COMMAND_BARRIER|CL_QUEUED|ALIVE}"));
+    EXPECT_EQ(std::string::npos, out.str().find("e2["));
+}
+
+TEST(EventsTraceRecorder, givenInvalidTraceWhenConvertingToDotThenFalseIsReturned) {
+    std::stringstream out;
+    EventsTraceHeader header;
+    std::vector<uint8_t> trace(sizeof(header));
+
+    EXPECT_FALSE(EventsTraceRecorder::convertToDot({trace.data(), sizeof(header) - 1}, out));
+
+    header.magic = 0u;
+    memcpy(trace.data(), &header, sizeof(header));
+    EXPECT_FALSE(EventsTraceRecorder::convertToDot({trace.data(), trace.size()}, out));
+
+    header = {};
+    header.recordSize = sizeof(EventTraceRecord) + 8u;
+    memcpy(trace.data(), &header, sizeof(header));
+    EXPECT_FALSE(EventsTraceRecorder::convertToDot({trace.data(), trace.size()}, out));
+
+    header = {};
+    memcpy(trace.data(), &header, sizeof(header));
+    trace.resize(sizeof(header) + sizeof(EventTraceRecord) - 1);
+    EXPECT_FALSE(EventsTraceRecorder::convertToDot({trace.data(), trace.size()}, out));
+
+    EXPECT_TRUE(out.str().empty());
+
+    trace.resize(sizeof(header));
+    EXPECT_TRUE(EventsTraceRecorder::convertToDot({trace.data(), trace.size()}, out));
+    EXPECT_STREQ("digraph events_trace {\nnode [shape=record]\n\n}\n", out.str().c_str());
+}
+
+TEST(EventsTraceRecorder, givenDumpDotEnabledWhenShuttingDownThenRemainingRecordsAreFlushedAndTraceIsConvertedToDot) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EventsTraceDumpDot.set(true);
+
+    MockEventsTraceRecorder recorder;
+    int event = 0;
+    int cmdQueue = 0;
+    recorder.notifyCreation(reinterpret_cast<Event *>(&event), reinterpret_cast<CommandQueue *>(&cmdQueue), CL_COMMAND_NDRANGE_KERNEL);
+    recorder.notifyTransitionedExecutionStatus(reinterpret_cast<Event *>(&event), CL_COMPLETE);
+
+    recorder.shutdown();
+    EXPECT_EQ(2u, recorder.getRecordsCount());
+    EXPECT_EQ(1u, recorder.writeDotDataCalled);
+
+    std::stringstream expectedDot;
+    EXPECT_TRUE(EventsTraceRecorder::convertToDot({recorder.traceData.data(), recorder.traceData.size()}, expectedDot));
+    EXPECT_STREQ(expectedDot.str().c_str(), recorder.dotData.c_str());
+    EXPECT_NE(std::string::npos, recorder.dotData.find("CL_COMMAND_NDRANGE_KERNEL|CL_COMPLETE|ALIVE"));
+}
+
+TEST(EventsTraceRecorder, givenDumpDotDisabledWhenShuttingDownThenRecordsAreFlushedWithoutDotDump) {
+    MockEventsTraceRecorder recorder;
+    recorder.notifyTransitionedExecutionStatus(nullptr, CL_SUBMITTED);
+
+    recorder.shutdown();
+    EXPECT_EQ(1u, recorder.getRecordsCount());
+    EXPECT_EQ(0u, recorder.writeDotDataCalled);
+}
+
+TEST(EventsTraceRecorder, givenGlobalRecorderWhenShutdownIsCalledThenDrainingThreadIsJoinedBeforeRecorderDestruction) {
+    EventsTraceRecorder::shutdownEventsTraceRecorder();
+    EXPECT_EQ(nullptr, WhiteBoxEventsTraceRecorder::globalEventsTraceRecorder.get());
+
+    auto &recorder = static_cast<WhiteBoxEventsTraceRecorder &>(EventsTraceRecorder::getEventsTraceRecorder());
+    EXPECT_NE(nullptr, recorder.drainingThread.get());
+
+    EventsTraceRecorder::shutdownEventsTraceRecorder();
+    EXPECT_EQ(nullptr, recorder.drainingThread.get());
+    EXPECT_EQ(&recorder, WhiteBoxEventsTraceRecorder::globalEventsTraceRecorder.get());
+
+    EventsTraceRecorder::shutdownEventsTraceRecorder();
+    WhiteBoxEventsTraceRecorder::globalEventsTraceRecorder.reset();
+}
@@ -55,6 +55,64 @@ TEST_F(KernelArgBufferTest, GivenValidBufferWhenSettingKernelArgThenBufferAddres
     delete buffer;
 }
 
+TEST_F(KernelArgBufferTest, GivenBufferAlreadySetAsKernelArgWhenSettingSameBufferAgainThenArgIsNotPatchedAgain) {
+    MockBuffer buffer;
+
+    auto val = (cl_mem)&buffer;
+    auto retVal = this->pKernel->setArg(0, sizeof(cl_mem), &val);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_NE(0u, this->pKernel->getKernelArgInfo(0).memObjAllocationsStamp);
+
+    auto pKernelArg = reinterpret_cast<void **>(this->pKernel->getCrossThreadData() +
+                                                this->pKernelInfo->argAsPtr(0).stateless);
+    EXPECT_EQ(buffer.getCpuAddress(), *pKernelArg);
+    *pKernelArg = nullptr;
+
+    auto sameVal = (cl_mem)&buffer;
+    retVal = this->pKernel->setArg(0, sizeof(cl_mem), &sameVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(nullptr, *pKernelArg);
+    EXPECT_EQ(&sameVal, this->pKernel->getKernelArgInfo(0).value);
+
+    this->pKernel->unsetArg(0);
+    retVal = this->pKernel->setArg(0, sizeof(cl_mem), &sameVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(buffer.getCpuAddress(), *pKernelArg);
+}
+
+TEST_F(KernelArgBufferTest, GivenBufferAlreadySetAsKernelArgWhenSettingDifferentBufferThenArgIsPatched) {
+    MockBuffer buffer;
+    MockBuffer otherBuffer;
+    EXPECT_NE(buffer.getAllocationsStamp(), otherBuffer.getAllocationsStamp());
+
+    auto val = (cl_mem)&buffer;
+    auto retVal = this->pKernel->setArg(0, sizeof(cl_mem), &val);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto otherVal = (cl_mem)&otherBuffer;
+    retVal = this->pKernel->setArg(0, sizeof(cl_mem), &otherVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(otherBuffer.getAllocationsStamp(), this->pKernel->getKernelArgInfo(0).memObjAllocationsStamp);
+
+    auto pKernelArg = reinterpret_cast<void **>(this->pKernel->getCrossThreadData() +
+                                                this->pKernelInfo->argAsPtr(0).stateless);
+    EXPECT_EQ(otherBuffer.getCpuAddress(), *pKernelArg);
+}
+
+TEST_F(KernelArgBufferTest, GivenBufferSetAsKernelArgWhenSettingOtherArgTypeThenAllocationsStampIsCleared) {
+    MockBuffer buffer;
+
+    auto val = (cl_mem)&buffer;
+    auto retVal = this->pKernel->setArg(0, sizeof(cl_mem), &val);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_NE(0u, this->pKernel->getKernelArgInfo(0).memObjAllocationsStamp);
+
+    auto nullVal = (cl_mem) nullptr;
+    retVal = this->pKernel->setArg(0, sizeof(cl_mem), &nullVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0u, this->pKernel->getKernelArgInfo(0).memObjAllocationsStamp);
+}
+
 struct MultiDeviceKernelArgBufferTest : public ::testing::Test {
 
     void SetUp() override {
@@ -1562,6 +1562,7 @@ HWTEST_F(KernelResidencyTest, givenSharedUnifiedMemoryAndNotRequiredMemSyncWhenM
         4096u,
         gpuAllocation,
         Kernel::KernelArgType::SVM_ALLOC_OBJ};
+    mockKernel.mockKernel->updateArgsRequiringResidency();
     mockKernel.mockKernel->setUnifiedMemorySyncRequirement(false);
 
     mockKernel.mockKernel->makeResident(commandStreamReceiver);
@@ -1599,6 +1600,7 @@ HWTEST_F(KernelResidencyTest, givenSvmArgWhenKernelDoesNotRequireUnifiedMemorySy
         4096u,
         gpuAllocation,
         Kernel::KernelArgType::SVM_ALLOC_OBJ};
+    mockKernel.mockKernel->updateArgsRequiringResidency();
     mockKernel.mockKernel->setUnifiedMemorySyncRequirement(false);
     std::vector<NEO::Surface *> residencySurfaces;
     mockKernel.mockKernel->getResidency(residencySurfaces);
@@ -1628,6 +1630,7 @@ HWTEST_F(KernelResidencyTest, givenSvmArgWhenKernelRequireUnifiedMemorySyncThenS
         4096u,
         gpuAllocation,
         Kernel::KernelArgType::SVM_ALLOC_OBJ};
+    mockKernel.mockKernel->updateArgsRequiringResidency();
     mockKernel.mockKernel->setUnifiedMemorySyncRequirement(true);
     std::vector<NEO::Surface *> residencySurfaces;
     mockKernel.mockKernel->getResidency(residencySurfaces);
@@ -1659,6 +1662,7 @@ HWTEST_F(KernelResidencyTest, givenSharedUnifiedMemoryRequiredMemSyncWhenMakeRes
         4096u,
         gpuAllocation,
         Kernel::KernelArgType::SVM_ALLOC_OBJ};
+    mockKernel.mockKernel->updateArgsRequiringResidency();
     mockKernel.mockKernel->setUnifiedMemorySyncRequirement(true);
 
     mockKernel.mockKernel->makeResident(commandStreamReceiver);
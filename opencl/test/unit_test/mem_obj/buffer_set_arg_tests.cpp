@@ -266,6 +266,28 @@ TEST_F(BufferSetArgTest, WhenSettingKernelArgThenAddressToPatchIsSetCorrectlyAnd
     }
 }
 
+TEST_F(BufferSetArgTest, givenBufferArgsWhenSettingAndUnsettingThemThenArgsRequiringResidencyAreTracked) {
+    EXPECT_EQ(0u, pKernel->getArgsRequiringResidency().size());
+
+    cl_mem memObj = buffer;
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(2, sizeof(memObj), &memObj));
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(memObj), &memObj));
+    ASSERT_EQ(2u, pKernel->getArgsRequiringResidency().size());
+    EXPECT_EQ(0u, pKernel->getArgsRequiringResidency()[0]);
+    EXPECT_EQ(2u, pKernel->getArgsRequiringResidency()[1]);
+
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem), nullptr));
+    ASSERT_EQ(1u, pKernel->getArgsRequiringResidency().size());
+    EXPECT_EQ(2u, pKernel->getArgsRequiringResidency()[0]);
+
+    std::vector<Surface *> surfaces;
+    pKernel->getResidency(surfaces);
+    EXPECT_EQ(1u, surfaces.size());
+    for (auto &surface : surfaces) {
+        delete surface;
+    }
+}
+
 TEST_F(BufferSetArgTest, GivenSvmPointerWhenSettingKernelArgThenAddressToPatchIsSetCorrectlyAndSurfacesSet) {
     REQUIRE_SVM_OR_SKIP(pDevice);
     void *ptrSVM = pContext->getSVMAllocsManager()->createSVMAlloc(256, {}, pContext->getRootDeviceIndices(), pContext->getDeviceBitfields());
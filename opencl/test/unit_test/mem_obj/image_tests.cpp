@@ -9,6 +9,7 @@
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/image/image_surface_state.h"
+#include "shared/source/memory_manager/memory_pool.h"
 #include "shared/source/memory_manager/migration_sync_data.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/test/common/fixtures/memory_management_fixture.h"
@@ -32,6 +33,7 @@
 #include "opencl/test/unit_test/fixtures/image_fixture.h"
 #include "opencl/test/unit_test/fixtures/multi_root_device_fixture.h"
 #include "opencl/test/unit_test/mem_obj/image_compression_fixture.h"
+#include "opencl/test/unit_test/mocks/mock_command_queue.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
 #include "opencl/test/unit_test/mocks/mock_image.h"
 #include "opencl/test/unit_test/mocks/mock_platform.h"
@@ -1460,6 +1462,250 @@ TEST(ImageTest, givenClMemCopyHostPointerPassedToImageCreateWhenAllocationIsNotI
     EXPECT_LT(taskCount, taskCountSent);
 }
 
+struct ImageCpuTiledTransferTest : public ::testing::Test {
+    void SetUp() override {
+        REQUIRE_IMAGES_OR_SKIP(defaultHwInfo);
+
+        imageDesc.image_type = CL_MEM_OBJECT_IMAGE2D;
+        imageDesc.image_width = 16;
+        imageDesc.image_height = 16;
+        imageFormat.image_channel_data_type = CL_UNSIGNED_INT8;
+        imageFormat.image_channel_order = CL_RGBA;
+    }
+
+    Image *createImage() {
+        return createImage(hostMemory);
+    }
+
+    Image *createImage(void *hostPtr) {
+        cl_int retVal = CL_SUCCESS;
+        auto surfaceFormat = Image::getSurfaceFormatFromTable(flags, &imageFormat, context.getDevice(0)->getHardwareInfo().capabilityTable.supportsOcl21Features);
+        auto image = Image::create(&context, ClMemoryPropertiesHelper::createMemoryProperties(flags, 0, 0, &context.getDevice(0)->getDevice()),
+                                   flags, 0, surfaceFormat, &imageDesc, hostPtr, retVal);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        return image;
+    }
+
+    bool isTiledImageInSystemMemory(Image &image) {
+        auto allocation = image.getGraphicsAllocation(context.getDevice(0)->getRootDeviceIndex());
+        return image.isTiledAllocation() && MemoryPoolHelper::isSystemMemoryPool(allocation->getMemoryPool());
+    }
+
+    MockGmmResourceInfo *getMockGmmResourceInfo(Image &image) {
+        auto allocation = image.getGraphicsAllocation(context.getDevice(0)->getRootDeviceIndex());
+        return static_cast<MockGmmResourceInfo *>(allocation->getDefaultGmm()->gmmResourceInfo.get());
+    }
+
+    DebugManagerStateRestore restorer;
+    MockContext context;
+    cl_mem_flags flags = CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR;
+    cl_image_desc imageDesc = {};
+    cl_image_format imageFormat = {};
+    uint8_t hostMemory[16 * 16 * 4 * 4] = {};
+};
+
+TEST_F(ImageCpuTiledTransferTest, givenSmallTiledImageInSystemMemoryWhenCreatedWithCopyHostPtrThenImageIsWrittenWithGmmCpuBltInsteadOfGpuCopy) {
+    auto &csr = context.getDevice(0)->getGpgpuCommandStreamReceiver();
+    auto taskCount = csr.peekLatestFlushedTaskCount();
+
+    std::unique_ptr<Image> image(createImage());
+    ASSERT_NE(nullptr, image);
+    if (!isTiledImageInSystemMemory(*image) || !image->isCpuTiledTransferPreferred(context.getDevice(0)->getRootDeviceIndex())) {
+        GTEST_SKIP();
+    }
+
+    auto mockResInfo = getMockGmmResourceInfo(*image);
+    EXPECT_EQ(1u, mockResInfo->cpuBltCalled);
+    auto &requestedCpuBlt = mockResInfo->requestedResCopyBlt;
+    EXPECT_EQ(hostMemory, requestedCpuBlt.Sys.pData);
+    EXPECT_EQ(16u * 4u, requestedCpuBlt.Sys.RowPitch);
+    EXPECT_EQ(4u, requestedCpuBlt.Sys.PixelPitch);
+    EXPECT_EQ(0u, requestedCpuBlt.Gpu.OffsetX);
+    EXPECT_EQ(0u, requestedCpuBlt.Gpu.OffsetY);
+    EXPECT_EQ(0u, requestedCpuBlt.Gpu.Slice);
+    EXPECT_EQ(16u, requestedCpuBlt.Blt.Width);
+    EXPECT_EQ(16u, requestedCpuBlt.Blt.Height);
+    EXPECT_EQ(1u, requestedCpuBlt.Blt.Slices);
+    EXPECT_EQ(4u, requestedCpuBlt.Blt.BytesPerPixel);
+    EXPECT_EQ(1u, requestedCpuBlt.Blt.Upload);
+
+    EXPECT_EQ(taskCount, csr.peekLatestFlushedTaskCount());
+}
+
+TEST_F(ImageCpuTiledTransferTest, given2dArrayAnd3dTiledImagesWhenCreatedWithCopyHostPtrThenAllSlicesAreWrittenWithSingleGmmCpuBlt) {
+    cl_image_desc imageDescs[2] = {};
+    imageDescs[0].image_type = CL_MEM_OBJECT_IMAGE2D_ARRAY;
+    imageDescs[0].image_width = 16;
+    imageDescs[0].image_height = 16;
+    imageDescs[0].image_array_size = 3;
+    imageDescs[1].image_type = CL_MEM_OBJECT_IMAGE3D;
+    imageDescs[1].image_width = 16;
+    imageDescs[1].image_height = 16;
+    imageDescs[1].image_depth = 3;
+
+    for (auto &desc : imageDescs) {
+        imageDesc = desc;
+        std::unique_ptr<Image> image(createImage());
+        ASSERT_NE(nullptr, image);
+        if (!image->isCpuTiledTransferPreferred(context.getDevice(0)->getRootDeviceIndex())) {
+            continue;
+        }
+
+        auto mockResInfo = getMockGmmResourceInfo(*image);
+        EXPECT_EQ(1u, mockResInfo->cpuBltCalled);
+        auto &requestedCpuBlt = mockResInfo->requestedResCopyBlt;
+        EXPECT_EQ(16u * 4u, requestedCpuBlt.Sys.RowPitch);
+        EXPECT_EQ(16u * 16u * 4u, requestedCpuBlt.Sys.SlicePitch);
+        EXPECT_EQ(16u * 16u * 4u * 3u, requestedCpuBlt.Sys.BufferSize);
+        EXPECT_EQ(0u, requestedCpuBlt.Gpu.Slice);
+        EXPECT_EQ(3u, requestedCpuBlt.Blt.Slices);
+    }
+}
+
+HWTEST_F(ImageCpuTiledTransferTest, givenCpuCopyOnWriteImageEnabledWhenBlockingWriteToSmallTiledImageThenRegionIsWrittenWithGmmCpuBltWithoutGpuSubmission) {
+    debugManager.flags.DoCpuCopyOnWriteImage.set(1);
+    imageDesc.image_type = CL_MEM_OBJECT_IMAGE3D;
+    imageDesc.image_depth = 4;
+    flags = CL_MEM_READ_WRITE;
+    std::unique_ptr<Image> image(createImage(nullptr));
+    ASSERT_NE(nullptr, image);
+    if (!image->isCpuTiledTransferPreferred(context.getDevice(0)->getRootDeviceIndex())) {
+        GTEST_SKIP();
+    }
+
+    MockCommandQueueHw<FamilyType> cmdQ(&context, context.getDevice(0), nullptr);
+    auto &csr = cmdQ.getGpgpuCommandStreamReceiver();
+    auto taskCount = csr.peekLatestFlushedTaskCount();
+
+    size_t origin[3] = {1, 2, 3};
+    size_t region[3] = {4, 5, 1};
+    cl_event event = nullptr;
+    auto retVal = cmdQ.enqueueWriteImage(image.get(), CL_TRUE, origin, region, 0, 0, hostMemory, nullptr, 0, nullptr, &event);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto mockResInfo = getMockGmmResourceInfo(*image);
+    EXPECT_EQ(1u, mockResInfo->cpuBltCalled);
+    auto &requestedCpuBlt = mockResInfo->requestedResCopyBlt;
+    EXPECT_EQ(hostMemory, requestedCpuBlt.Sys.pData);
+    EXPECT_EQ(4u * 4u, requestedCpuBlt.Sys.RowPitch);
+    EXPECT_EQ(4u * 4u * 5u, requestedCpuBlt.Sys.SlicePitch);
+    EXPECT_EQ(1u, requestedCpuBlt.Gpu.OffsetX);
+    EXPECT_EQ(2u, requestedCpuBlt.Gpu.OffsetY);
+    EXPECT_EQ(3u, requestedCpuBlt.Gpu.Slice);
+    EXPECT_EQ(4u, requestedCpuBlt.Blt.Width);
+    EXPECT_EQ(5u, requestedCpuBlt.Blt.Height);
+    EXPECT_EQ(1u, requestedCpuBlt.Blt.Slices);
+    EXPECT_EQ(1u, requestedCpuBlt.Blt.Upload);
+    EXPECT_EQ(taskCount, csr.peekLatestFlushedTaskCount());
+
+    ASSERT_NE(nullptr, event);
+    auto pEvent = castToObject<Event>(event);
+    EXPECT_EQ(static_cast<cl_command_type>(CL_COMMAND_WRITE_IMAGE), pEvent->getCommandType());
+    EXPECT_TRUE(pEvent->isCompleted());
+    pEvent->release();
+
+}
+
+HWTEST_F(ImageCpuTiledTransferTest, givenCpuCopyOnWriteImageEnabledAndFailingGmmCpuBltWhenBlockingWriteToSmallTiledImageThenRegionIsWrittenWithGpuCopy) {
+    debugManager.flags.DoCpuCopyOnWriteImage.set(1);
+    flags = CL_MEM_READ_WRITE;
+    std::unique_ptr<Image> image(createImage(nullptr));
+    ASSERT_NE(nullptr, image);
+    if (!image->isCpuTiledTransferPreferred(context.getDevice(0)->getRootDeviceIndex())) {
+        GTEST_SKIP();
+    }
+
+    MockCommandQueueHw<FamilyType> cmdQ(&context, context.getDevice(0), nullptr);
+    auto &csr = cmdQ.getGpgpuCommandStreamReceiver();
+    auto taskCount = csr.peekLatestFlushedTaskCount();
+
+    auto mockResInfo = getMockGmmResourceInfo(*image);
+    mockResInfo->cpuBltResult = 0u;
+    size_t origin[3] = {1, 2, 0};
+    size_t region[3] = {4, 5, 1};
+    cl_event event = nullptr;
+    auto retVal = cmdQ.enqueueWriteImage(image.get(), CL_TRUE, origin, region, 0, 0, hostMemory, nullptr, 0, nullptr, &event);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, mockResInfo->cpuBltCalled);
+    EXPECT_EQ(2u, cmdQ.enqueueWriteImageCounter);
+    EXPECT_LT(taskCount, csr.peekLatestFlushedTaskCount());
+
+    ASSERT_NE(nullptr, event);
+    auto pEvent = castToObject<Event>(event);
+    EXPECT_EQ(static_cast<cl_command_type>(CL_COMMAND_WRITE_IMAGE), pEvent->getCommandType());
+    EXPECT_TRUE(pEvent->isCompleted());
+    pEvent->release();
+}
+
+HWTEST_F(ImageCpuTiledTransferTest, givenCpuCopyOnWriteImageNotEnabledOrNonBlockingWriteWhenWritingToSmallTiledImageThenGmmCpuBltIsNotUsed) {
+    flags = CL_MEM_READ_WRITE;
+    std::unique_ptr<Image> image(createImage(nullptr));
+    ASSERT_NE(nullptr, image);
+    if (!image->isCpuTiledTransferPreferred(context.getDevice(0)->getRootDeviceIndex())) {
+        GTEST_SKIP();
+    }
+
+    MockCommandQueueHw<FamilyType> cmdQ(&context, context.getDevice(0), nullptr);
+    size_t origin[3] = {0, 0, 0};
+    size_t region[3] = {16, 16, 1};
+    EXPECT_FALSE(cmdQ.imageCpuWriteAllowed(image.get(), CL_TRUE, nullptr, 0, nullptr));
+
+    debugManager.flags.DoCpuCopyOnWriteImage.set(1);
+    EXPECT_TRUE(cmdQ.imageCpuWriteAllowed(image.get(), CL_TRUE, nullptr, 0, nullptr));
+    EXPECT_FALSE(cmdQ.imageCpuWriteAllowed(image.get(), CL_FALSE, nullptr, 0, nullptr));
+
+    auto retVal = cmdQ.enqueueWriteImage(image.get(), CL_FALSE, origin, region, 0, 0, hostMemory, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0u, getMockGmmResourceInfo(*image)->cpuBltCalled);
+    cmdQ.finish();
+}
+
+TEST_F(ImageCpuTiledTransferTest, givenCpuTiledImageTransferDisabledWhenTiledImageIsCreatedWithCopyHostPtrThenGmmCpuBltIsNotUsed) {
+    debugManager.flags.CpuTiledImageTransferMaxSize.set(0);
+
+    std::unique_ptr<Image> image(createImage());
+    ASSERT_NE(nullptr, image);
+    if (!isTiledImageInSystemMemory(*image)) {
+        GTEST_SKIP();
+    }
+
+    EXPECT_FALSE(image->isCpuTiledTransferPreferred(context.getDevice(0)->getRootDeviceIndex()));
+    EXPECT_EQ(0u, getMockGmmResourceInfo(*image)->cpuBltCalled);
+}
+
+TEST_F(ImageCpuTiledTransferTest, givenImageLargerThanCpuTiledImageTransferMaxSizeWhenCheckingIfCpuTiledTransferIsPreferredThenReturnFalse) {
+    std::unique_ptr<Image> image(createImage());
+    ASSERT_NE(nullptr, image);
+    auto rootDeviceIndex = context.getDevice(0)->getRootDeviceIndex();
+    if (!image->isCpuTiledTransferPreferred(rootDeviceIndex)) {
+        GTEST_SKIP();
+    }
+
+    auto allocationSize = image->getGraphicsAllocation(rootDeviceIndex)->getUnderlyingBufferSize();
+    debugManager.flags.CpuTiledImageTransferMaxSize.set(static_cast<int32_t>(allocationSize / MemoryConstants::kiloByte));
+    EXPECT_EQ(allocationSize % MemoryConstants::kiloByte == 0, image->isCpuTiledTransferPreferred(rootDeviceIndex));
+
+    debugManager.flags.CpuTiledImageTransferMaxSize.set(static_cast<int32_t>(allocationSize / MemoryConstants::kiloByte) - 1);
+    EXPECT_FALSE(image->isCpuTiledTransferPreferred(rootDeviceIndex));
+}
+
+TEST_F(ImageCpuTiledTransferTest, givenFailingGmmCpuBltWhenWritingTiledImageOnCpuThenReturnFalse) {
+    std::unique_ptr<Image> image(createImage());
+    ASSERT_NE(nullptr, image);
+    auto rootDeviceIndex = context.getDevice(0)->getRootDeviceIndex();
+    if (image->getGraphicsAllocation(rootDeviceIndex)->getDefaultGmm() == nullptr) {
+        GTEST_SKIP();
+    }
+
+    auto mockResInfo = getMockGmmResourceInfo(*image);
+    size_t copyOrigin[3] = {0, 0, 0};
+    size_t copyRegion[3] = {16, 16, 1};
+    mockResInfo->cpuBltResult = 1u;
+    EXPECT_TRUE(image->writeTiledImageOnCpu(hostMemory, 16 * 4, 0, copyOrigin, copyRegion, rootDeviceIndex));
+    mockResInfo->cpuBltResult = 0u;
+    EXPECT_FALSE(image->writeTiledImageOnCpu(hostMemory, 16 * 4, 0, copyOrigin, copyRegion, rootDeviceIndex));
+}
+
 struct ImageConvertTypeTest
     : public ::testing::Test {
 
@@ -12,6 +12,7 @@
 #include "opencl/source/mem_obj/map_operations_handler.h"
 #include "opencl/test/unit_test/mocks/mock_buffer.h"
 
+#include <set>
 #include <tuple>
 
 using namespace NEO;
@@ -19,6 +20,7 @@ using namespace NEO;
 struct MockMapOperationsHandler : public MapOperationsHandler {
     using MapOperationsHandler::isOverlapping;
     using MapOperationsHandler::mappedPointers;
+    using MapOperationsHandler::maxMappedPtrLength;
 };
 
 struct MapOperationsHandlerTests : public ::testing::Test {
@@ -82,27 +84,27 @@ TEST_F(MapOperationsHandlerTests, givenMappedPtrsWhenDoubleRemovedThenDoNothing)
 TEST_F(MapOperationsHandlerTests, givenMapInfoWhenAddedThenSetReadOnlyFlag) {
     mapFlags = CL_MAP_READ;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 }
 
@@ -112,7 +114,7 @@ TEST_F(MapOperationsHandlerTests, givenNonReadOnlyOverlappingPtrWhenAddingThenRe
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     EXPECT_TRUE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_FALSE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
     EXPECT_EQ(1u, mockHandler.size());
@@ -124,11 +126,59 @@ TEST_F(MapOperationsHandlerTests, givenReadOnlyOverlappingPtrWhenAddingThenRetur
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     EXPECT_FALSE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_TRUE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
     EXPECT_EQ(2u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
+}
+
+TEST_F(MapOperationsHandlerTests, givenLongMappingFollowedByShortMappingsWhenFindingInfoForHostPtrThenLongMappingIsFound) {
+    MemObjSizeArray size = {{1, 1, 1}};
+    MemObjOffsetArray offset = {{0, 0, 0}};
+    mapFlags = CL_MAP_READ;
+
+    EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(0x10000), 0x10000, mapFlags, size, offset, 0, allocations[0].get()));
+    for (uintptr_t address = 0x10000; address < 0x20000; address += 0x1000) {
+        EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(address + 0x100), 0x10, mapFlags, size, offset, 0, allocations[1].get()));
+    }
+
+    MapInfo receivedMapInfo;
+    EXPECT_TRUE(mockHandler.findInfoForHostPtr(reinterpret_cast<void *>(0x1f800), 0x100, receivedMapInfo));
+    EXPECT_EQ(allocations[0].get(), receivedMapInfo.graphicsAllocation);
+
+    EXPECT_TRUE(mockHandler.findInfoForHostPtr(reinterpret_cast<void *>(0x1f104), 0x8, receivedMapInfo));
+
+    EXPECT_FALSE(mockHandler.findInfoForHostPtr(reinterpret_cast<void *>(0x1ff00), 0x200, receivedMapInfo));
+    EXPECT_FALSE(mockHandler.findInfoForHostPtr(reinterpret_cast<void *>(0xff00), 0x200, receivedMapInfo));
+
+    mapFlags = CL_MAP_WRITE;
+    EXPECT_FALSE(mockHandler.add(reinterpret_cast<void *>(0x1fff0), 0x100, mapFlags, size, offset, 0, allocations[2].get()));
+    EXPECT_TRUE(mockHandler.add(reinterpret_cast<void *>(0x20001), 0x100, mapFlags, size, offset, 0, allocations[2].get()));
+
+    mockHandler.remove(reinterpret_cast<void *>(0x10000));
+    EXPECT_FALSE(mockHandler.findInfoForHostPtr(reinterpret_cast<void *>(0x1f800), 0x100, receivedMapInfo));
+    EXPECT_TRUE(mockHandler.findInfoForHostPtr(reinterpret_cast<void *>(0x1f104), 0x8, receivedMapInfo));
+    EXPECT_EQ(allocations[1].get(), receivedMapInfo.graphicsAllocation);
+}
+
+TEST_F(MapOperationsHandlerTests, givenMultipleReadOnlyMappingsOfSamePtrWhenRemovingThenOneMappingIsRemovedAtATime) {
+    mapFlags = CL_MAP_READ;
+    EXPECT_TRUE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
+    EXPECT_TRUE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[1].get()));
+
+    MapInfo receivedMapInfo;
+    EXPECT_TRUE(mockHandler.find(mappedPtrs[0].ptr, receivedMapInfo));
+    EXPECT_EQ(allocations[0].get(), receivedMapInfo.graphicsAllocation);
+
+    mockHandler.remove(mappedPtrs[0].ptr);
+    EXPECT_EQ(1u, mockHandler.size());
+    EXPECT_TRUE(mockHandler.find(mappedPtrs[0].ptr, receivedMapInfo));
+    EXPECT_EQ(allocations[1].get(), receivedMapInfo.graphicsAllocation);
+
+    mockHandler.remove(mappedPtrs[0].ptr);
+    EXPECT_EQ(0u, mockHandler.size());
+    EXPECT_EQ(0u, mockHandler.maxMappedPtrLength);
 }
 
 const std::tuple<void *, size_t, void *, size_t, bool> overlappingCombinations[] = {
@@ -170,7 +220,16 @@ INSTANTIATE_TEST_SUITE_P(MapOperationsHandlerOverlapTests,
                          ::testing::ValuesIn(overlappingCombinations));
 
 struct MapOperationsStorageWhitebox : MapOperationsStorage {
-    using MapOperationsStorage::handlers;
+    using MapOperationsStorage::getShard;
+    using MapOperationsStorage::shards;
+
+    size_t getHandlersCount() {
+        size_t handlersCount = 0u;
+        for (auto &shard : shards) {
+            handlersCount += shard.handlers.size();
+        }
+        return handlersCount;
+    }
 };
 
 TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenGetHandlerIsUsedThenCreateHandler) {
@@ -178,16 +237,16 @@ TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenGetHandlerIsUsedThen
     MockBuffer buffer2{};
 
     MapOperationsStorageWhitebox storage{};
-    EXPECT_EQ(0u, storage.handlers.size());
+    EXPECT_EQ(0u, storage.getHandlersCount());
 
     storage.getHandler(&buffer1);
-    EXPECT_EQ(1u, storage.handlers.size());
+    EXPECT_EQ(1u, storage.getHandlersCount());
 
     storage.getHandler(&buffer2);
-    EXPECT_EQ(2u, storage.handlers.size());
+    EXPECT_EQ(2u, storage.getHandlersCount());
 
     storage.getHandler(&buffer1);
-    EXPECT_EQ(2u, storage.handlers.size());
+    EXPECT_EQ(2u, storage.getHandlersCount());
 }
 
 TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenGetHandlerIfExistsIsUsedThenDoNotCreateHandler) {
@@ -195,17 +254,17 @@ TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenGetHandlerIfExistsIs
     MockBuffer buffer2{};
 
     MapOperationsStorageWhitebox storage{};
-    EXPECT_EQ(0u, storage.handlers.size());
+    EXPECT_EQ(0u, storage.getHandlersCount());
     EXPECT_EQ(nullptr, storage.getHandlerIfExists(&buffer1));
     EXPECT_EQ(nullptr, storage.getHandlerIfExists(&buffer2));
 
     storage.getHandler(&buffer1);
-    EXPECT_EQ(1u, storage.handlers.size());
+    EXPECT_EQ(1u, storage.getHandlersCount());
     EXPECT_NE(nullptr, storage.getHandlerIfExists(&buffer1));
     EXPECT_EQ(nullptr, storage.getHandlerIfExists(&buffer2));
 
     storage.getHandler(&buffer2);
-    EXPECT_EQ(2u, storage.handlers.size());
+    EXPECT_EQ(2u, storage.getHandlersCount());
     EXPECT_NE(nullptr, storage.getHandlerIfExists(&buffer1));
     EXPECT_NE(nullptr, storage.getHandlerIfExists(&buffer2));
     EXPECT_NE(storage.getHandlerIfExists(&buffer1), storage.getHandlerIfExists(&buffer2));
@@ -216,8 +275,45 @@ TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenRemoveHandlerIsUsedT
     MapOperationsStorageWhitebox storage{};
 
     storage.getHandler(&buffer);
-    ASSERT_EQ(1u, storage.handlers.size());
+    ASSERT_EQ(1u, storage.getHandlersCount());
 
     storage.removeHandler(&buffer);
-    EXPECT_EQ(0u, storage.handlers.size());
+    EXPECT_EQ(0u, storage.getHandlersCount());
+}
+
+TEST(MapOperationsStorageTest, givenMultipleMemObjsWhenGettingHandlersThenHandlersAreSpreadAcrossShards) {
+    MapOperationsStorageWhitebox storage{};
+    std::set<void *> usedShards;
+
+    constexpr size_t memObjsCount = 64u;
+    constexpr size_t memObjSize = 0x200u;
+    for (size_t i = 0; i < memObjsCount; i++) {
+        auto memObj = reinterpret_cast<cl_mem>(0x10000 + i * memObjSize);
+        storage.getHandler(memObj);
+        usedShards.insert(&storage.getShard(memObj));
+        EXPECT_EQ(storage.getHandlerIfExists(memObj), &storage.getHandler(memObj));
+    }
+    EXPECT_EQ(memObjsCount, storage.getHandlersCount());
+    EXPECT_LT(1u, usedShards.size());
+}
+
+TEST(MapOperationsStorageTest, givenHandlersInDifferentShardsWhenGettingInfoForHostPtrThenAllHandlersAreSearched) {
+    MapOperationsStorageWhitebox storage{};
+    MockGraphicsAllocation allocation;
+    MemObjSizeArray size = {{1, 1, 1}};
+    MemObjOffsetArray offset = {{0, 0, 0}};
+    cl_map_flags mapFlags = CL_MAP_WRITE;
+
+    constexpr size_t memObjsCount = 64u;
+    for (size_t i = 0; i < memObjsCount; i++) {
+        auto memObj = reinterpret_cast<cl_mem>(0x10000 + i * 0x200u);
+        EXPECT_TRUE(storage.getHandler(memObj).add(reinterpret_cast<void *>(0x100000 + i * 0x1000), 0x100, mapFlags, size, offset, 0, &allocation));
+    }
+
+    MapInfo outInfo;
+    for (size_t i = 0; i < memObjsCount; i++) {
+        EXPECT_TRUE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x100010 + i * 0x1000), 0x10, outInfo));
+        EXPECT_EQ(reinterpret_cast<void *>(0x100000 + i * 0x1000), outInfo.ptr);
+    }
+    EXPECT_FALSE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x100800), 0x10, outInfo));
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@ class MockHandler : public AsyncEventsHandler {
     using AsyncEventsHandler::asyncMtx;
     using AsyncEventsHandler::asyncProcess;
     using AsyncEventsHandler::openThread;
+    using AsyncEventsHandler::submittedEvents;
     using AsyncEventsHandler::thread;
 
     ~MockHandler() override {
@@ -57,7 +58,7 @@ class MockHandler : public AsyncEventsHandler {
         openThreadCalled = true;
     }
 
-    bool peekIsListEmpty() { return list.size() == 0; }
+    bool peekIsListEmpty() { return isListEmpty(); }
     bool peekIsRegisterListEmpty() { return registerList.size() == 0; }
     std::atomic<int> transferCounter;
     bool openThreadCalled = false;
@@ -280,6 +280,7 @@ class MockCommandQueueHw : public CommandQueueHw<GfxFamily> {
     using BaseClass::gpgpuEngine;
     using BaseClass::heaplessModeEnabled;
     using BaseClass::heaplessStateInitEnabled;
+    using BaseClass::imageCpuWriteAllowed;
     using BaseClass::isBlitAuxTranslationRequired;
     using BaseClass::isCompleted;
     using BaseClass::latestSentEnqueueType;
@@ -131,6 +131,7 @@ class MockKernel : public Kernel {
     using Kernel::setInlineSamplers;
     using Kernel::singleSubdevicePreferredInCurrentEnqueue;
     using Kernel::unifiedMemoryControls;
+    using Kernel::updateArgsRequiringResidency;
 
     using Kernel::slmSizes;
     using Kernel::slmTotalSize;
@@ -232,6 +233,7 @@ class MockKernel : public Kernel {
 
     void setKernelArguments(std::vector<SimpleKernelArgInfo> kernelArguments) {
         this->kernelArguments = kernelArguments;
+        updateArgsRequiringResidency();
     }
 
     KernelInfo *getAllocatedKernelInfo() {
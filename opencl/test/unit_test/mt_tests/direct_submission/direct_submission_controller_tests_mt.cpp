@@ -32,6 +32,7 @@ TEST(DirectSubmissionControllerTestsMt, givenDirectSubmissionControllerWhenTimeo
     csr.taskCount.store(9u);
 
     DirectSubmissionControllerMock controller;
+    controller.callBaseGetCpuTimestamp = true;
     executionEnvironment.directSubmissionController.reset(&controller);
     controller.startThread();
     csr.startControllingDirectSubmissions();
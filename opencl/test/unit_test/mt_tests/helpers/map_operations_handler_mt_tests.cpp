@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,7 +21,7 @@ struct MockMapOperationsHandler : public MapOperationsHandler {
 };
 
 struct MockMapOperationsStorage : public MapOperationsStorage {
-    using MapOperationsStorage::handlers;
+    using MapOperationsStorage::shards;
 };
 
 struct MapOperationsHandlerMtTests : public ::testing::Test {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -101,7 +101,7 @@ AOT::PRODUCT_CONFIG OclocConcat::getAOTProductConfigFromBinary(ArrayRef<const ui
 }
 
 OclocConcat::ErrorCode OclocConcat::concatenate() {
-    NEO::Ar::ArEncoder arEncoder(true);
+    NEO::Ar::ArEncoder arEncoder(true, true);
     for (auto &fileName : fileNamesToConcat) {
         auto file = argHelper->readBinaryFile(fileName);
         auto fileRef = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(file.data()), file.size());
@@ -380,7 +380,7 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         return OCLOC_INVALID_COMMAND_LINE;
     }
 
-    Ar::ArEncoder fatbinary(true);
+    Ar::ArEncoder fatbinary(true, true);
     std::vector<ConstStringRef> targetProducts;
     targetProducts = getTargetProductsForFatbinary(ConstStringRef(args[deviceArgIndex]), argHelper);
     if (targetProducts.empty()) {
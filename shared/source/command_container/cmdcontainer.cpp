@@ -138,7 +138,7 @@ CommandContainer::ErrorCode CommandContainer::initialize(Device *device, Allocat
             if (!allocationIndirectHeaps[i]) {
                 return ErrorCode::outOfDeviceMemory;
             }
-            residencyContainer.push_back(allocationIndirectHeaps[i]);
+            addToResidencyContainer(allocationIndirectHeaps[i]);
 
             bool requireInternalHeap = false;
             if (IndirectHeap::Type::indirectObject == heapType) {
@@ -166,6 +166,19 @@ void CommandContainer::addToResidencyContainer(GraphicsAllocation *alloc) {
         return;
     }
 
+    if (this->residencyContainer.empty()) {
+        // container was cleared, all recorded positions are stale
+        this->residencyPositions.clear();
+    }
+
+    auto position = this->residencyContainer.size();
+    auto [entry, inserted] = this->residencyPositions.try_emplace(alloc, position);
+    if (!inserted) {
+        if (entry->second < position && this->residencyContainer[entry->second] == alloc) {
+            return;
+        }
+        entry->second = position;
+    }
     this->residencyContainer.push_back(alloc);
 }
 
@@ -178,8 +191,17 @@ bool CommandContainer::swapStreams() {
 }
 
 void CommandContainer::removeDuplicatesFromResidencyContainer() {
-    std::sort(this->residencyContainer.begin(), this->residencyContainer.end());
-    this->residencyContainer.erase(std::unique(this->residencyContainer.begin(), this->residencyContainer.end()), this->residencyContainer.end());
+    // Entries added by addToResidencyContainer are already unique; this single pass only catches
+    // allocations pushed directly and rebuilds recorded positions.
+    this->residencyPositions.clear();
+    size_t uniqueCount = 0u;
+    for (auto alloc : this->residencyContainer) {
+        if (alloc == nullptr || !this->residencyPositions.try_emplace(alloc, uniqueCount).second) {
+            continue;
+        }
+        this->residencyContainer[uniqueCount++] = alloc;
+    }
+    this->residencyContainer.resize(uniqueCount);
 }
 
 void CommandContainer::reset() {
@@ -295,7 +317,7 @@ void CommandContainer::createAndAssignNewHeap(HeapType heapType, size_t size) {
     indirectHeap->replaceBuffer(newAlloc->getUnderlyingBuffer(),
                                 newAlloc->getUnderlyingBufferSize());
     auto newBase = indirectHeap->getHeapGpuBase();
-    getResidencyContainer().push_back(newAlloc);
+    addToResidencyContainer(newAlloc);
     if (this->immediateCmdListCsr) {
         this->storeAllocationAndFlushTagUpdate(oldAlloc);
     } else {
@@ -393,7 +415,7 @@ void CommandContainer::prepareBindfulSsh() {
                                                                                                       defaultHeapAllocationAlignment,
                                                                                                       device->getRootDeviceIndex());
             UNRECOVERABLE_IF(!allocationIndirectHeaps[IndirectHeap::Type::surfaceState]);
-            residencyContainer.push_back(allocationIndirectHeaps[IndirectHeap::Type::surfaceState]);
+            addToResidencyContainer(allocationIndirectHeaps[IndirectHeap::Type::surfaceState]);
 
             indirectHeaps[IndirectHeap::Type::surfaceState] = std::make_unique<IndirectHeap>(allocationIndirectHeaps[IndirectHeap::Type::surfaceState], false);
             indirectHeaps[IndirectHeap::Type::surfaceState]->getSpace(reservedSshSize);
@@ -528,12 +550,12 @@ void CommandContainer::fillReusableAllocationLists() {
     for (auto i = 0u; i < amountToFill; i++) {
         auto allocToReuse = obtainNextCommandBufferAllocation();
         this->immediateReusableAllocationList->pushTailOne(*allocToReuse);
-        this->getResidencyContainer().push_back(allocToReuse);
+        addToResidencyContainer(allocToReuse);
 
         if (this->useSecondaryCommandStream) {
             auto hostAllocToReuse = obtainNextCommandBufferAllocation(true);
             this->immediateReusableAllocationList->pushTailOne(*hostAllocToReuse);
-            this->getResidencyContainer().push_back(hostAllocToReuse);
+            addToResidencyContainer(hostAllocToReuse);
         }
     }
 
@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
@@ -223,6 +224,9 @@ class CommandContainer : public NonCopyableOrMovableClass {
 
     CmdBufferContainer cmdBufferAllocations;
     ResidencyContainer residencyContainer;
+    // position of each allocation added to this container's residency, kept per container so sharing allocations
+    // between containers does not invalidate it; entry is trusted only if residencyContainer still holds allocation there
+    std::unordered_map<const GraphicsAllocation *, size_t> residencyPositions;
     std::vector<GraphicsAllocation *> deallocationContainer;
     HeapContainer sshAllocations;
 
@@ -140,6 +140,9 @@ SubmissionStatus CommandStreamReceiver::submitBatchBuffer(BatchBuffer &batchBuff
         this->latestFlushedTaskCount = taskCount + 1;
     }
     taskCount++;
+    if (this->isAnyDirectSubmissionEnabled()) {
+        this->notifyDirectSubmissionController();
+    }
 
     return retVal;
 }
@@ -647,6 +650,17 @@ void CommandStreamReceiver::startControllingDirectSubmissions() {
     }
 }
 
+void CommandStreamReceiver::notifyDirectSubmissionController() {
+    this->lastDirectSubmissionNotifyTimestamp.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+    if (this->directSubmissionDeadlineArmed.load(std::memory_order_relaxed) || this->directSubmissionDeadlineArmed.exchange(true)) {
+        return;
+    }
+    auto controller = this->executionEnvironment.directSubmissionController.get();
+    if (controller) {
+        controller->notifySubmission(this);
+    }
+}
+
 GraphicsAllocation *CommandStreamReceiver::allocateDebugSurface(size_t size) {
     UNRECOVERABLE_IF(debugSurface != nullptr);
     if (primaryCsr) {
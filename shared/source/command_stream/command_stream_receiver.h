@@ -22,6 +22,7 @@
 #include "aubstream/allocation_params.h"
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -31,6 +32,7 @@ namespace NEO {
 enum class AllocationType;
 enum class DebugPauseState : uint32_t;
 struct BatchBuffer;
+struct DirectSubmissionTelemetry;
 struct HardwareInfo;
 struct WaitParams;
 class SubmissionAggregator;
@@ -347,6 +349,11 @@ class CommandStreamReceiver {
     uint32_t getRootDeviceIndex() const { return rootDeviceIndex; }
 
     MOCKABLE_VIRTUAL void startControllingDirectSubmissions();
+    void notifyDirectSubmissionController();
+    void setDirectSubmissionDeadlineArmed(bool armed) { directSubmissionDeadlineArmed.store(armed); }
+    std::chrono::steady_clock::time_point getLastDirectSubmissionNotifyTimestamp() const {
+        return std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(lastDirectSubmissionNotifyTimestamp.load(std::memory_order_relaxed)));
+    }
 
     bool isAnyDirectSubmissionEnabled() {
         return this->isDirectSubmissionEnabled() || isBlitterDirectSubmissionEnabled();
@@ -368,6 +375,10 @@ class CommandStreamReceiver {
         return false;
     }
 
+    virtual const DirectSubmissionTelemetry *getDirectSubmissionTelemetry() const {
+        return nullptr;
+    }
+
     virtual bool isKmdWaitOnTaskCountAllowed() const {
         return false;
     }
@@ -613,6 +624,10 @@ class CommandStreamReceiver {
     std::atomic<TaskCountType> taskCount{0};
 
     std::atomic<uint32_t> numClients = 0u;
+    // set while the direct submission controller holds an idle deadline for this CSR
+    std::atomic_bool directSubmissionDeadlineArmed{false};
+    // steady clock ticks of the latest submission notified to the direct submission controller
+    std::atomic<std::chrono::steady_clock::rep> lastDirectSubmissionNotifyTimestamp{0};
 
     DispatchMode dispatchMode = DispatchMode::immediateDispatch;
     SamplerCacheFlushState samplerCacheFlushRequired = SamplerCacheFlushState::samplerCacheFlushNotRequired;
@@ -157,6 +157,8 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
 
     bool directSubmissionRelaxedOrderingEnabled() const override;
 
+    const DirectSubmissionTelemetry *getDirectSubmissionTelemetry() const override;
+
     void stopDirectSubmission(bool blocking) override;
 
     QueueThrottle getLastDirectSubmissionThrottle() override;
@@ -616,7 +616,10 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
 
     auto &commandBufferList = this->submissionAggregator->peekCmdBufferList();
     if (!commandBufferList.peekIsEmpty()) {
-        const auto totalMemoryBudget = static_cast<size_t>(commandBufferList.peekHead()->device.getDeviceInfo().globalMemSize / 2);
+        auto totalMemoryBudget = static_cast<size_t>(commandBufferList.peekHead()->device.getDeviceInfo().globalMemSize / 2);
+        if (debugManager.flags.BatchedSubmissionsMemoryBudget.get() != -1) {
+            totalMemoryBudget = static_cast<size_t>(debugManager.flags.BatchedSubmissionsMemoryBudget.get()) * MemoryConstants::megaByte;
+        }
 
         ResidencyContainer surfacesForSubmit;
         ResourcePackage resourcePackage;
@@ -710,6 +713,9 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
                 submitResult = false;
                 break;
             }
+            if (this->isAnyDirectSubmissionEnabled()) {
+                this->notifyDirectSubmissionController();
+            }
 
             // after flush task level is closed
             this->taskLevel++;
@@ -1140,6 +1146,9 @@ TaskCountType CommandStreamReceiverHw<GfxFamily>::flushBcsTask(const BlitPropert
     }
 
     taskCount = newTaskCount;
+    if (this->isAnyDirectSubmissionEnabled()) {
+        this->notifyDirectSubmissionController();
+    }
     auto flushStampToWait = flushStamp->peekStamp();
 
     lock.unlock();
@@ -1277,6 +1286,9 @@ template <typename GfxFamily>
 inline SubmissionStatus CommandStreamReceiverHw<GfxFamily>::flushHandler(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) {
     auto status = flush(batchBuffer, allocationsForResidency);
     makeSurfacePackNonResident(allocationsForResidency, true);
+    if (this->isAnyDirectSubmissionEnabled()) {
+        this->notifyDirectSubmissionController();
+    }
     return status;
 }
 
@@ -1526,6 +1538,17 @@ bool CommandStreamReceiverHw<GfxFamily>::directSubmissionRelaxedOrderingEnabled(
             (blitterDirectSubmission.get() && blitterDirectSubmission->isRelaxedOrderingEnabled()));
 }
 
+template <typename GfxFamily>
+const DirectSubmissionTelemetry *CommandStreamReceiverHw<GfxFamily>::getDirectSubmissionTelemetry() const {
+    if (blitterDirectSubmission.get()) {
+        return blitterDirectSubmission->getTelemetry();
+    }
+    if (directSubmission.get()) {
+        return directSubmission->getTelemetry();
+    }
+    return nullptr;
+}
+
 template <typename GfxFamily>
 inline void CommandStreamReceiverHw<GfxFamily>::handleStateBaseAddressStateTransition(const DispatchFlags &dispatchFlags, bool &isStateBaseAddressDirty) {
     auto &rootDeviceEnvironment = this->peekRootDeviceEnvironment();
@@ -2246,6 +2269,13 @@ inline void CommandStreamReceiverHw<GfxFamily>::handleBatchedDispatchImplicitFlu
         }
     }
 
+    if (debugManager.flags.BatchedSubmissionsLatencyCap.get() != -1) {
+        const auto latencyCap = std::chrono::microseconds(debugManager.flags.BatchedSubmissionsLatencyCap.get());
+        if (this->submissionAggregator->isLatencyCapExceeded(latencyCap, std::chrono::steady_clock::now())) {
+            implicitFlush = true;
+        }
+    }
+
     if (this->newResources) {
         implicitFlush = true;
         this->newResources = false;
@@ -7,13 +7,27 @@
 
 #include "submissions_aggregator.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 
 void NEO::SubmissionAggregator::recordCommandBuffer(CommandBuffer *commandBuffer) {
+    // record time is needed only for latency cap, don't query clock on every enqueue otherwise
+    if (debugManager.flags.BatchedSubmissionsLatencyCap.get() != -1) {
+        commandBuffer->recordTime = std::chrono::steady_clock::now();
+    }
     this->cmdBuffers.pushTailOne(*commandBuffer);
 }
 
+bool NEO::SubmissionAggregator::isLatencyCapExceeded(std::chrono::microseconds latencyCap, std::chrono::steady_clock::time_point now) {
+    // head of the list is the oldest recorded command buffer
+    auto oldestCommandBuffer = this->cmdBuffers.peekHead();
+    if (!oldestCommandBuffer) {
+        return false;
+    }
+    return now - oldestCommandBuffer->recordTime >= latencyCap;
+}
+
 void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId) {
     auto primaryCommandBuffer = this->cmdBuffers.peekHead();
     auto currentInspection = this->inspectionId;
@@ -12,6 +12,7 @@
 #include "shared/source/helpers/pipe_control_args.h"
 #include "shared/source/utilities/idlist.h"
 
+#include <chrono>
 #include <vector>
 namespace NEO {
 class Device;
@@ -74,6 +75,7 @@ struct CommandBuffer : public IDNode<CommandBuffer> {
     void *epiloguePipeControlLocation = nullptr;
     PipeControlArgs epiloguePipeControlArgs;
     std::unique_ptr<FlushStampTracker> flushStamp;
+    std::chrono::steady_clock::time_point recordTime{};
     Device &device;
 };
 
@@ -85,6 +87,7 @@ class SubmissionAggregator {
   public:
     void recordCommandBuffer(CommandBuffer *commandBuffer);
     void aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId);
+    bool isLatencyCapExceeded(std::chrono::microseconds latencyCap, std::chrono::steady_clock::time_point now);
     CommandBufferList &peekCmdBufferList() { return cmdBuffers; }
 
   protected:
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_build_scheduler.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/string.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+CompilerBuildScheduler::CompilerBuildScheduler(uint32_t maxConcurrentBuilds) : maxConcurrentBuilds(std::max(maxConcurrentBuilds, 1u)) {
+}
+
+TranslationOutput::ErrorCode CompilerBuildScheduler::build(const std::string &buildKey, TranslationOutput &output, const BuildFunctionT &buildFunction) {
+    std::unique_lock<std::mutex> lock(mtx);
+
+    std::shared_ptr<InFlightBuild> inFlightBuild;
+    if (false == buildKey.empty()) {
+        auto it = inFlightBuilds.find(buildKey);
+        if (it != inFlightBuilds.end()) {
+            auto joinedBuild = it->second;
+            ++joinedBuild->waitersCount;
+            ++statistics.buildsDeduplicated;
+            buildCompleted.wait(lock, [&joinedBuild] { return joinedBuild->completed; });
+            copyTranslationOutput(output, joinedBuild->output);
+            return joinedBuild->result;
+        }
+        inFlightBuild = std::make_shared<InFlightBuild>();
+        inFlightBuilds.insert({buildKey, inFlightBuild});
+    }
+
+    auto queueStart = std::chrono::steady_clock::now();
+    ++statistics.buildsQueued;
+    statistics.maxBuildsQueued = std::max(statistics.maxBuildsQueued, statistics.buildsQueued);
+    buildSlotReleased.wait(lock, [this] { return statistics.buildsActive < maxConcurrentBuilds; });
+    --statistics.buildsQueued;
+    ++statistics.buildsActive;
+    auto buildStart = std::chrono::steady_clock::now();
+    statistics.totalQueueTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(buildStart - queueStart).count();
+    lock.unlock();
+
+    auto result = buildFunction(output);
+
+    auto buildEnd = std::chrono::steady_clock::now();
+    lock.lock();
+    --statistics.buildsActive;
+    ++statistics.buildsExecuted;
+    statistics.totalBuildTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(buildEnd - buildStart).count();
+
+    if (inFlightBuild) {
+        if (inFlightBuild->waitersCount > 0u) {
+            copyTranslationOutput(inFlightBuild->output, output);
+        }
+        inFlightBuild->result = result;
+        inFlightBuild->completed = true;
+        inFlightBuilds.erase(buildKey);
+        buildCompleted.notify_all();
+    }
+    buildSlotReleased.notify_one();
+    return result;
+}
+
+CompilerBuildStatistics CompilerBuildScheduler::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return statistics;
+}
+
+std::string CompilerBuildScheduler::getBuildKey(const Device &device, const TranslationInput &input) {
+    if (input.gtPinInput != nullptr) {
+        return {};
+    }
+
+    Hash hash;
+    const Device *devicePtr = &device;
+    hash.update(reinterpret_cast<const char *>(&devicePtr), sizeof(devicePtr));
+    hash.update(reinterpret_cast<const char *>(&input.srcType), sizeof(input.srcType));
+    hash.update(reinterpret_cast<const char *>(&input.preferredIntermediateType), sizeof(input.preferredIntermediateType));
+    hash.update(reinterpret_cast<const char *>(&input.outType), sizeof(input.outType));
+    hash.update(reinterpret_cast<const char *>(&input.allowCaching), sizeof(input.allowCaching));
+    hash.update("----", 4);
+    if (input.preparedSrc) {
+        auto preparedSrcDigest = input.preparedSrc->getDigest();
+        hash.update(preparedSrcDigest.c_str(), preparedSrcDigest.size());
+    } else {
+        hash.update(input.src.begin(), input.src.size());
+    }
+    hash.update("----", 4);
+    hash.update(input.apiOptions.begin(), input.apiOptions.size());
+    hash.update("----", 4);
+    hash.update(input.internalOptions.begin(), input.internalOptions.size());
+    hash.update("----", 4);
+    if (input.tracingOptions) {
+        hash.update(input.tracingOptions, input.tracingOptionsCount);
+    }
+    hash.update(reinterpret_cast<const char *>(&input.tracingOptionsCount), sizeof(input.tracingOptionsCount));
+    hash.update("----", 4);
+
+    std::vector<std::pair<uint32_t, uint64_t>> specializedValues(input.specializedValues.begin(), input.specializedValues.end());
+    std::sort(specializedValues.begin(), specializedValues.end());
+    for (const auto &specConst : specializedValues) {
+        hash.update(reinterpret_cast<const char *>(&specConst.first), sizeof(specConst.first));
+        hash.update(reinterpret_cast<const char *>(&specConst.second), sizeof(specConst.second));
+    }
+
+    auto res = hash.finish();
+    return std::to_string(res) + "_" + std::to_string(input.src.size());
+}
+
+uint32_t CompilerBuildScheduler::getDefaultMaxConcurrentBuilds() {
+    if (debugManager.flags.CompilerMaxConcurrentBuilds.get() > 0) {
+        return static_cast<uint32_t>(debugManager.flags.CompilerMaxConcurrentBuilds.get());
+    }
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+void CompilerBuildScheduler::copyTranslationOutput(TranslationOutput &dst, const TranslationOutput &src) {
+    auto copyMemAndSize = [](TranslationOutput::MemAndSize &dst, const TranslationOutput::MemAndSize &src) {
+        dst.size = src.size;
+        if (src.mem && src.size > 0u) {
+            dst.mem = ::makeCopy(src.mem.get(), src.size);
+        } else {
+            dst.mem.reset();
+        }
+    };
+    dst.intermediateCodeType = src.intermediateCodeType;
+    copyMemAndSize(dst.intermediateRepresentation, src.intermediateRepresentation);
+    copyMemAndSize(dst.deviceBinary, src.deviceBinary);
+    copyMemAndSize(dst.debugData, src.debugData);
+    dst.frontendCompilerLog = src.frontendCompilerLog;
+    dst.backendCompilerLog = src.backendCompilerLog;
+}
+
+} // namespace NEO
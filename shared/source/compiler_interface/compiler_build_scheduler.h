@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/compiler_interface/compiler_interface.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace NEO {
+class Device;
+
+struct CompilerBuildStatistics {
+    uint64_t buildsExecuted = 0u;
+    uint64_t buildsDeduplicated = 0u;
+    uint32_t buildsQueued = 0u;
+    uint32_t buildsActive = 0u;
+    uint32_t maxBuildsQueued = 0u;
+    uint64_t totalQueueTimeNs = 0u;
+    uint64_t totalBuildTimeNs = 0u;
+};
+
+// Limits number of concurrently executed compilations and joins identical in-flight builds,
+// so threads requesting the same binary wait for a single compilation.
+// Builds are executed on requesting threads, since these are blocked until the build completes anyway.
+class CompilerBuildScheduler : NonCopyableOrMovableClass {
+  public:
+    using BuildFunctionT = std::function<TranslationOutput::ErrorCode(TranslationOutput &)>;
+
+    explicit CompilerBuildScheduler(uint32_t maxConcurrentBuilds);
+
+    // empty buildKey disables joining with other in-flight builds
+    TranslationOutput::ErrorCode build(const std::string &buildKey, TranslationOutput &output, const BuildFunctionT &buildFunction);
+
+    CompilerBuildStatistics getStatistics() const;
+
+    uint32_t getMaxConcurrentBuilds() const {
+        return maxConcurrentBuilds;
+    }
+
+    // returns empty key for inputs which can't be shared between builds
+    static std::string getBuildKey(const Device &device, const TranslationInput &input);
+    static uint32_t getDefaultMaxConcurrentBuilds();
+    static void copyTranslationOutput(TranslationOutput &dst, const TranslationOutput &src);
+
+  protected:
+    struct InFlightBuild {
+        TranslationOutput output;
+        TranslationOutput::ErrorCode result = TranslationOutput::ErrorCode::unknownError;
+        uint32_t waitersCount = 0u;
+        bool completed = false;
+    };
+
+    const uint32_t maxConcurrentBuilds;
+    CompilerBuildStatistics statistics;
+    std::unordered_map<std::string, std::shared_ptr<InFlightBuild>> inFlightBuilds;
+    mutable std::mutex mtx;
+    std::condition_variable buildSlotReleased;
+    std::condition_variable buildCompleted;
+};
+
+} // namespace NEO
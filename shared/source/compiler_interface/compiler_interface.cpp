@@ -8,15 +8,18 @@
 #include "shared/source/compiler_interface/compiler_interface.h"
 
 #include "shared/source/built_ins/sip_kernel_type.h"
+#include "shared/source/compiler_interface/compiler_build_scheduler.h"
 #include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/compiler_interface/compiler_interface.inl"
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/compiler_interface/igc_platform_helper.h"
+#include "shared/source/compiler_interface/oclc_include_dependencies.h"
 #include "shared/source/compiler_interface/os_compiler_cache_helper.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
 #include "shared/source/helpers/compiler_product_helper.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/os_interface/os_inc_base.h"
 
@@ -36,6 +39,7 @@ SpinLock CompilerInterface::spinlock;
 enum CachingMode {
     None,
     Direct,
+    DirectWithIncludes,
     PreProcess
 };
 
@@ -51,7 +55,7 @@ void TranslationOutput::makeCopy(MemAndSize &dst, CIF::Builtins::BufferSimple *s
 }
 
 CompilerInterface::CompilerInterface()
-    : cache() {
+    : cache(), buildScheduler(std::make_unique<CompilerBuildScheduler>(CompilerBuildScheduler::getDefaultMaxConcurrentBuilds())) {
 }
 CompilerInterface::~CompilerInterface() = default;
 
@@ -63,6 +67,19 @@ TranslationOutput::ErrorCode CompilerInterface::build(
         return TranslationOutput::ErrorCode::compilerNotAvailable;
     }
 
+    return buildScheduler->build(CompilerBuildScheduler::getBuildKey(device, input), output, [this, &device, &input](TranslationOutput &buildOutput) {
+        return this->buildImpl(device, input, buildOutput);
+    });
+}
+
+CompilerBuildStatistics CompilerInterface::getBuildStatistics() const {
+    return buildScheduler->getStatistics();
+}
+
+TranslationOutput::ErrorCode CompilerInterface::buildImpl(
+    const NEO::Device &device,
+    const TranslationInput &input,
+    TranslationOutput &output) {
     IGC::CodeType::CodeType_t srcCodeType = input.srcType;
     IGC::CodeType::CodeType_t intermediateCodeType = IGC::CodeType::undefined;
 
@@ -75,17 +92,43 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     if (cache != nullptr && cache->getConfig().enabled) {
         if ((srcCodeType == IGC::CodeType::oclC) && (std::strstr(input.src.begin(), "#include") == nullptr)) {
             cachingMode = CachingMode::Direct;
+        } else if ((srcCodeType == IGC::CodeType::oclC) && (0 != debugManager.flags.EnableIncludeAwareDirectCaching.get())) {
+            cachingMode = CachingMode::DirectWithIncludes;
         } else {
             cachingMode = CachingMode::PreProcess;
         }
     }
 
     std::string kernelFileHash;
-    if (cachingMode == CachingMode::Direct) {
+    std::string includesManifestHash;
+    OclcIncludeDependencies includeDependencies;
+    if (cachingMode == CachingMode::DirectWithIncludes) {
+        includesManifestHash = OclcIncludeDependencies::getManifestCacheKey(cache->getCachedFileName(device.getHardwareInfo(),
+                                                                                                     input.src,
+                                                                                                     input.apiOptions,
+                                                                                                     input.internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igcRevision, igcLibSize, igcLibMTime));
+
+        // manifest saves rescanning included files, it's valid as long as none of recorded files changed
+        size_t manifestSize = 0u;
+        auto manifest = cache->loadCachedBinary(includesManifestHash, manifestSize);
+        bool manifestValid = (nullptr != manifest) &&
+                             includeDependencies.deserialize(ArrayRef<const char>(manifest.get(), manifestSize)) &&
+                             includeDependencies.isUpToDate();
+        if ((false == manifestValid) && (false == includeDependencies.collect(input.src, input.apiOptions, input.internalOptions))) {
+            cachingMode = CachingMode::PreProcess;
+        }
+    }
+
+    if ((cachingMode == CachingMode::Direct) || (cachingMode == CachingMode::DirectWithIncludes)) {
+        // OpenCL C sources have no specialization constants, digest of included files takes their place in the key
+        std::string includesDigest;
+        if (cachingMode == CachingMode::DirectWithIncludes) {
+            includesDigest = includeDependencies.getDigest();
+        }
         kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(),
                                                   input.src,
                                                   input.apiOptions,
-                                                  input.internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igcRevision, igcLibSize, igcLibMTime);
+                                                  input.internalOptions, ArrayRef<const char>(includesDigest.c_str(), includesDigest.size()), ArrayRef<const char>(), igcRevision, igcLibSize, igcLibMTime);
 
         bool success = CompilerCacheHelper::loadCacheAndSetOutput(*cache, kernelFileHash, output, device);
         if (success) {
@@ -137,7 +180,14 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     }
 
     if (cachingMode == CachingMode::PreProcess) {
-        const ArrayRef<const char> irRef(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>());
+        ArrayRef<const char> irRef(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>());
+        std::string preparedSrcDigest;
+        if ((srcCodeType == IGC::CodeType::spirV) && input.preparedSrc) {
+            // SPIR-V was hashed when it was prepared, avoid rehashing it for each specialization constants variant
+            DEBUG_BREAK_IF(input.preparedSrc->size != input.src.size());
+            preparedSrcDigest = input.preparedSrc->getDigest();
+            irRef = ArrayRef<const char>(preparedSrcDigest.c_str(), preparedSrcDigest.size());
+        }
         const ArrayRef<const char> specIdsRef(idsBuffer->GetMemory<char>(), idsBuffer->GetSize<char>());
         const ArrayRef<const char> specValuesRef(valuesBuffer->GetMemory<char>(), valuesBuffer->GetSize<char>());
         kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(), irRef,
@@ -169,7 +219,15 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     TranslationOutput::makeCopy(output.debugData, igcOutput->GetDebugData());
 
     if (cache != nullptr && cache->getConfig().enabled) {
+        if ((cachingMode == CachingMode::DirectWithIncludes) && (false == includeDependencies.isUpToDate())) {
+            // included file was modified during build, binary may not match the key
+            return TranslationOutput::ErrorCode::success;
+        }
         CompilerCacheHelper::packAndCacheBinary(*cache, kernelFileHash, NEO::getTargetDevice(device.getRootDeviceEnvironment()), output);
+        if (cachingMode == CachingMode::DirectWithIncludes) {
+            auto manifest = includeDependencies.serialize();
+            cache->cacheBinary(includesManifestHash, manifest.c_str(), manifest.size());
+        }
     }
 
     return TranslationOutput::ErrorCode::success;
@@ -268,6 +326,38 @@ TranslationOutput::ErrorCode CompilerInterface::link(
     return TranslationOutput::ErrorCode::success;
 }
 
+std::shared_ptr<const PreparedSpirV> CompilerInterface::prepareSpirV(const NEO::Device &device, ArrayRef<const char> srcSpirV) {
+    auto hash = Hash::hash(srcSpirV.begin(), srcSpirV.size());
+    auto key = std::make_tuple(device.getRootDeviceIndex(), hash, srcSpirV.size());
+    {
+        std::lock_guard<std::mutex> lock(preparedSpirVsMtx);
+        auto it = preparedSpirVs.find(key);
+        if (it != preparedSpirVs.end()) {
+            return it->second;
+        }
+    }
+
+    SpecConstantInfo specConstInfo;
+    if (TranslationOutput::ErrorCode::success != this->getSpecConstantsInfo(device, srcSpirV, specConstInfo)) {
+        return nullptr;
+    }
+
+    auto preparedSpirV = std::make_shared<PreparedSpirV>();
+    preparedSpirV->hash = hash;
+    preparedSpirV->size = srcSpirV.size();
+    auto idsCount = specConstInfo.idsBuffer->GetSize<uint32_t>();
+    auto sizesCount = specConstInfo.sizesBuffer->GetSize<uint32_t>();
+    preparedSpirV->specConstantsIds.assign(specConstInfo.idsBuffer->GetMemory<uint32_t>(), specConstInfo.idsBuffer->GetMemory<uint32_t>() + idsCount);
+    preparedSpirV->specConstantsSizes.assign(specConstInfo.sizesBuffer->GetMemory<uint32_t>(), specConstInfo.sizesBuffer->GetMemory<uint32_t>() + sizesCount);
+
+    std::lock_guard<std::mutex> lock(preparedSpirVsMtx);
+    if (preparedSpirVs.size() >= maxPreparedSpirVsCount) {
+        preparedSpirVs.clear();
+    }
+    preparedSpirVs[key] = preparedSpirV;
+    return preparedSpirV;
+}
+
 TranslationOutput::ErrorCode CompilerInterface::getSpecConstantsInfo(const NEO::Device &device, ArrayRef<const char> srcSpirV, SpecConstantInfo &output) {
     if (false == isIgcAvailable()) {
         return TranslationOutput::ErrorCode::compilerNotAvailable;
@@ -568,6 +658,13 @@ bool CompilerInterface::disableZebin(std::string &options, std::string &internal
     return addOptionDisableZebin(options, internalOptions);
 }
 
+CompilerCache *CompilerInterface::getEnabledCache() const {
+    if ((nullptr == cache) || (false == cache->getConfig().enabled)) {
+        return nullptr;
+    }
+    return cache.get();
+}
+
 template bool CompilerInterface::checkIcbeVersionOnce<IGC::FclOclDeviceCtx>(CIF::CIFMain *main, const char *libName);
 template bool CompilerInterface::checkIcbeVersionOnce<IGC::IgcOclDeviceCtx>(CIF::CIFMain *main, const char *libName);
 
@@ -15,17 +15,37 @@
 #include "ocl_igc_interface/igc_ocl_device_ctx.h"
 
 #include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 namespace NEO {
 enum class SipKernelType : std::uint32_t;
 class OsLibrary;
+class CompilerBuildScheduler;
 class CompilerCache;
 class Device;
 struct TargetDevice;
 
 using specConstValuesMap = std::unordered_map<uint32_t, uint64_t>;
 
+// SPIR-V hashed and queried for specialization constants once, so that building its variants
+// with different specialization constant values doesn't require processing whole SPIR-V again
+struct PreparedSpirV {
+    uint64_t hash = 0u;
+    size_t size = 0u;
+    std::vector<uint32_t> specConstantsIds;
+    std::vector<uint32_t> specConstantsSizes;
+
+    // short replacement of the SPIR-V in cache keys
+    std::string getDigest() const {
+        return "spirv:" + std::to_string(hash) + ":" + std::to_string(size);
+    }
+};
+
 struct TranslationInput {
     TranslationInput(IGC::CodeType::CodeType_t srcType, IGC::CodeType::CodeType_t outType, IGC::CodeType::CodeType_t preferredIntermediateType = IGC::CodeType::undefined)
         : srcType(srcType), preferredIntermediateType(preferredIntermediateType), outType(outType) {
@@ -42,6 +62,7 @@ struct TranslationInput {
     IGC::CodeType::CodeType_t preferredIntermediateType = IGC::CodeType::invalid;
     IGC::CodeType::CodeType_t outType = IGC::CodeType::invalid;
     void *gtPinInput = nullptr;
+    const PreparedSpirV *preparedSrc = nullptr; // optional, describes src
 
     specConstValuesMap specializedValues;
 };
@@ -81,6 +102,8 @@ struct TranslationOutput {
     static void makeCopy(MemAndSize &dst, CIF::Builtins::BufferSimple *src);
 };
 
+struct CompilerBuildStatistics;
+
 struct SpecConstantInfo {
     CIF::RAII::UPtr_t<CIF::Builtins::BufferLatest> idsBuffer;
     CIF::RAII::UPtr_t<CIF::Builtins::BufferLatest> sizesBuffer;
@@ -120,6 +143,9 @@ class CompilerInterface {
     MOCKABLE_VIRTUAL TranslationOutput::ErrorCode getSpecConstantsInfo(const NEO::Device &device,
                                                                        ArrayRef<const char> srcSpirV, SpecConstantInfo &output);
 
+    // returns nullptr when specialization constants info could not be obtained
+    std::shared_ptr<const PreparedSpirV> prepareSpirV(const NEO::Device &device, ArrayRef<const char> srcSpirV);
+
     TranslationOutput::ErrorCode createLibrary(NEO::Device &device,
                                                const TranslationInput &input,
                                                TranslationOutput &output);
@@ -132,7 +158,15 @@ class CompilerInterface {
     bool addOptionDisableZebin(std::string &options, std::string &internalOptions);
     bool disableZebin(std::string &options, std::string &internalOptions);
 
+    CompilerCache *getEnabledCache() const;
+
+    CompilerBuildStatistics getBuildStatistics() const;
+
   protected:
+    MOCKABLE_VIRTUAL TranslationOutput::ErrorCode buildImpl(const NEO::Device &device,
+                                                            const TranslationInput &input,
+                                                            TranslationOutput &output);
+
     MOCKABLE_VIRTUAL bool initialize(std::unique_ptr<CompilerCache> &&cache, bool requireFcl);
     MOCKABLE_VIRTUAL bool loadFcl();
     MOCKABLE_VIRTUAL bool loadIgc();
@@ -150,6 +184,12 @@ class CompilerInterface {
         return std::unique_lock<SpinLock>{spinlock};
     }
     std::unique_ptr<CompilerCache> cache;
+    std::unique_ptr<CompilerBuildScheduler> buildScheduler;
+
+    static constexpr size_t maxPreparedSpirVsCount = 1024u;
+    // keyed by root device index rather than Device pointer - entries outlive devices and addresses of destroyed devices may be reused
+    std::map<std::tuple<uint32_t, uint64_t, size_t>, std::shared_ptr<const PreparedSpirV>> preparedSpirVs;
+    std::mutex preparedSpirVsMtx;
 
     using igcDevCtxUptr = CIF::RAII::UPtr_t<IGC::IgcOclDeviceCtxTagOCL>;
     using fclDevCtxUptr = CIF::RAII::UPtr_t<IGC::FclOclDeviceCtxTagOCL>;
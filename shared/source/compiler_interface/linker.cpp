@@ -9,6 +9,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/compiler_interface/external_functions.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/zebin/zebin_elf.h"
 #include "shared/source/helpers/blit_commands_helper.h"
@@ -25,7 +26,10 @@
 
 #include "RelocationInfo.h"
 
+#include <algorithm>
+#include <atomic>
 #include <sstream>
+#include <system_error>
 #include <unordered_map>
 
 namespace NEO {
@@ -146,8 +150,10 @@ bool LinkerInput::decodeRelocationTable(const void *data, uint32_t numEntries, u
             relocInfo.type = RelocationInfo::Type::perThreadPayloadOffset;
             break;
         }
+        assignSymbolId(relocInfo);
         outRelocInfo.push_back(std::move(relocInfo));
     }
+    std::stable_sort(outRelocInfo.begin(), outRelocInfo.end(), [](const auto &lhs, const auto &rhs) { return lhs.offset < rhs.offset; });
     return true;
 }
 
@@ -156,6 +162,29 @@ void LinkerInput::addDataRelocationInfo(const RelocationInfo &relocationInfo) {
     this->traits.requiresPatchingOfGlobalVariablesBuffer |= (relocationInfo.relocationSegment == SegmentType::globalVariables);
     this->traits.requiresPatchingOfGlobalConstantsBuffer |= (relocationInfo.relocationSegment == SegmentType::globalConstants);
     this->dataRelocations.push_back(relocationInfo);
+    assignSymbolId(this->dataRelocations.back());
+}
+
+void LinkerInput::assignSymbolId(RelocationInfo &relocationInfo) {
+    if (relocationInfo.symbolName.empty()) {
+        relocationInfo.symbolId = invalidSymbolId;
+        return;
+    }
+    auto newSymbolId = static_cast<uint32_t>(symbolIds.size());
+    relocationInfo.symbolId = symbolIds.emplace(relocationInfo.symbolName, newSymbolId).first->second;
+}
+
+void LinkerInput::sortRelocationsByOffset() {
+    auto byOffset = [](const RelocationInfo &lhs, const RelocationInfo &rhs) { return lhs.offset < rhs.offset; };
+    for (auto &segmentRelocations : textRelocations) {
+        std::stable_sort(segmentRelocations.begin(), segmentRelocations.end(), byOffset);
+    }
+    std::stable_sort(dataRelocations.begin(), dataRelocations.end(), [&byOffset](const RelocationInfo &lhs, const RelocationInfo &rhs) {
+        if (lhs.relocationSegment != rhs.relocationSegment) {
+            return lhs.relocationSegment < rhs.relocationSegment;
+        }
+        return byOffset(lhs, rhs);
+    });
 }
 
 void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uint32_t instructionsSegmentId) {
@@ -169,6 +198,7 @@ void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uin
     auto &outRelocInfo = textRelocations[instructionsSegmentId];
 
     relocationInfo.relocationSegment = SegmentType::instructions;
+    assignSymbolId(relocationInfo);
 
     outRelocInfo.push_back(std::move(relocationInfo));
 }
@@ -290,6 +320,9 @@ void LinkerInput::decodeElfSymbolTableAndRelocations(Elf::Elf<numBits> &elf, con
             }
         }
     }
+
+    // patching walks relocations per segment, keep them ordered by target offset
+    sortRelocationsByOffset();
 }
 
 void LinkerInput::parseRelocationForExtFuncUsage(const RelocationInfo &relocInfo, const std::string &kernelName) {
@@ -342,6 +375,15 @@ LinkingStatus Linker::link(const SegmentInfo &globalVariablesSegInfo, const Segm
 bool Linker::relocateSymbols(const SegmentInfo &globalVariables, const SegmentInfo &globalConstants, const SegmentInfo &exportedFunctions, const SegmentInfo &globalStrings,
                              const PatchableSegments &instructionsSegments, size_t globalConstantsInitDataSize, size_t globalVariablesInitDataSize) {
     relocatedSymbols.reserve(data.getSymbols().size());
+    relocatedSymbolsById.assign(data.getSymbolIdsCount(), nullptr);
+    auto addRelocatedSymbol = [this](const std::string &symbolName, const SymbolInfo &symbolInfo, uint64_t gpuAddress) {
+        auto &relocatedSymbol = relocatedSymbols[symbolName];
+        relocatedSymbol = {symbolInfo, gpuAddress};
+        auto symbolId = data.getSymbolId(symbolName);
+        if (symbolId < relocatedSymbolsById.size()) {
+            relocatedSymbolsById[symbolId] = &relocatedSymbol;
+        }
+    };
     for (const auto &[symbolName, symbolInfo] : data.getSymbols()) {
         if (symbolInfo.segment == SegmentType::instructions && false == symbolInfo.global) {
             if (symbolInfo.instructionSegmentId >= instructionsSegments.size()) {
@@ -351,7 +393,7 @@ bool Linker::relocateSymbols(const SegmentInfo &globalVariables, const SegmentIn
             if (symbolInfo.offset + symbolInfo.size > segment.segmentSize) {
                 return false;
             }
-            relocatedSymbols[symbolName] = {symbolInfo, segment.gpuAddress + symbolInfo.offset};
+            addRelocatedSymbol(symbolName, symbolInfo, segment.gpuAddress + symbolInfo.offset);
         } else {
             const SegmentInfo *seg = nullptr;
             uint64_t offset = symbolInfo.offset;
@@ -385,7 +427,7 @@ bool Linker::relocateSymbols(const SegmentInfo &globalVariables, const SegmentIn
                 DEBUG_BREAK_IF(true);
                 return false;
             }
-            relocatedSymbols[symbolName] = {symbolInfo, seg->gpuAddress + offset};
+            addRelocatedSymbol(symbolName, symbolInfo, seg->gpuAddress + offset);
         }
     }
     return true;
@@ -413,7 +455,16 @@ void Linker::patchAddress(void *relocAddress, const uint64_t value, const Linker
     }
 }
 
+const Linker::RelocatedSymbol<SymbolInfo> *Linker::findRelocatedSymbol(const RelocationInfo &relocation) const {
+    if ((relocation.symbolId < relocatedSymbolsById.size()) && (nullptr != relocatedSymbolsById[relocation.symbolId])) {
+        return relocatedSymbolsById[relocation.symbolId];
+    }
+    auto symbolIt = relocatedSymbols.find(relocation.symbolName);
+    return (symbolIt != relocatedSymbols.end()) ? &symbolIt->second : nullptr;
+}
+
 void Linker::removeLocalSymbolsFromRelocatedSymbols() {
+    relocatedSymbolsById.clear();
     auto it = relocatedSymbols.begin();
     while (it != relocatedSymbols.end()) {
         if (false == it->second.symbol.global) {
@@ -424,6 +475,60 @@ void Linker::removeLocalSymbolsFromRelocatedSymbols() {
     }
 }
 
+static std::thread createStdThread(std::function<void()> &&work) {
+    return std::thread(std::move(work));
+}
+
+std::thread (*createInstructionsSegmentsPatchingWorkerThread)(std::function<void()> &&work) = createStdThread;
+
+uint32_t getInstructionsSegmentsPatchingWorkersCount(size_t segmentsCount, size_t relocationsCount) {
+    if (segmentsCount <= 1u) {
+        return 1u;
+    }
+    auto workersCount = NEO::debugManager.flags.LinkerPatchingWorkerThreads.get();
+    if (workersCount == -1) {
+        constexpr size_t minRelocationsPerWorker = 4096u;
+        constexpr size_t maxDefaultWorkersCount = 8u;
+        size_t hwThreadsCount = std::max(1u, std::thread::hardware_concurrency());
+        return static_cast<uint32_t>(std::max<size_t>(1u, std::min({hwThreadsCount, maxDefaultWorkersCount, segmentsCount, relocationsCount / minRelocationsPerWorker})));
+    }
+    return static_cast<uint32_t>(std::min(static_cast<size_t>(std::max(workersCount, 1)), segmentsCount));
+}
+
+void Linker::patchInstructionsSegment(uint32_t segId, const PatchableSegment &segment, UnresolvedExternals &outUnresolvedExternals,
+                                      StackVec<uint32_t *, 2> &outImplicitArgsRelocationAddresses, const KernelDescriptorsT &kernelDescriptors) const {
+    const auto implicitArgsSymbolId = data.getSymbolId(implicitArgsRelocationSymbolName);
+    for (const auto &relocation : data.getRelocationsInInstructionSegments()[segId]) {
+        UNRECOVERABLE_IF(nullptr == segment.hostPointer);
+        bool invalidRelocation = relocation.offset + addressSizeInBytes(relocation.type) > segment.segmentSize;
+        if (invalidRelocation) {
+            outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidRelocation});
+            DEBUG_BREAK_IF(true);
+            continue;
+        }
+
+        bool isImplicitArgsRelocation = (LinkerInput::invalidSymbolId != relocation.symbolId) ? (relocation.symbolId == implicitArgsSymbolId)
+                                                                                              : (relocation.symbolName == implicitArgsRelocationSymbolName);
+        auto relocAddress = ptrOffset(segment.hostPointer, static_cast<uintptr_t>(relocation.offset));
+        if (relocation.type == LinkerInput::RelocationInfo::Type::perThreadPayloadOffset) {
+            uint32_t crossThreadDataSize = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize - kernelDescriptors.at(segId)->kernelAttributes.inlineDataPayloadSize;
+            *reinterpret_cast<uint32_t *>(relocAddress) = crossThreadDataSize;
+        } else if (isImplicitArgsRelocation) {
+            outImplicitArgsRelocationAddresses.push_back(reinterpret_cast<uint32_t *>(relocAddress));
+        } else if (relocation.symbolName.empty()) {
+            uint64_t patchValue = 0;
+            patchAddress(relocAddress, patchValue, relocation);
+        } else {
+            if (auto relocatedSymbol = findRelocatedSymbol(relocation)) {
+                uint64_t patchValue = relocatedSymbol->gpuAddress + relocation.addend;
+                patchAddress(relocAddress, patchValue, relocation);
+            } else {
+                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidRelocation});
+            }
+        }
+    }
+}
+
 void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals, const KernelDescriptorsT &kernelDescriptors) {
     if (false == data.getTraits().requiresPatchingOfInstructionSegments) {
         return;
@@ -431,35 +536,45 @@ void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &inst
 
     auto &relocationsPerSegment = data.getRelocationsInInstructionSegments();
     UNRECOVERABLE_IF(data.getRelocationsInInstructionSegments().size() > instructionsSegments.size());
-    for (size_t segId = 0U; segId < relocationsPerSegment.size(); segId++) {
-        auto &segment = instructionsSegments[segId];
-        for (const auto &relocation : relocationsPerSegment[segId]) {
-            UNRECOVERABLE_IF(nullptr == segment.hostPointer);
-            bool invalidRelocation = relocation.offset + addressSizeInBytes(relocation.type) > segment.segmentSize;
-            if (invalidRelocation) {
-                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
-                DEBUG_BREAK_IF(true);
-                continue;
-            }
 
-            auto relocAddress = ptrOffset(segment.hostPointer, static_cast<uintptr_t>(relocation.offset));
-            if (relocation.type == LinkerInput::RelocationInfo::Type::perThreadPayloadOffset) {
-                uint32_t crossThreadDataSize = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize - kernelDescriptors.at(segId)->kernelAttributes.inlineDataPayloadSize;
-                *reinterpret_cast<uint32_t *>(relocAddress) = crossThreadDataSize;
-            } else if (relocation.symbolName == implicitArgsRelocationSymbolName) {
-                pImplicitArgsRelocationAddresses[static_cast<uint32_t>(segId)].push_back(reinterpret_cast<uint32_t *>(relocAddress));
-            } else if (relocation.symbolName.empty()) {
-                uint64_t patchValue = 0;
-                patchAddress(relocAddress, patchValue, relocation);
-            } else {
-                auto symbolIt = relocatedSymbols.find(relocation.symbolName);
-                if (symbolIt != relocatedSymbols.end()) {
-                    uint64_t patchValue = symbolIt->second.gpuAddress + relocation.addend;
-                    patchAddress(relocAddress, patchValue, relocation);
-                } else {
-                    outUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
-                }
-            }
+    size_t relocationsCount = 0u;
+    for (const auto &segmentRelocations : relocationsPerSegment) {
+        relocationsCount += segmentRelocations.size();
+    }
+
+    // each segment is patched in its own host memory, so segments are independent;
+    // results are merged in segments order below to keep unresolved externals deterministic
+    std::vector<UnresolvedExternals> unresolvedExternalsPerSegment(relocationsPerSegment.size());
+    std::vector<StackVec<uint32_t *, 2>> implicitArgsRelocationAddressesPerSegment(relocationsPerSegment.size());
+    std::atomic<size_t> nextSegId{0u};
+    auto worker = [&]() {
+        for (auto segId = nextSegId++; segId < relocationsPerSegment.size(); segId = nextSegId++) {
+            patchInstructionsSegment(static_cast<uint32_t>(segId), instructionsSegments[segId], unresolvedExternalsPerSegment[segId],
+                                     implicitArgsRelocationAddressesPerSegment[segId], kernelDescriptors);
+        }
+    };
+
+    const auto workersCount = getInstructionsSegmentsPatchingWorkersCount(relocationsPerSegment.size(), relocationsCount);
+    std::vector<std::thread> workers;
+    workers.reserve(workersCount - 1u);
+    for (uint32_t i = 1u; i < workersCount; i++) {
+        try {
+            workers.push_back(createInstructionsSegmentsPatchingWorkerThread(worker));
+        } catch (const std::system_error &) {
+            // out of threads, remaining segments are patched by started workers and calling thread
+            break;
+        }
+    }
+    worker();
+    for (auto &workerThread : workers) {
+        workerThread.join();
+    }
+
+    for (uint32_t segId = 0U; segId < static_cast<uint32_t>(relocationsPerSegment.size()); segId++) {
+        auto &segmentUnresolvedExternals = unresolvedExternalsPerSegment[segId];
+        outUnresolvedExternals.insert(outUnresolvedExternals.end(), segmentUnresolvedExternals.begin(), segmentUnresolvedExternals.end());
+        for (auto implicitArgsRelocationAddress : implicitArgsRelocationAddressesPerSegment[segId]) {
+            pImplicitArgsRelocationAddresses[segId].push_back(implicitArgsRelocationAddress);
         }
     }
 }
@@ -475,12 +590,12 @@ void Linker::patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const
     bool isAnyRelocationPerformed = false;
 
     for (const auto &relocation : data.getDataRelocations()) {
-        auto symbolIt = relocatedSymbols.find(relocation.symbolName);
-        if (symbolIt == relocatedSymbols.end()) {
+        auto relocatedSymbol = findRelocatedSymbol(relocation);
+        if (nullptr == relocatedSymbol) {
             outUnresolvedExternals.push_back(UnresolvedExternal{relocation});
             continue;
         }
-        uint64_t srcGpuAddressAs64Bit = symbolIt->second.gpuAddress;
+        uint64_t srcGpuAddressAs64Bit = relocatedSymbol->gpuAddress;
 
         ArrayRef<uint8_t> dst{};
         const void *initData = nullptr;
@@ -9,9 +9,11 @@
 #include "shared/source/device_binary_format/elf/elf_decoder.h"
 
 #include <cstdint>
+#include <functional>
 #include <limits>
 #include <optional>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
@@ -85,6 +87,8 @@ struct LinkerInput {
     };
     static_assert(sizeof(Traits) == sizeof(Traits::packed), "");
 
+    static constexpr uint32_t invalidSymbolId = std::numeric_limits<uint32_t>::max();
+
     struct RelocationInfo {
         enum class Type : uint32_t {
             unknown,
@@ -102,6 +106,7 @@ struct LinkerInput {
         SegmentType relocationSegment = SegmentType::unknown;
         std::string relocationSegmentName;
         int64_t addend = 0U;
+        uint32_t symbolId = invalidSymbolId; // index of interned symbolName, assigned when relocation is added to LinkerInput
     };
 
     using SectionNameToSegmentIdMap = std::unordered_map<std::string, uint32_t>;
@@ -151,6 +156,15 @@ struct LinkerInput {
         symbols.emplace(std::make_pair(symbolName, symbolInfo));
     }
 
+    uint32_t getSymbolId(const std::string &symbolName) const {
+        auto symbolIdIt = symbolIds.find(symbolName);
+        return (symbolIdIt != symbolIds.end()) ? symbolIdIt->second : invalidSymbolId;
+    }
+
+    size_t getSymbolIdsCount() const {
+        return symbolIds.size();
+    }
+
     const RelocationsPerInstSegment &getRelocationsInInstructionSegments() const {
         return textRelocations;
     }
@@ -177,9 +191,12 @@ struct LinkerInput {
 
   protected:
     void parseRelocationForExtFuncUsage(const RelocationInfo &relocInfo, const std::string &kernelName);
+    void assignSymbolId(RelocationInfo &relocationInfo);
+    void sortRelocationsByOffset();
 
     Traits traits;
     SymbolMap symbols;
+    std::unordered_map<std::string, uint32_t> symbolIds;
     std::vector<std::pair<std::string, SymbolInfo>> extFuncSymbols;
     Relocations dataRelocations;
     RelocationsPerInstSegment textRelocations;
@@ -219,6 +236,7 @@ struct Linker {
     };
 
     using RelocatedSymbolsMap = std::unordered_map<std::string, RelocatedSymbol<SymbolInfo>>;
+    using RelocatedSymbolsById = std::vector<const RelocatedSymbol<SymbolInfo> *>;
     using PatchableSegments = std::vector<PatchableSegment>;
     using UnresolvedExternals = std::vector<UnresolvedExternal>;
     using KernelDescriptorsT = std::vector<KernelDescriptor *>;
@@ -248,10 +266,14 @@ struct Linker {
   protected:
     const LinkerInput &data;
     RelocatedSymbolsMap relocatedSymbols;
+    RelocatedSymbolsById relocatedSymbolsById; // indexed with RelocationInfo::symbolId, valid until local symbols are removed
 
     bool relocateSymbols(const SegmentInfo &globalVariables, const SegmentInfo &globalConstants, const SegmentInfo &exportedFunctions, const SegmentInfo &globalStrings, const PatchableSegments &instructionsSegments, size_t globalConstantsInitDataSize, size_t globalVariablesInitDataSize);
 
     void patchInstructionsSegments(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals, const KernelDescriptorsT &kernelDescriptors);
+    void patchInstructionsSegment(uint32_t segId, const PatchableSegment &segment, UnresolvedExternals &outUnresolvedExternals,
+                                  StackVec<uint32_t *, 2> &outImplicitArgsRelocationAddresses, const KernelDescriptorsT &kernelDescriptors) const;
+    const RelocatedSymbol<SymbolInfo> *findRelocatedSymbol(const RelocationInfo &relocation) const;
 
     void patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const SegmentInfo &globalConstantsSegInfo,
                            GraphicsAllocation *globalVariablesSeg, GraphicsAllocation *globalConstantsSeg,
@@ -268,6 +290,11 @@ struct Linker {
     std::unordered_map<uint32_t /*ISA segment id*/, StackVec<uint32_t *, 2> /*implicit args relocation address to patch*/> pImplicitArgsRelocationAddresses;
 };
 
+// throws std::system_error when thread can't be created,
+// segments of workers which couldn't be started are patched on calling thread
+extern std::thread (*createInstructionsSegmentsPatchingWorkerThread)(std::function<void()> &&work);
+uint32_t getInstructionsSegmentsPatchingWorkersCount(size_t segmentsCount, size_t relocationsCount);
+
 std::string constructLinkerErrorMessage(const Linker::UnresolvedExternals &unresolvedExternals, const std::vector<std::string> &instructionsSegmentsNames);
 std::string constructRelocationsDebugMessage(const Linker::RelocatedSymbolsMap &relocatedSymbols);
 
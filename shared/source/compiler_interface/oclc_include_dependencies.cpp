@@ -0,0 +1,310 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/oclc_include_dependencies.h"
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/path.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+namespace NEO {
+
+std::unique_ptr<char[]> (*OclcIncludeDependencies::loadFile)(const char *fileName, size_t &fileSize) = loadDataFromFile;
+
+namespace {
+
+struct IncludeDirective {
+    std::string name;
+    bool quoted = false;
+};
+
+bool isBlank(char c) {
+    return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\f') || (c == '\v');
+}
+
+std::vector<std::string> tokenizeOptions(ArrayRef<const char> options) {
+    std::vector<std::string> tokens;
+    std::string token;
+    bool inToken = false;
+    bool inQuotes = false;
+    for (auto c : options) {
+        if (c == '\0') {
+            break;
+        }
+        if (c == '"') {
+            inQuotes = !inQuotes;
+            inToken = true;
+            continue;
+        }
+        if (!inQuotes && std::isspace(static_cast<unsigned char>(c))) {
+            if (inToken) {
+                tokens.push_back(token);
+                token.clear();
+                inToken = false;
+            }
+            continue;
+        }
+        token += c;
+        inToken = true;
+    }
+    if (inToken) {
+        tokens.push_back(token);
+    }
+    return tokens;
+}
+
+bool startsWith(const std::string &str, const char *prefix) {
+    return 0 == str.compare(0, strlen(prefix), prefix);
+}
+
+bool getIncludeDirectories(ArrayRef<const char> options, std::vector<std::string> &outDirectories) {
+    auto tokens = tokenizeOptions(options);
+    for (size_t i = 0; i < tokens.size(); i++) {
+        const auto &token = tokens[i];
+        if (token == "-I") {
+            if (i + 1 == tokens.size()) {
+                return false;
+            }
+            outDirectories.push_back(tokens[++i]);
+        } else if (startsWith(token, "-I")) {
+            outDirectories.push_back(token.substr(2));
+        } else if (startsWith(token, "-include") || startsWith(token, "-imacros") || startsWith(token, "-isystem") ||
+                   startsWith(token, "-iquote") || startsWith(token, "-idirafter")) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool findIncludeDirectives(ArrayRef<const char> src, std::vector<IncludeDirective> &outIncludes) {
+    constexpr const char *includeKeyword = "include";
+    const size_t includeKeywordLength = strlen(includeKeyword);
+
+    const char *pos = src.begin();
+    const char *end = src.end();
+
+    // __has_include and __has_include_next probe headers in conditions, outcome of the probe is not recorded
+    constexpr const char *hasIncludeKeyword = "__has_include";
+    if (std::search(pos, end, hasIncludeKeyword, hasIncludeKeyword + strlen(hasIncludeKeyword)) != end) {
+        return false;
+    }
+
+    while (pos < end) {
+        const char *lineEnd = std::find(pos, end, '\n');
+        const char *it = pos;
+        pos = (lineEnd == end) ? end : lineEnd + 1;
+
+        while ((it < lineEnd) && isBlank(*it)) {
+            ++it;
+        }
+        if ((it == lineEnd) || (*it != '#')) {
+            continue;
+        }
+        ++it;
+        while ((it < lineEnd) && isBlank(*it)) {
+            ++it;
+        }
+        if ((static_cast<size_t>(lineEnd - it) < includeKeywordLength) || (0 != strncmp(it, includeKeyword, includeKeywordLength))) {
+            continue;
+        }
+        it += includeKeywordLength;
+        if ((it < lineEnd) && (std::isalnum(static_cast<unsigned char>(*it)) || (*it == '_'))) {
+            // #include_next and similar extensions
+            return false;
+        }
+        while ((it < lineEnd) && isBlank(*it)) {
+            ++it;
+        }
+        if ((it == lineEnd) || ((*it != '"') && (*it != '<'))) {
+            // include name given by macro
+            return false;
+        }
+        const char closing = (*it == '"') ? '"' : '>';
+        const char *nameEnd = std::find(it + 1, lineEnd, closing);
+        if ((nameEnd == lineEnd) || (nameEnd == it + 1)) {
+            return false;
+        }
+        outIncludes.push_back({std::string(it + 1, nameEnd), closing == '"'});
+    }
+    return true;
+}
+
+bool isAbsolutePath(const std::string &path) {
+    return (path[0] == '/') || (path[0] == '\\') || ((path.size() > 1) && (path[1] == ':'));
+}
+
+std::string getDirectory(const std::string &path) {
+    auto separatorPos = path.find_last_of("/\\");
+    if (separatorPos == std::string::npos) {
+        return "";
+    }
+    return path.substr(0, std::max(separatorPos, static_cast<size_t>(1)));
+}
+
+} // namespace
+
+std::string OclcIncludeDependencies::getManifestCacheKey(const std::string &srcCacheKey) {
+    return srcCacheKey + "_includes";
+}
+
+bool OclcIncludeDependencies::collect(ArrayRef<const char> src, ArrayRef<const char> options, ArrayRef<const char> internalOptions) {
+    dependencies.clear();
+    recordedPaths.clear();
+
+    std::vector<std::string> includeDirectories;
+    if ((false == getIncludeDirectories(options, includeDirectories)) || (false == getIncludeDirectories(internalOptions, includeDirectories))) {
+        return false;
+    }
+
+    return collectFromSource(src, "", includeDirectories, 0u);
+}
+
+bool OclcIncludeDependencies::collectFromSource(ArrayRef<const char> src, const std::string &srcDirectory, const std::vector<std::string> &includeDirectories, uint32_t depth) {
+    if (depth > maxIncludeDepth) {
+        return false;
+    }
+
+    std::vector<IncludeDirective> includes;
+    if (false == findIncludeDirectives(src, includes)) {
+        return false;
+    }
+
+    for (const auto &include : includes) {
+        // same search order as frontend compiler - includer's directory for quoted includes, then -I directories
+        std::vector<std::string> candidates;
+        if (isAbsolutePath(include.name)) {
+            candidates.push_back(include.name);
+        } else {
+            if (include.quoted) {
+                candidates.push_back(joinPath(srcDirectory, include.name));
+            }
+            for (const auto &includeDirectory : includeDirectories) {
+                candidates.push_back(joinPath(includeDirectory, include.name));
+            }
+        }
+
+        bool resolved = false;
+        for (const auto &candidate : candidates) {
+            auto recorded = recordedPaths.find(candidate);
+            if (recorded != recordedPaths.end()) {
+                if (dependencies[recorded->second].exists) {
+                    resolved = true;
+                    break;
+                }
+                continue;
+            }
+
+            size_t contentSize = 0u;
+            auto content = loadFile(candidate.c_str(), contentSize);
+
+            OclcIncludeDependency dependency;
+            dependency.path = candidate;
+            dependency.exists = (nullptr != content);
+            dependency.contentHash = dependency.exists ? Hash::hash(content.get(), contentSize) : 0u;
+            recordedPaths[candidate] = dependencies.size();
+            dependencies.push_back(std::move(dependency));
+
+            if (nullptr != content) {
+                if (false == collectFromSource(ArrayRef<const char>(content.get(), contentSize), getDirectory(candidate), includeDirectories, depth + 1)) {
+                    return false;
+                }
+                resolved = true;
+                break;
+            }
+        }
+
+        if (false == resolved) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool OclcIncludeDependencies::isUpToDate() const {
+    for (const auto &dependency : dependencies) {
+        size_t contentSize = 0u;
+        auto content = loadFile(dependency.path.c_str(), contentSize);
+        if ((nullptr != content) != dependency.exists) {
+            return false;
+        }
+        if (dependency.exists && (Hash::hash(content.get(), contentSize) != dependency.contentHash)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string OclcIncludeDependencies::getDigest() const {
+    Hash hash;
+    for (const auto &dependency : dependencies) {
+        hash.update(dependency.path.c_str(), dependency.path.size() + 1);
+        hash.update(reinterpret_cast<const char *>(&dependency.exists), sizeof(dependency.exists));
+        hash.update(reinterpret_cast<const char *>(&dependency.contentHash), sizeof(dependency.contentHash));
+    }
+
+    auto res = hash.finish();
+    std::stringstream stream;
+    stream << std::setfill('0')
+           << std::setw(sizeof(res) * 2)
+           << std::hex
+           << res;
+    return stream.str();
+}
+
+// manifest line format: "<exists> <content hash> <path>"
+std::string OclcIncludeDependencies::serialize() const {
+    std::stringstream stream;
+    stream << manifestHeader << "\n";
+    for (const auto &dependency : dependencies) {
+        stream << (dependency.exists ? "1 " : "0 ")
+               << std::setfill('0') << std::setw(sizeof(dependency.contentHash) * 2) << std::hex << dependency.contentHash
+               << " " << dependency.path << "\n";
+    }
+    return stream.str();
+}
+
+bool OclcIncludeDependencies::deserialize(ArrayRef<const char> manifest) {
+    constexpr size_t hashOffset = 2u;
+    constexpr size_t hashLength = sizeof(uint64_t) * 2;
+    constexpr size_t pathOffset = hashOffset + hashLength + 1;
+
+    std::istringstream stream(std::string(manifest.begin(), manifest.end()));
+    std::string line;
+    if (!std::getline(stream, line) || (line != manifestHeader)) {
+        return false;
+    }
+
+    std::vector<OclcIncludeDependency> parsedDependencies;
+    while (std::getline(stream, line)) {
+        if ((line.size() <= pathOffset) || ((line[0] != '0') && (line[0] != '1')) || (line[1] != ' ') || (line[pathOffset - 1] != ' ')) {
+            return false;
+        }
+        auto hashStr = line.substr(hashOffset, hashLength);
+        if (false == std::all_of(hashStr.begin(), hashStr.end(), [](char c) { return std::isxdigit(static_cast<unsigned char>(c)) != 0; })) {
+            return false;
+        }
+
+        OclcIncludeDependency dependency;
+        dependency.exists = (line[0] == '1');
+        dependency.contentHash = std::strtoull(hashStr.c_str(), nullptr, 16);
+        dependency.path = line.substr(pathOffset);
+        parsedDependencies.push_back(std::move(dependency));
+    }
+
+    dependencies = std::move(parsedDependencies);
+    recordedPaths.clear();
+    return true;
+}
+
+} // namespace NEO
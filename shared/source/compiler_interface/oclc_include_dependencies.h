@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+
+struct OclcIncludeDependency {
+    std::string path;
+    uint64_t contentHash = 0u;
+    bool exists = false;
+};
+
+// Files which OpenCL C source depends on through #include directives.
+// Allows sources with includes to be looked up in compiler cache directly, without running frontend compiler.
+// Each probed include candidate is recorded, including non-existing ones which would shadow resolved file once created.
+// Recorded dependencies are stored in compiler cache as manifest next to the binary.
+class OclcIncludeDependencies {
+  public:
+    static constexpr const char *manifestHeader = "oclc_include_dependencies 1";
+    static constexpr uint32_t maxIncludeDepth = 200u;
+
+    static std::unique_ptr<char[]> (*loadFile)(const char *fileName, size_t &fileSize);
+
+    static std::string getManifestCacheKey(const std::string &srcCacheKey);
+
+    // Returns false when includes can't be resolved without preprocessing the source,
+    // e.g. when include name is a macro or include file can't be found
+    bool collect(ArrayRef<const char> src, ArrayRef<const char> options, ArrayRef<const char> internalOptions);
+
+    bool isUpToDate() const;
+    std::string getDigest() const;
+
+    std::string serialize() const;
+    // dependencies are modified only on success
+    bool deserialize(ArrayRef<const char> manifest);
+
+    const std::vector<OclcIncludeDependency> &getDependencies() const {
+        return dependencies;
+    }
+
+  protected:
+    bool collectFromSource(ArrayRef<const char> src, const std::string &srcDirectory, const std::vector<std::string> &includeDirectories, uint32_t depth);
+
+    std::vector<OclcIncludeDependency> dependencies;
+    std::unordered_map<std::string, size_t> recordedPaths;
+};
+
+} // namespace NEO
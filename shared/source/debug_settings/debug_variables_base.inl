@@ -62,6 +62,19 @@ DECLARE_DEBUG_VARIABLE(bool, ForceImplicitFlush, false, "Flush after each enqueu
 DECLARE_DEBUG_VARIABLE(bool, ForcePipeControlPriorToWalker, false, "Force pipe control prior to walker")
 DECLARE_DEBUG_VARIABLE(bool, ZebinAppendElws, false, "Append cross-thread data with enqueue local work size")
 DECLARE_DEBUG_VARIABLE(bool, ZebinIgnoreIcbeVersion, true, "Ignore IGC\'s ICBE version")
+DECLARE_DEBUG_VARIABLE(int32_t, ZebinDecodeWorkerThreads, -1, "Number of threads decoding zeInfo kernel entries. -1: default (parallel only for zebins with many kernels), 0 or 1: decode on calling thread, >1: number of threads")
+DECLARE_DEBUG_VARIABLE(int32_t, LinkerPatchingWorkerThreads, -1, "Number of threads patching relocations in instructions segments. -1: default (parallel only for modules with many relocations), 0 or 1: patch on calling thread, >1: number of threads")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLazyKernelMaterialization, -1, "Initialize kernel data and upload kernel ISA of user modules on first kernel creation instead of at module creation. ISA of kernels sharing one allocation is still uploaded at module creation. -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIsaDeduplication, -1, "Share single ISA allocation between modules with identical kernels ISA not requiring patching. -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, CompilerMaxConcurrentBuilds, -1, "Maximal number of concurrently executed program builds, identical builds requested concurrently are always joined. -1: default (number of hardware threads), >0: number of builds")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuTransferWorkerThreads, -1, "Number of threads copying data of CPU side buffer reads, writes and map transfers. -1: default (parallel only for large copies), 0 or 1: copy on calling thread, >1: number of threads, limited to hardware threads count")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuTransferStreamingStores, -1, "Use non-temporal stores in CPU side transfers. -1: default (only for large copies to memory not read by CPU afterwards), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBuiltinDispatchInfoCache, -1, "Reuse work sizes computed for built-in buffer operations with the same geometry. -1: default (enabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedSubmissionsMemoryBudget, -1, "Memory budget in MB for resources of command buffers merged into one submission when flushing batched submissions. -1: default (half of global memory size), >=0: budget in MB")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedSubmissionsLatencyCap, -1, "Max age in microseconds of command buffers recorded in batched dispatch mode, checked on next submission - batched command buffers are not flushed by a timer when no further submission comes. -1: default (disabled), >=0: time in microseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuTiledImageTransferMaxSize, -1, "Maximal size in KB of tiled image in system memory initialized with host ptr data on CPU with GMM CPU blit instead of GPU copy. -1: default (1024), 0: disabled, >0: size in KB")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIncludeAwareDirectCaching, -1, "Look up OpenCL C sources with #include directives in compiler cache without running frontend compiler, using content hashes of included files. -1: default (enabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDecodedZeInfoCache, -1, "Store decoded zeInfo metadata in compiler cache and reuse it instead of decoding zeInfo again. -1: default (enabled when compiler cache is enabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(bool, UseBindlessDebugSip, false, "Use bindless debug system routine")
 DECLARE_DEBUG_VARIABLE(bool, CleanStateInPreamble, false, "Ensures clean state in preamble")
 DECLARE_DEBUG_VARIABLE(bool, EnableStatelessCompressionWithUnifiedMemory, false, "Enable stateless compression with unified memory")
@@ -115,6 +128,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForceAuxTranslationMode, -1, "Override AUX Trans
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideGpuAddressSpace, -1, "Set GPU address space range in bits; ignore when -1")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideMaxWorkgroupSize, -1, "Set max workgroup size; ignore when -1")
 DECLARE_DEBUG_VARIABLE(int32_t, DoCpuCopyOnReadBuffer, -1, "Override CPU copy behavior for buffer reads; values = -1: default, 0: do not use CPU copy, 1: triggers CPU copy path for Read Buffer calls, only supported for some basic use cases (no blocked user events in dependencies tree)")
+DECLARE_DEBUG_VARIABLE(int32_t, DoCpuCopyOnWriteImage, -1, "Write small tiled images in system memory on CPU with GMM CPU blit in blocking Write Image calls; values = -1: default (disabled), 0: do not use CPU copy, 1: use CPU copy for images within CpuTiledImageTransferMaxSize (no user events in dependencies)")
 DECLARE_DEBUG_VARIABLE(int32_t, DoCpuCopyOnWriteBuffer, -1, "Override CPU copy behavior for buffer writes; values = -1: default, 0: do not use CPU copy, 1: triggers CPU copy path for Write Buffer calls, only supported for some basic use cases (no blocked user events in dependencies tree)")
 DECLARE_DEBUG_VARIABLE(int32_t, PauseOnEnqueue, -1, "-1: default, -2: always, x: pause on enqueue number x and ask for user confirmation before and after execution, counted from 0")
 DECLARE_DEBUG_VARIABLE(int32_t, PauseOnBlitCopy, -1, "-1: default, -2: always, x: pause on blit enqueue number x and ask for user confirmation before and after execution, counted from 0. Note that single blit enqueue may have multiple copy instructions")
@@ -316,6 +330,8 @@ DECLARE_DEBUG_VARIABLE(bool, LogWaitingForCompletion, false, "Logs waiting for c
 DECLARE_DEBUG_VARIABLE(bool, ResidencyDebugEnable, false, "enables debug messages and checks for Residency Model")
 DECLARE_DEBUG_VARIABLE(bool, EventsDebugEnable, false, "enables debug messages for events, virtual events, blocked enqueues, events trees etc.")
 DECLARE_DEBUG_VARIABLE(bool, EventsTrackerEnable, false, "enables event graphs dumping")
+DECLARE_DEBUG_VARIABLE(bool, EventsTraceEnable, false, "enables low overhead event graph tracing to binary eg_trace*.bin file, see EventsTraceRecorder::convertToDot")
+DECLARE_DEBUG_VARIABLE(bool, EventsTraceDumpDot, false, "with EventsTraceEnable, converts eg_trace*.bin file to eg_trace*.dot graph when execution environment is destroyed")
 DECLARE_DEBUG_VARIABLE(bool, PrintLWSSizes, false, "prints driver chosen local workgroup sizes")
 DECLARE_DEBUG_VARIABLE(bool, PrintDispatchParameters, false, "prints dispatch parameters of kernels passed to clEnqueueNDRangeKernel")
 DECLARE_DEBUG_VARIABLE(bool, PrintProgramBinaryProcessingTime, false, "prints execution time of Program::processGenBinary() method during program building")
@@ -381,6 +397,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsSize, -1, "-1: default, >=0: Size to app
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMask, 0, "0: default, >0: bitmask: indicates bcs engines for split")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMaskH2D, 0, "0: default, >0: bitmask: indicates bcs engines for H2D split")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMaskD2H, 0, "0: default, >0: bitmask: indicates bcs engines for D2H split")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsAdaptive, -1, "-1: default, 0: disabled, 1: enabled. Measure per engine throughput from subcopy timestamps and plan BCS split chunks and engine count from it")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsAdaptiveOverheadUs, -1, "-1: default - learned from subcopies of different sizes, >=0: Fixed cost in microseconds of using an additional engine, used by adaptive BCS split planning")
 DECLARE_DEBUG_VARIABLE(int32_t, ReuseKernelBinaries, -1, "-1: default, 0:disabled, 1: enabled. If enabled, driver reuses kernel binaries.")
 DECLARE_DEBUG_VARIABLE(int32_t, SetAmountOfReusableAllocations, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver will fill reusable allocation lists with given amount of command buffers and heaps at initialization of immediate command list.")
 DECLARE_DEBUG_VARIABLE(int32_t, SetAmountOfReusableAllocationsPerCmdQueue, -1, "-1: default, 0:disabled, > 1: enabled. If enabled, driver will fill reusable allocation lists with given amount of command buffers for each initialized opencl command queue.")
@@ -434,6 +452,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionRelaxedOrderingQueueSizeLimit, -
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionRelaxedOrderingMinNumberOfClients, -1, "-1: default, >0: Enables RelaxedOrdering mode only if specified number of clients is assigned to given CSR.")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionMonitorFenceInputPolicy, -1, "-1: default, 0: stalling command flag, 1: explicit monitor fence flag. Selects policy to dispatch monitor fence upon input flag, either for every stalling command or explicit motor fence dispatch")
 DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintBuffers, false, "Print address of submitted command buffers")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionTelemetry, -1, "-1: default (disabled), 0: disabled, 1: collect ULLS telemetry - dispatch CPU time, semaphore section time and relaxed ordering queue size histograms with ring start/stop/switch counters, 2: collect and print it when direct submission is destroyed")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, USMEvictAfterMigration, false, "Evict USM allocation after implicit migration to GPU")
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,8 @@
 
 #include "shared/source/utilities/const_stringref.h"
 
+#include <cstddef>
+
 namespace NEO {
 namespace Ar {
 
@@ -30,6 +32,13 @@ namespace SpecialFileNames {
 inline constexpr ConstStringRef longFileNamesFile = "//";
 inline constexpr char longFileNamePrefix = '/';
 inline constexpr char fileNameTerminator = '/';
+
+// optional member emitted first by ocloc, each line maps file name to offset of its header within archive :
+// <file name>/<header offset as zero-padded decimal>\n
+// legacy decoders treat it as regular file that doesn't match any target
+inline constexpr ConstStringRef targetIndexFile = "target_index";
+inline constexpr size_t targetIndexOffsetDigits = 20U;
+inline constexpr char targetIndexLineTerminator = '\n';
 } // namespace SpecialFileNames
 
 } // namespace Ar
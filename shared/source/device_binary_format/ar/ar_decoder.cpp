@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -57,7 +57,11 @@ Ar decodeAr(const ArrayRef<const uint8_t> binary, std::string &outErrReason, std
                     return {};
                 }
             }
-            ret.files.push_back(fileEntry);
+            if (SpecialFileNames::targetIndexFile == fileEntry.fileName) {
+                ret.targetIndexEntry = fileEntry;
+            } else {
+                ret.files.push_back(fileEntry);
+            }
         }
 
         decodePos = fileEntryDataPos + fileSize;
@@ -66,6 +70,74 @@ Ar decodeAr(const ArrayRef<const uint8_t> binary, std::string &outErrReason, std
     return ret;
 }
 
+bool decodeArFileEntry(const ArrayRef<const uint8_t> binary, size_t headerOffset, ArFileEntryHeaderAndData &outFileEntry) {
+    if ((headerOffset < arMagic.size()) || (headerOffset + sizeof(ArFileEntryHeader) > binary.size())) {
+        return false;
+    }
+
+    auto fileEntryHeader = reinterpret_cast<const ArFileEntryHeader *>(binary.begin() + headerOffset);
+    if (ConstStringRef::fromArray(fileEntryHeader->trailingMagic) != arFileEntryTrailingMagic) {
+        return false;
+    }
+
+    auto fileEntryDataOffset = headerOffset + sizeof(ArFileEntryHeader);
+    uint64_t fileSize = readDecimal<sizeof(fileEntryHeader->fileSizeInBytes)>(fileEntryHeader->fileSizeInBytes);
+    if (fileSize > binary.size() - fileEntryDataOffset) {
+        return false;
+    }
+
+    auto fileName = readUnpaddedString<sizeof(fileEntryHeader->identifier)>(fileEntryHeader->identifier);
+    if (fileName.empty() || (SpecialFileNames::longFileNamePrefix == fileName[0])) {
+        return false;
+    }
+
+    outFileEntry.fileName = fileName;
+    outFileEntry.fullHeader = fileEntryHeader;
+    outFileEntry.fileData = ArrayRef<const uint8_t>(binary.begin() + fileEntryDataOffset, static_cast<size_t>(fileSize));
+    return true;
+}
+
+StackVec<ArTargetIndexEntry, 32> decodeArTargetIndex(const ArrayRef<const uint8_t> binary) {
+    StackVec<ArTargetIndexEntry, 32> ret;
+    if (false == isAr(binary)) {
+        return ret;
+    }
+
+    ArFileEntryHeaderAndData indexEntry = {};
+    if ((false == decodeArFileEntry(binary, arMagic.size(), indexEntry)) || (SpecialFileNames::targetIndexFile != indexEntry.fileName)) {
+        return ret;
+    }
+
+    auto indexData = ConstStringRef(reinterpret_cast<const char *>(indexEntry.fileData.begin()), indexEntry.fileData.size());
+    size_t lineBegin = 0U;
+    while (lineBegin < indexData.size()) {
+        size_t lineEnd = lineBegin;
+        while ((lineEnd < indexData.size()) && (indexData[lineEnd] != SpecialFileNames::targetIndexLineTerminator)) {
+            ++lineEnd;
+        }
+        auto line = ConstStringRef(indexData.begin() + lineBegin, lineEnd - lineBegin);
+        lineBegin = lineEnd + 1;
+        if (line.empty()) {
+            continue; // padding
+        }
+
+        size_t nameEnd = 0U;
+        while ((nameEnd < line.size()) && (line[nameEnd] != SpecialFileNames::fileNameTerminator)) {
+            ++nameEnd;
+        }
+        if ((0U == nameEnd) || (line.size() != nameEnd + 1 + SpecialFileNames::targetIndexOffsetDigits)) {
+            ret.clear();
+            return ret;
+        }
+
+        ArTargetIndexEntry entry = {};
+        entry.fileName = ConstStringRef(line.begin(), nameEnd);
+        entry.headerOffset = static_cast<size_t>(readDecimal<SpecialFileNames::targetIndexOffsetDigits>(line.begin() + nameEnd + 1));
+        ret.push_back(entry);
+    }
+    return ret;
+}
+
 } // namespace Ar
 
 } // namespace NEO
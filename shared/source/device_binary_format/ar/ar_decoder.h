@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,12 @@ struct Ar {
     const char *magic = nullptr;
     StackVec<ArFileEntryHeaderAndData, 32> files;
     ArFileEntryHeaderAndData longFileNamesEntry;
+    ArFileEntryHeaderAndData targetIndexEntry;
+};
+
+struct ArTargetIndexEntry {
+    ConstStringRef fileName;
+    size_t headerOffset = 0U;
 };
 
 inline bool isAr(const ArrayRef<const uint8_t> binary) {
@@ -81,6 +87,12 @@ inline ConstStringRef readLongFileName(ConstStringRef longFileNamesSection, size
 
 Ar decodeAr(const ArrayRef<const uint8_t> binary, std::string &outErrReason, std::string &outWarnings);
 
+// returns entries of target index member when it is the first member of archive, empty if archive has no (valid) index
+StackVec<ArTargetIndexEntry, 32> decodeArTargetIndex(const ArrayRef<const uint8_t> binary);
+
+// decodes single file entry with short file name at given offset, doesn't walk preceding entries
+bool decodeArFileEntry(const ArrayRef<const uint8_t> binary, size_t headerOffset, ArFileEntryHeaderAndData &outFileEntry);
+
 } // namespace Ar
 
 } // namespace NEO
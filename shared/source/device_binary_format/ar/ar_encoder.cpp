@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,16 +47,54 @@ ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, con
     memcpy_s(header.fileSizeInBytes, sizeof(header.fileSizeInBytes), sizeString.c_str(), sizeString.size());
     this->fileEntries.reserve(this->fileEntries.size() + sizeof(header) + alignedFileSize);
     auto newFileHeaderOffset = this->fileEntries.size();
+    this->fileEntriesHeaderOffsets.emplace_back(fileName.str(), newFileHeaderOffset);
     this->fileEntries.insert(this->fileEntries.end(), reinterpret_cast<uint8_t *>(&header), reinterpret_cast<uint8_t *>(&header + 1));
     this->fileEntries.insert(this->fileEntries.end(), fileData.begin(), fileData.end());
     this->fileEntries.resize(this->fileEntries.size() + alignedFileSize - fileData.size(), 0U); // implicit 2-byte alignment
     return reinterpret_cast<ArFileEntryHeader *>(this->fileEntries.data() + newFileHeaderOffset);
 }
 
+std::vector<uint8_t> ArEncoder::encodeTargetIndex(size_t fileEntriesOffset) const {
+    const size_t requiredAlignment = padTo8Bytes ? 8U : 2U;
+    size_t indexDataSize = 0U;
+    for (const auto &[fileName, headerOffset] : fileEntriesHeaderOffsets) {
+        indexDataSize += fileName.size() + 1 + SpecialFileNames::targetIndexOffsetDigits + 1;
+    }
+    // keep alignment of following entries unchanged, padding is made of empty lines
+    indexDataSize += (requiredAlignment - ((sizeof(ArFileEntryHeader) + indexDataSize) % requiredAlignment)) % requiredAlignment;
+    const size_t indexEntrySize = sizeof(ArFileEntryHeader) + indexDataSize;
+
+    ArFileEntryHeader header = {};
+    memcpy_s(header.identifier, sizeof(header.identifier), SpecialFileNames::targetIndexFile.begin(), SpecialFileNames::targetIndexFile.size());
+    header.identifier[SpecialFileNames::targetIndexFile.size()] = SpecialFileNames::fileNameTerminator;
+    auto sizeString = std::to_string(indexDataSize);
+    UNRECOVERABLE_IF(sizeString.length() > sizeof(header.fileSizeInBytes));
+    memcpy_s(header.fileSizeInBytes, sizeof(header.fileSizeInBytes), sizeString.c_str(), sizeString.size());
+
+    std::vector<uint8_t> ret;
+    ret.reserve(indexEntrySize);
+    ret.insert(ret.end(), reinterpret_cast<uint8_t *>(&header), reinterpret_cast<uint8_t *>(&header + 1));
+    for (const auto &[fileName, headerOffset] : fileEntriesHeaderOffsets) {
+        auto offsetString = std::to_string(fileEntriesOffset + indexEntrySize + headerOffset);
+        UNRECOVERABLE_IF(offsetString.length() > SpecialFileNames::targetIndexOffsetDigits);
+        ret.insert(ret.end(), fileName.begin(), fileName.end());
+        ret.push_back(SpecialFileNames::fileNameTerminator);
+        ret.resize(ret.size() + SpecialFileNames::targetIndexOffsetDigits - offsetString.size(), '0');
+        ret.insert(ret.end(), offsetString.begin(), offsetString.end());
+        ret.push_back(SpecialFileNames::targetIndexLineTerminator);
+    }
+    ret.resize(indexEntrySize, SpecialFileNames::targetIndexLineTerminator);
+    return ret;
+}
+
 std::vector<uint8_t> ArEncoder::encode() const {
     std::vector<uint8_t> ret;
     ret.reserve(arMagic.size() + 1);
     ret.insert(ret.end(), reinterpret_cast<const uint8_t *>(arMagic.begin()), reinterpret_cast<const uint8_t *>(arMagic.end()));
+    if (emitTargetIndex && (false == fileEntriesHeaderOffsets.empty())) {
+        auto targetIndex = encodeTargetIndex(ret.size());
+        ret.insert(ret.end(), targetIndex.begin(), targetIndex.end());
+    }
     ret.insert(ret.end(), this->fileEntries.begin(), this->fileEntries.end());
     return ret;
 }
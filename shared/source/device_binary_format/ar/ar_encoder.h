@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,19 +12,25 @@
 #include "shared/source/utilities/const_stringref.h"
 
 #include <cstdint>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace NEO {
 namespace Ar {
 
 struct ArEncoder {
-    ArEncoder(bool padTo8Bytes = false) : padTo8Bytes(padTo8Bytes) {}
+    ArEncoder(bool padTo8Bytes = false, bool emitTargetIndex = false) : padTo8Bytes(padTo8Bytes), emitTargetIndex(emitTargetIndex) {}
     ArFileEntryHeader *appendFileEntry(const ConstStringRef fileName, const ArrayRef<const uint8_t> fileData);
     std::vector<uint8_t> encode() const;
 
   protected:
+    std::vector<uint8_t> encodeTargetIndex(size_t fileEntriesOffset) const;
+
     std::vector<uint8_t> fileEntries;
+    std::vector<std::pair<std::string, size_t>> fileEntriesHeaderOffsets;
     bool padTo8Bytes = false;
+    bool emitTargetIndex = false;
     uint32_t paddingEntry = 0U;
 };
 
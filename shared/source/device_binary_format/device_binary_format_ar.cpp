@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,8 @@
 #include "shared/source/helpers/product_config_helper.h"
 #include "shared/source/helpers/string.h"
 
+#include <algorithm>
+
 namespace NEO {
 void searchForBinary(Ar::Ar &archiveData, const ConstStringRef filter, Ar::ArFileEntryHeaderAndData *&matched) {
     for (auto &file : archiveData.files) {
@@ -20,6 +22,37 @@ void searchForBinary(Ar::Ar &archiveData, const ConstStringRef filter, Ar::ArFil
     }
 }
 
+// decodes only entries which may match any of the filters, using target index emitted by ocloc;
+// falls back to decoding whole archive for legacy archives or when index doesn't match archive content
+Ar::Ar decodeArForFilters(const ArrayRef<const uint8_t> archive, ArrayRef<const ConstStringRef> filters, std::string &outErrReason, std::string &outWarning) {
+    auto targetIndex = Ar::decodeArTargetIndex(archive);
+    if (targetIndex.empty()) {
+        return Ar::decodeAr(archive, outErrReason, outWarning);
+    }
+
+    StackVec<const Ar::ArTargetIndexEntry *, 8> matchedIndexEntries;
+    for (const auto &filter : filters) {
+        auto indexEntryIt = std::find_if(targetIndex.begin(), targetIndex.end(), [&filter](const auto &indexEntry) { return indexEntry.fileName.startsWith(filter); });
+        if ((indexEntryIt != targetIndex.end()) && (std::find(matchedIndexEntries.begin(), matchedIndexEntries.end(), &*indexEntryIt) == matchedIndexEntries.end())) {
+            matchedIndexEntries.push_back(&*indexEntryIt);
+        }
+    }
+
+    // keep archive order, so first file matching each filter is the same as when searching whole archive
+    std::sort(matchedIndexEntries.begin(), matchedIndexEntries.end(), [](const auto lhs, const auto rhs) { return lhs->headerOffset < rhs->headerOffset; });
+
+    Ar::Ar ret;
+    ret.magic = reinterpret_cast<const char *>(archive.begin());
+    for (const auto indexEntry : matchedIndexEntries) {
+        Ar::ArFileEntryHeaderAndData fileEntry = {};
+        if ((false == Ar::decodeArFileEntry(archive, indexEntry->headerOffset, fileEntry)) || (fileEntry.fileName != indexEntry->fileName)) {
+            return Ar::decodeAr(archive, outErrReason, outWarning);
+        }
+        ret.files.push_back(fileEntry);
+    }
+    return ret;
+}
+
 template <>
 bool isDeviceBinaryFormat<NEO::DeviceBinaryFormat::archive>(const ArrayRef<const uint8_t> binary) {
     return NEO::Ar::isAr(binary);
@@ -28,11 +61,6 @@ bool isDeviceBinaryFormat<NEO::DeviceBinaryFormat::archive>(const ArrayRef<const
 template <>
 SingleDeviceBinary unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::archive>(const ArrayRef<const uint8_t> archive, const ConstStringRef requestedProductAbbreviation, const TargetDevice &requestedTargetDevice,
                                                                               std::string &outErrReason, std::string &outWarning) {
-    auto archiveData = NEO::Ar::decodeAr(archive, outErrReason, outWarning);
-    if (nullptr == archiveData.magic) {
-        return {};
-    }
-
     std::string pointerSize = ((requestedTargetDevice.maxPointerSizeInBytes == 8) ? "64" : "32");
     std::string filterPointerSizeAndMajorMinorRevision = pointerSize + "." + ProductConfigHelper::parseMajorMinorRevisionValue(requestedTargetDevice.aotConfig);
     std::string filterPointerSizeAndMajorMinor = pointerSize + "." + ProductConfigHelper::parseMajorMinorValue(requestedTargetDevice.aotConfig);
@@ -40,6 +68,13 @@ SingleDeviceBinary unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::archive>(co
     std::string filterPointerSizeAndPlatformAndStepping = filterPointerSizeAndPlatform + "." + std::to_string(requestedTargetDevice.stepping);
     ConstStringRef filterGenericIrFileName{"generic_ir"};
 
+    const ConstStringRef filters[] = {filterPointerSizeAndMajorMinorRevision, filterPointerSizeAndPlatformAndStepping, filterPointerSizeAndMajorMinor,
+                                      filterPointerSizeAndPlatform, filterGenericIrFileName};
+    auto archiveData = decodeArForFilters(archive, filters, outErrReason, outWarning);
+    if (nullptr == archiveData.magic) {
+        return {};
+    }
+
     Ar::ArFileEntryHeaderAndData *matchedFiles[5] = {};
     Ar::ArFileEntryHeaderAndData *&matchedPointerSizeAndMajorMinorRevision = matchedFiles[0];
     Ar::ArFileEntryHeaderAndData *&matchedPointerSizeAndPlatformAndStepping = matchedFiles[1];
@@ -117,7 +117,7 @@ DecodeError decodeSingleZebin(ProgramInfo &dst, const SingleDeviceBinary &src, s
     dst.grfSize = src.targetDevice.grfSize;
     dst.minScratchSpaceSize = src.targetDevice.minScratchSpaceSize;
     dst.indirectDetectionVersion = src.generatorFeatureVersions.indirectMemoryAccessDetection;
-    auto decodeError = NEO::Zebin::decodeZebin<numBits>(dst, elf, outErrReason, outWarning);
+    auto decodeError = NEO::Zebin::decodeZebin<numBits>(dst, elf, outErrReason, outWarning, src.decodedMetadataCache);
     if (DecodeError::success != decodeError) {
         return decodeError;
     }
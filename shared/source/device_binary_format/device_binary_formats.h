@@ -18,6 +18,7 @@
 namespace NEO {
 struct ProgramInfo;
 struct RootDeviceEnvironment;
+class CompilerCache;
 class GfxCoreHelper;
 
 enum class DeviceBinaryFormat : uint8_t {
@@ -84,6 +85,7 @@ struct SingleDeviceBinary {
         using VersionT = uint32_t;
         VersionT indirectMemoryAccessDetection = 0u;
     } generatorFeatureVersions;
+    CompilerCache *decodedMetadataCache = nullptr;
 };
 
 template <DeviceBinaryFormat format>
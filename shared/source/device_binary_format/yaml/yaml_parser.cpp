@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,10 +7,114 @@
 
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
 
+#include "shared/source/helpers/basic_math.h"
+
+#include <bitset>
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <immintrin.h>
+#endif
+
 namespace NEO {
 
 namespace Yaml {
 
+namespace BlockScanner {
+constexpr size_t blockSize = sizeof(__m128i);
+
+inline __m128i loadBlock(const char *pos) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+}
+
+inline __m128i matchCharacter(__m128i block, char c) {
+    return _mm_cmpeq_epi8(block, _mm_set1_epi8(c));
+}
+
+inline __m128i matchRange(__m128i block, char first, char last) {
+    return _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8(first - 1)), _mm_cmpgt_epi8(_mm_set1_epi8(last + 1), block));
+}
+
+inline uint32_t toMask(__m128i matches) {
+    return static_cast<uint32_t>(_mm_movemask_epi8(matches));
+}
+
+constexpr uint32_t fullMask = (1u << blockSize) - 1u;
+
+size_t countLines(const char *pos, const char *end) {
+    size_t linesCount = 0u;
+    for (; end - pos >= static_cast<ptrdiff_t>(blockSize); pos += blockSize) {
+        linesCount += std::bitset<blockSize>(toMask(matchCharacter(loadBlock(pos), '\n'))).count();
+    }
+    for (; pos < end; ++pos) {
+        linesCount += ('\n' == *pos) ? 1u : 0u;
+    }
+    return linesCount;
+}
+
+template <bool vectorized>
+const char *skipSpaces(const char *pos, const char *end) {
+    if constexpr (vectorized) {
+        for (; end - pos >= static_cast<ptrdiff_t>(blockSize); pos += blockSize) {
+            auto notSpaces = ~toMask(matchCharacter(loadBlock(pos), ' ')) & fullMask;
+            if (0u != notSpaces) {
+                return pos + Math::getMinLsbSet(notSpaces);
+            }
+        }
+    }
+    while ((pos < end) && (' ' == *pos)) {
+        ++pos;
+    }
+    return pos;
+}
+
+template <bool vectorized>
+const char *findLineEnd(const char *pos, const char *end) {
+    if constexpr (vectorized) {
+        for (; end - pos >= static_cast<ptrdiff_t>(blockSize); pos += blockSize) {
+            auto newLines = toMask(matchCharacter(loadBlock(pos), '\n'));
+            if (0u != newLines) {
+                return pos + Math::getMinLsbSet(newLines);
+            }
+        }
+    }
+    while ((pos < end) && ('\n' != *pos)) {
+        ++pos;
+    }
+    return pos;
+}
+
+// vectorized counterpart of consumeNameIdentifier - name characters and separation whitespaces are consumed
+template <bool vectorized>
+const char *consumeNameIdentifier(ConstStringRef wholeText, const char *parsePos) {
+    if constexpr (vectorized) {
+        if (false == isNameIdentifierBeginningCharacter(*parsePos)) {
+            return parsePos;
+        }
+        auto pos = parsePos + 1;
+        auto end = wholeText.end();
+        for (; end - pos >= static_cast<ptrdiff_t>(blockSize); pos += blockSize) {
+            auto block = loadBlock(pos);
+            auto lowerCaseBlock = _mm_or_si128(block, _mm_set1_epi8(0x20));
+            auto matches = _mm_or_si128(matchRange(lowerCaseBlock, 'a', 'z'), matchRange(block, '0', '9'));
+            matches = _mm_or_si128(matches, _mm_or_si128(matchCharacter(block, '_'), matchCharacter(block, '-')));
+            matches = _mm_or_si128(matches, _mm_or_si128(matchCharacter(block, '.'), matchCharacter(block, ' ')));
+            matches = _mm_or_si128(matches, matchCharacter(block, '\t'));
+            auto notMatched = ~toMask(matches) & fullMask;
+            if (0u != notMatched) {
+                return pos + Math::getMinLsbSet(notMatched);
+            }
+        }
+        while ((pos < end) && (isNameIdentifierCharacter(*pos) || isSeparationWhitespace(*pos))) {
+            ++pos;
+        }
+        return pos;
+    } else {
+        return Yaml::consumeNameIdentifier(wholeText, parsePos);
+    }
+}
+} // namespace BlockScanner
+
 std::string constructYamlError(size_t lineNumber, const char *lineBeg, const char *parsePos, const char *reason) {
     auto ret = "NEO::Yaml : Could not parse line : [" + std::to_string(lineNumber) + "] : [" + ConstStringRef(lineBeg, parsePos - lineBeg + 1).str() + "] <-- parser position on error";
     if (nullptr != reason) {
@@ -145,22 +249,31 @@ bool isValidInlineCollectionFormat(const char *context, const char *contextEnd)
     return endCollection;
 }
 
-bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning) {
+template <bool vectorized>
+bool tokenizeImpl(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning) {
     if (text.empty()) {
         outWarning.append("NEO::Yaml : input text is empty\n");
         return true;
     }
 
+    if constexpr (vectorized) {
+        auto linesCount = BlockScanner::countLines(text.begin(), text.end()) + 1u;
+        outLines.reserve(outLines.size() + linesCount);
+        outTokens.reserve(outTokens.size() + linesCount * estimatedTokensPerLine);
+    }
+
     TokenizerContext context{text};
     context.isParsingIdent = true;
 
     while (context.pos < context.end) {
         reserveBasedOnEstimates(outTokens, text.begin(), text.end(), context.pos);
         switch (context.pos[0]) {
-        case ' ':
-            context.lineIndent += context.isParsingIdent ? 1 : 0;
-            ++context.pos;
+        case ' ': {
+            auto spacesEnd = BlockScanner::skipSpaces<vectorized>(context.pos, context.end);
+            context.lineIndent += context.isParsingIdent ? static_cast<uint32_t>(spacesEnd - context.pos) : 0;
+            context.pos = spacesEnd;
             break;
+        }
         case '\t':
             if (context.isParsingIdent) {
                 context.lineIndent += 4U;
@@ -175,13 +288,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         case '#': {
             context.isParsingIdent = false;
             outTokens.push_back(Token(ConstStringRef(context.pos, 1), Token::singleCharacter));
-            auto commentIt = context.pos + 1;
-            while (commentIt < context.end) {
-                if ('\n' == commentIt[0]) {
-                    break;
-                }
-                ++commentIt;
-            }
+            auto commentIt = BlockScanner::findLineEnd<vectorized>(context.pos + 1, context.end);
             if (context.pos + 1 != commentIt) {
                 outTokens.push_back(Token(ConstStringRef(context.pos + 1, commentIt - (context.pos + 1)), Token::comment));
             }
@@ -273,7 +380,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
             break;
         default: {
             context.isParsingIdent = false;
-            auto tokEnd = consumeNameIdentifier(text, context.pos);
+            auto tokEnd = BlockScanner::consumeNameIdentifier<vectorized>(text, context.pos);
             if (tokEnd != context.pos) {
                 auto tokenData = ConstStringRef(context.pos, tokEnd - context.pos);
                 tokenData = tokenData.trimEnd(isWhitespace);
@@ -309,6 +416,14 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
     return true;
 }
 
+bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning) {
+    return tokenizeImpl<true>(text, outLines, outTokens, outErrReason, outWarning);
+}
+
+bool tokenizeScalar(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning) {
+    return tokenizeImpl<false>(text, outLines, outTokens, outErrReason, outWarning);
+}
+
 void finalizeNode(NodeId nodeId, const TokensCache &tokens, NodesCache &outNodes, std::string &outErrReason, std::string &outWarning) {
     auto &node = outNodes[nodeId];
     if (invalidTokenId != node.key) {
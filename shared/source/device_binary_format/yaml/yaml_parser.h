@@ -307,7 +307,12 @@ std::string constructYamlError(size_t lineNumber, const char *lineBeg, const cha
 bool isValidInlineCollectionFormat(const char *context, const char *contextEnd);
 constexpr ConstStringRef inlineCollectionYamlErrorMsg = "NEO::Yaml : Inline collection is not in valid regex format - ^\\[(\\s*(\\d|\\w)+,?)+\\s*\\]\\s*\\n";
 
+// typical zeInfo line is "key: value\n" or "- key: value\n"
+constexpr size_t estimatedTokensPerLine = 5u;
+
 bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning);
+// character by character reference implementation of tokenize
+bool tokenizeScalar(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning);
 
 using NodeId = uint32_t;
 constexpr NodeId invalidNodeID = std::numeric_limits<NodeId>::max();
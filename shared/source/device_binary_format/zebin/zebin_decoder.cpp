@@ -7,12 +7,14 @@
 
 #include "shared/source/device_binary_format/zebin/zebin_decoder.h"
 
+#include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
 #include "shared/source/device_binary_format/elf/elf_decoder.h"
 #include "shared/source/device_binary_format/zebin/zebin_elf.h"
 #include "shared/source/device_binary_format/zebin/zeinfo_decoder.h"
+#include "shared/source/device_binary_format/zebin/zeinfo_serialization.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/program/kernel_info.h"
@@ -343,10 +345,35 @@ ConstStringRef getZeInfoFromZebin(const ArrayRef<const uint8_t> zebin, std::stri
                : extractZeInfoMetadataString<Elf::EI_CLASS_64>(zebin, outErrReason, outWarning);
 }
 
-template DecodeError decodeZebin<Elf::EI_CLASS_32>(ProgramInfo &dst, NEO::Elf::Elf<Elf::EI_CLASS_32> &elf, std::string &outErrReason, std::string &outWarning);
-template DecodeError decodeZebin<Elf::EI_CLASS_64>(ProgramInfo &dst, NEO::Elf::Elf<Elf::EI_CLASS_64> &elf, std::string &outErrReason, std::string &outWarning);
+DecodeError decodeZeInfoWithCache(ProgramInfo &dst, ConstStringRef zeInfo, CompilerCache *decodedMetadataCache, std::string &outErrReason, std::string &outWarning) {
+    const bool isDstEmpty = dst.kernelInfos.empty() && dst.externalFunctions.empty() && dst.globalsDeviceToHostNameMap.empty();
+    if ((nullptr == decodedMetadataCache) || (false == isDstEmpty) || (0 == NEO::debugManager.flags.EnableDecodedZeInfoCache.get())) {
+        return ZeInfo::decodeZeInfo(dst, zeInfo, outErrReason, outWarning);
+    }
+
+    const auto cacheKey = ZeInfo::getDecodedZeInfoCacheKey(zeInfo, dst.grfSize, dst.minScratchSpaceSize);
+    size_t cachedBlobSize = 0u;
+    auto cachedBlob = decodedMetadataCache->loadCachedBinary(cacheKey, cachedBlobSize);
+    if (cachedBlob && ZeInfo::deserializeDecodedZeInfo(dst, ArrayRef<const uint8_t>::fromAny(cachedBlob.get(), cachedBlobSize), outWarning)) {
+        return DecodeError::success;
+    }
+
+    std::string decodeWarnings;
+    auto decodeError = ZeInfo::decodeZeInfo(dst, zeInfo, outErrReason, decodeWarnings);
+    outWarning.append(decodeWarnings);
+    if (DecodeError::success == decodeError) {
+        auto blob = ZeInfo::serializeDecodedZeInfo(dst, decodeWarnings);
+        if (false == blob.empty()) {
+            decodedMetadataCache->cacheBinary(cacheKey, reinterpret_cast<const char *>(blob.data()), blob.size());
+        }
+    }
+    return decodeError;
+}
+
+template DecodeError decodeZebin<Elf::EI_CLASS_32>(ProgramInfo &dst, NEO::Elf::Elf<Elf::EI_CLASS_32> &elf, std::string &outErrReason, std::string &outWarning, CompilerCache *decodedMetadataCache);
+template DecodeError decodeZebin<Elf::EI_CLASS_64>(ProgramInfo &dst, NEO::Elf::Elf<Elf::EI_CLASS_64> &elf, std::string &outErrReason, std::string &outWarning, CompilerCache *decodedMetadataCache);
 template <Elf::ElfIdentifierClass numBits>
-DecodeError decodeZebin(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, std::string &outErrReason, std::string &outWarning) {
+DecodeError decodeZebin(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, std::string &outErrReason, std::string &outWarning, CompilerCache *decodedMetadataCache) {
     ZebinSections<numBits> zebinSections;
     auto extractError = extractZebinSections(elf, zebinSections, outErrReason, outWarning);
     if (DecodeError::success != extractError) {
@@ -398,7 +425,7 @@ DecodeError decodeZebin(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, std::stri
         zeinfo = zeinfo.substr(static_cast<size_t>(0), dst.kernelMiscInfoPos);
     }
 
-    auto decodeZeInfoError = ZeInfo::decodeZeInfo(dst, zeinfo, outErrReason, outWarning);
+    auto decodeZeInfoError = decodeZeInfoWithCache(dst, zeinfo, decodedMetadataCache, outErrReason, outWarning);
     if (DecodeError::success != decodeZeInfoError) {
         return decodeZeInfoError;
     }
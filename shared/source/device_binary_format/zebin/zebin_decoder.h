@@ -65,8 +65,10 @@ DecodeError extractZebinSections(Elf::Elf<numBits> &elf, ZebinSections<numBits>
 template <Elf::ElfIdentifierClass numBits>
 DecodeError validateZebinSectionsCount(const ZebinSections<numBits> &sections, std::string &outErrReason, std::string &outWarning);
 
+DecodeError decodeZeInfoWithCache(ProgramInfo &dst, ConstStringRef zeInfo, CompilerCache *decodedMetadataCache, std::string &outErrReason, std::string &outWarning);
+
 template <Elf::ElfIdentifierClass numBits>
-DecodeError decodeZebin(ProgramInfo &dst, Elf::Elf<numBits> &elf, std::string &outErrReason, std::string &outWarning);
+DecodeError decodeZebin(ProgramInfo &dst, Elf::Elf<numBits> &elf, std::string &outErrReason, std::string &outWarning, CompilerCache *decodedMetadataCache = nullptr);
 
 template <Elf::ElfIdentifierClass numBits>
 ArrayRef<const uint8_t> getKernelHeap(ConstStringRef &kernelName, Elf::Elf<numBits> &elf, const ZebinSections<numBits> &zebinSections);
@@ -20,6 +20,10 @@
 #include "shared/source/program/program_info.h"
 #include "shared/source/utilities/const_stringref.h"
 
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+
 namespace NEO::Zebin::ZeInfo {
 
 template <typename ContainerT>
@@ -488,19 +492,90 @@ DecodeError decodeZeInfoFunctions(ProgramInfo &dst, Yaml::YamlParser &parser, co
     return DecodeError::success;
 }
 
+std::thread createStdThread(std::function<void()> &&work) {
+    return std::thread(std::move(work));
+}
+
+std::thread (*createZeInfoKernelsDecodeWorkerThread)(std::function<void()> &&work) = createStdThread;
+
+uint32_t getZeInfoKernelsDecodeWorkersCount(size_t kernelsCount) {
+    if (kernelsCount == 0u) {
+        return 1u;
+    }
+    auto workersCount = NEO::debugManager.flags.ZebinDecodeWorkerThreads.get();
+    if (workersCount == -1) {
+        constexpr size_t minKernelsPerWorker = 64u;
+        constexpr size_t maxDefaultWorkersCount = 8u;
+        size_t hwThreadsCount = std::max(1u, std::thread::hardware_concurrency());
+        return static_cast<uint32_t>(std::max<size_t>(1u, std::min({hwThreadsCount, maxDefaultWorkersCount, kernelsCount / minKernelsPerWorker})));
+    }
+    return static_cast<uint32_t>(std::min(static_cast<size_t>(std::max(workersCount, 1)), kernelsCount));
+}
+
+namespace {
+struct ZeInfoKernelDecodeTask {
+    const Yaml::Node *kernelNd = nullptr;
+    std::unique_ptr<KernelInfo> kernelInfo;
+    DecodeError decodeError = DecodeError::success;
+    std::string errReason;
+    std::string warning;
+};
+} // namespace
+
 DecodeError decodeZeInfoKernels(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning, const Types::Version &srcZeInfoVersion) {
     UNRECOVERABLE_IF(zeInfoSections.kernels.size() != 1U);
+
+    std::vector<ZeInfoKernelDecodeTask> tasks;
     for (const auto &kernelNd : parser.createChildrenRange(*zeInfoSections.kernels[0])) {
-        auto kernelInfo = std::make_unique<KernelInfo>();
-        auto zeInfoErr = decodeZeInfoKernelEntry(kernelInfo->kernelDescriptor, parser, kernelNd, dst.grfSize, dst.minScratchSpaceSize, outErrReason, outWarning, srcZeInfoVersion);
-        if (DecodeError::success != zeInfoErr) {
-            return zeInfoErr;
+        tasks.emplace_back().kernelNd = &kernelNd;
+    }
+
+    // kernel entries only read the already built yaml tree, so they can be decoded independently;
+    // results are consumed in kernels order below to keep errors, warnings and kernelInfos deterministic
+    auto decodeTask = [&](ZeInfoKernelDecodeTask &task) {
+        task.kernelInfo = std::make_unique<KernelInfo>();
+        task.decodeError = decodeZeInfoKernelEntry(task.kernelInfo->kernelDescriptor, parser, *task.kernelNd, dst.grfSize, dst.minScratchSpaceSize, task.errReason, task.warning, srcZeInfoVersion);
+    };
+
+    const auto workersCount = getZeInfoKernelsDecodeWorkersCount(tasks.size());
+    if (workersCount > 1u) {
+        std::atomic<size_t> nextTaskId{0u};
+        auto worker = [&]() {
+            for (auto taskId = nextTaskId++; taskId < tasks.size(); taskId = nextTaskId++) {
+                decodeTask(tasks[taskId]);
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(workersCount - 1u);
+        for (uint32_t i = 1u; i < workersCount; i++) {
+            try {
+                workers.push_back(createZeInfoKernelsDecodeWorkerThread(worker));
+            } catch (const std::system_error &) {
+                // out of threads, remaining kernels are decoded by started workers and calling thread
+                break;
+            }
+        }
+        worker();
+        for (auto &workerThread : workers) {
+            workerThread.join();
+        }
+    }
+
+    for (auto &task : tasks) {
+        if (nullptr == task.kernelInfo) {
+            decodeTask(task);
+        }
+        outWarning.append(task.warning);
+        if (DecodeError::success != task.decodeError) {
+            outErrReason.append(task.errReason);
+            return task.decodeError;
         }
-        if (kernelInfo->kernelDescriptor.kernelMetadata.kernelName == Zebin::Elf::SectionNames::externalFunctions) {
-            dst.functionPointerWithIndirectAccessExists |= kernelInfo->kernelDescriptor.kernelAttributes.hasIndirectStatelessAccess;
+        if (task.kernelInfo->kernelDescriptor.kernelMetadata.kernelName == Zebin::Elf::SectionNames::externalFunctions) {
+            dst.functionPointerWithIndirectAccessExists |= task.kernelInfo->kernelDescriptor.kernelAttributes.hasIndirectStatelessAccess;
         }
 
-        dst.kernelInfos.push_back(kernelInfo.release());
+        dst.kernelInfos.push_back(task.kernelInfo.release());
     }
     return DecodeError::success;
 }
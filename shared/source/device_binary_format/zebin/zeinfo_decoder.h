@@ -10,6 +10,9 @@
 #include "shared/source/device_binary_format/zebin/zeinfo.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <functional>
+#include <thread>
+
 namespace NEO {
 
 struct KernelDescriptor;
@@ -71,6 +74,10 @@ DecodeError decodeZeInfoGlobalHostAccessTable(ProgramInfo &dst, Yaml::YamlParser
 
 DecodeError decodeZeInfoFunctions(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning);
 
+// throws std::system_error when thread can't be created
+extern std::thread (*createZeInfoKernelsDecodeWorkerThread)(std::function<void()> &&work);
+uint32_t getZeInfoKernelsDecodeWorkersCount(size_t kernelsCount);
+// kernels of workers which couldn't be started are decoded on calling thread
 DecodeError decodeZeInfoKernels(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning, const Types::Version &srcZeInfoVersion);
 DecodeError decodeZeInfoKernelEntry(KernelDescriptor &dst, Yaml::YamlParser &yamlParser, const Yaml::Node &kernelNd, uint32_t grfSize, uint32_t minScratchSpaceSize, std::string &outErrReason, std::string &outWarning, const Types::Version &srcZeInfoVersion);
 
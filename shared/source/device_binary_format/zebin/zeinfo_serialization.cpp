@@ -0,0 +1,398 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/zebin/zeinfo_serialization.h"
+
+#include "shared/source/compiler_interface/external_functions.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device_binary_format/zebin/zeinfo_decoder.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/kernel/kernel_descriptor.h"
+#include "shared/source/program/kernel_info.h"
+#include "shared/source/program/program_info.h"
+
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <type_traits>
+#include <unordered_map>
+
+namespace NEO::Zebin::ZeInfo {
+
+namespace {
+using KernelAttributesT = KernelDescriptor::KernelAttributes;
+using EntryPointsT = decltype(KernelDescriptor::entryPoints);
+using DispatchTraitsT = decltype(KernelDescriptor::PayloadMappings::dispatchTraits);
+using BindingTableT = decltype(KernelDescriptor::PayloadMappings::bindingTable);
+using SamplerTableT = decltype(KernelDescriptor::PayloadMappings::samplerTable);
+using ImplicitArgsT = decltype(KernelDescriptor::PayloadMappings::implicitArgs);
+using InlineSamplerT = KernelDescriptor::InlineSampler;
+
+constexpr uint32_t layoutSize = static_cast<uint32_t>(sizeof(KernelAttributesT) + sizeof(EntryPointsT) + sizeof(DispatchTraitsT) + sizeof(BindingTableT) +
+                                                      sizeof(SamplerTableT) + sizeof(ImplicitArgsT) + sizeof(InlineSamplerT) + sizeof(ArgTypeTraits) +
+                                                      sizeof(ArgDescPointer) + sizeof(ArgDescImage) + sizeof(ArgDescSampler) + sizeof(ArgDescValue::Element));
+
+class BlobWriter {
+  public:
+    template <typename T>
+    void write(const T &value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        auto bytes = reinterpret_cast<const uint8_t *>(&value);
+        data.insert(data.end(), bytes, bytes + sizeof(T));
+    }
+
+    void writeString(const std::string &str) {
+        write(static_cast<uint32_t>(str.size()));
+        data.insert(data.end(), str.begin(), str.end());
+    }
+
+    template <typename T>
+    void writeVector(const std::vector<T> &vec) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        write(static_cast<uint32_t>(vec.size()));
+        auto bytes = reinterpret_cast<const uint8_t *>(vec.data());
+        data.insert(data.end(), bytes, bytes + vec.size() * sizeof(T));
+    }
+
+    std::vector<uint8_t> data;
+};
+
+class BlobReader {
+  public:
+    BlobReader(ArrayRef<const uint8_t> blob) : blob(blob) {}
+
+    template <typename T>
+    bool read(T &value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (false == hasBytes(sizeof(T))) {
+            return false;
+        }
+        memcpy(&value, blob.begin() + pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+
+    bool readString(std::string &str) {
+        uint32_t size = 0u;
+        if (false == read(size) || false == hasBytes(size)) {
+            return false;
+        }
+        str.assign(reinterpret_cast<const char *>(blob.begin() + pos), size);
+        pos += size;
+        return true;
+    }
+
+    template <typename T>
+    bool readVector(std::vector<T> &vec) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        uint32_t count = 0u;
+        if (false == read(count) || false == hasBytes(static_cast<size_t>(count) * sizeof(T))) {
+            return false;
+        }
+        vec.resize(count);
+        if (0u != count) {
+            memcpy(vec.data(), blob.begin() + pos, count * sizeof(T));
+        }
+        pos += count * sizeof(T);
+        return true;
+    }
+
+    bool isFullyConsumed() const {
+        return pos == blob.size();
+    }
+
+  protected:
+    bool hasBytes(size_t size) const {
+        return blob.size() - pos >= size;
+    }
+
+    ArrayRef<const uint8_t> blob;
+    size_t pos = 0u;
+};
+
+void serializeArg(BlobWriter &writer, const ArgDescriptor &arg) {
+    writer.write(arg.type);
+    writer.write(arg.getTraits());
+    writer.write(arg.getExtendedTypeInfo().packed);
+    switch (arg.type) {
+    default:
+        break;
+    case ArgDescriptor::argTPointer:
+        writer.write(arg.as<ArgDescPointer>());
+        break;
+    case ArgDescriptor::argTImage:
+        writer.write(arg.as<ArgDescImage>());
+        break;
+    case ArgDescriptor::argTSampler:
+        writer.write(arg.as<ArgDescSampler>());
+        break;
+    case ArgDescriptor::argTValue: {
+        const auto &elements = arg.as<ArgDescValue>().elements;
+        writer.write(static_cast<uint32_t>(elements.size()));
+        for (const auto &element : elements) {
+            writer.write(element);
+        }
+        break;
+    }
+    }
+}
+
+bool deserializeArg(BlobReader &reader, ArgDescriptor &arg) {
+    ArgDescriptor::ArgType type = ArgDescriptor::argTUnknown;
+    ArgTypeTraits traits;
+    uint32_t extendedTypeInfo = 0u;
+    if (false == (reader.read(type) && reader.read(traits) && reader.read(extendedTypeInfo))) {
+        return false;
+    }
+    if (type > ArgDescriptor::argTValue) {
+        return false;
+    }
+
+    arg = ArgDescriptor(type);
+    arg.getTraits() = traits;
+    arg.getExtendedTypeInfo().packed = extendedTypeInfo;
+    switch (type) {
+    default:
+        return true;
+    case ArgDescriptor::argTPointer:
+        return reader.read(arg.as<ArgDescPointer>());
+    case ArgDescriptor::argTImage:
+        return reader.read(arg.as<ArgDescImage>());
+    case ArgDescriptor::argTSampler:
+        return reader.read(arg.as<ArgDescSampler>());
+    case ArgDescriptor::argTValue: {
+        uint32_t elementsCount = 0u;
+        if (false == reader.read(elementsCount)) {
+            return false;
+        }
+        auto &elements = arg.as<ArgDescValue>().elements;
+        for (uint32_t i = 0u; i < elementsCount; i++) {
+            ArgDescValue::Element element;
+            if (false == reader.read(element)) {
+                return false;
+            }
+            elements.push_back(element);
+        }
+        return true;
+    }
+    }
+}
+
+void serializeKernelDescriptor(BlobWriter &writer, const KernelDescriptor &desc) {
+    writer.write(desc.kernelAttributes);
+    writer.write(desc.entryPoints);
+    writer.write(desc.payloadMappings.dispatchTraits);
+    writer.write(desc.payloadMappings.bindingTable);
+    writer.write(desc.payloadMappings.samplerTable);
+    writer.write(desc.payloadMappings.implicitArgs);
+
+    writer.write(static_cast<uint32_t>(desc.payloadMappings.explicitArgs.size()));
+    for (const auto &arg : desc.payloadMappings.explicitArgs) {
+        serializeArg(writer, arg);
+    }
+
+    writer.write(static_cast<uint32_t>(desc.explicitArgsExtendedMetadata.size()));
+    for (const auto &metadata : desc.explicitArgsExtendedMetadata) {
+        writer.writeString(metadata.argName);
+        writer.writeString(metadata.type);
+        writer.writeString(metadata.accessQualifier);
+        writer.writeString(metadata.addressQualifier);
+        writer.writeString(metadata.typeQualifiers);
+    }
+
+    writer.writeVector(desc.inlineSamplers);
+
+    writer.writeString(desc.kernelMetadata.kernelName);
+    writer.writeString(desc.kernelMetadata.kernelLanguageAttributes);
+    writer.write(static_cast<uint32_t>(desc.kernelMetadata.printfStringsMap.size()));
+    for (const auto &[index, str] : desc.kernelMetadata.printfStringsMap) {
+        writer.write(index);
+        writer.writeString(str);
+    }
+    writer.write(desc.kernelMetadata.compiledSubGroupsNumber);
+    writer.write(desc.kernelMetadata.requiredSubGroupSize);
+    writer.write(desc.kernelMetadata.isGeneratedByIgc);
+
+    writer.writeVector(desc.generatedSsh);
+    writer.writeVector(desc.generatedDsh);
+}
+
+bool deserializeKernelDescriptor(BlobReader &reader, KernelDescriptor &desc) {
+    bool valid = reader.read(desc.kernelAttributes) &&
+                 reader.read(desc.entryPoints) &&
+                 reader.read(desc.payloadMappings.dispatchTraits) &&
+                 reader.read(desc.payloadMappings.bindingTable) &&
+                 reader.read(desc.payloadMappings.samplerTable) &&
+                 reader.read(desc.payloadMappings.implicitArgs);
+
+    uint32_t argsCount = 0u;
+    valid = valid && reader.read(argsCount);
+    for (uint32_t i = 0u; valid && i < argsCount; i++) {
+        ArgDescriptor arg;
+        valid = deserializeArg(reader, arg);
+        desc.payloadMappings.explicitArgs.push_back(arg);
+    }
+
+    uint32_t metadataCount = 0u;
+    valid = valid && reader.read(metadataCount);
+    for (uint32_t i = 0u; valid && i < metadataCount; i++) {
+        ArgTypeMetadataExtended metadata;
+        valid = reader.readString(metadata.argName) &&
+                reader.readString(metadata.type) &&
+                reader.readString(metadata.accessQualifier) &&
+                reader.readString(metadata.addressQualifier) &&
+                reader.readString(metadata.typeQualifiers);
+        desc.explicitArgsExtendedMetadata.push_back(std::move(metadata));
+    }
+
+    valid = valid && reader.readVector(desc.inlineSamplers);
+
+    valid = valid && reader.readString(desc.kernelMetadata.kernelName) && reader.readString(desc.kernelMetadata.kernelLanguageAttributes);
+    uint32_t printfStringsCount = 0u;
+    valid = valid && reader.read(printfStringsCount);
+    for (uint32_t i = 0u; valid && i < printfStringsCount; i++) {
+        uint32_t index = 0u;
+        std::string str;
+        valid = reader.read(index) && reader.readString(str);
+        desc.kernelMetadata.printfStringsMap[index] = std::move(str);
+    }
+    valid = valid && reader.read(desc.kernelMetadata.compiledSubGroupsNumber) &&
+            reader.read(desc.kernelMetadata.requiredSubGroupSize) &&
+            reader.read(desc.kernelMetadata.isGeneratedByIgc);
+
+    valid = valid && reader.readVector(desc.generatedSsh) && reader.readVector(desc.generatedDsh);
+    return valid;
+}
+} // namespace
+
+std::string getDecodedZeInfoCacheKey(ConstStringRef zeInfo, uint32_t grfSize, uint32_t minScratchSpaceSize) {
+    const bool appendElws = NEO::debugManager.flags.ZebinAppendElws.get();
+
+    Hash hash;
+    hash.update("----", 4);
+    hash.update(reinterpret_cast<const char *>(&decodedZeInfoBlobVersion), sizeof(decodedZeInfoBlobVersion));
+    hash.update(reinterpret_cast<const char *>(&layoutSize), sizeof(layoutSize));
+    hash.update(reinterpret_cast<const char *>(&zeInfoDecoderVersion), sizeof(zeInfoDecoderVersion));
+    hash.update("----", 4);
+    hash.update(reinterpret_cast<const char *>(&grfSize), sizeof(grfSize));
+    hash.update(reinterpret_cast<const char *>(&minScratchSpaceSize), sizeof(minScratchSpaceSize));
+    hash.update(reinterpret_cast<const char *>(&appendElws), sizeof(appendElws));
+    hash.update("----", 4);
+    hash.update(zeInfo.data(), zeInfo.size());
+
+    auto res = hash.finish();
+    std::stringstream stream;
+    stream << "zeinfo_"
+           << std::setfill('0')
+           << std::setw(sizeof(res) * 2)
+           << std::hex
+           << res;
+    return stream.str();
+}
+
+std::vector<uint8_t> serializeDecodedZeInfo(const ProgramInfo &src, ConstStringRef decodeWarnings) {
+    for (const auto &kernelInfo : src.kernelInfos) {
+        for (const auto &extendedDescriptor : kernelInfo->kernelDescriptor.payloadMappings.explicitArgsExtendedDescriptors) {
+            if (nullptr != extendedDescriptor) {
+                return {};
+            }
+        }
+    }
+
+    BlobWriter writer;
+    DecodedZeInfoBlobHeader header;
+    header.layoutSize = layoutSize;
+    header.kernelsCount = static_cast<uint32_t>(src.kernelInfos.size());
+    writer.write(header);
+
+    writer.writeString(decodeWarnings.str());
+    writer.write(src.functionPointerWithIndirectAccessExists);
+
+    writer.write(static_cast<uint32_t>(src.globalsDeviceToHostNameMap.size()));
+    for (const auto &[deviceName, hostName] : src.globalsDeviceToHostNameMap) {
+        writer.writeString(deviceName);
+        writer.writeString(hostName);
+    }
+
+    writer.write(static_cast<uint32_t>(src.externalFunctions.size()));
+    for (const auto &externalFunction : src.externalFunctions) {
+        writer.writeString(externalFunction.functionName);
+        writer.write(externalFunction.barrierCount);
+        writer.write(externalFunction.numGrfRequired);
+        writer.write(externalFunction.simdSize);
+        writer.write(externalFunction.hasRTCalls);
+    }
+
+    for (const auto &kernelInfo : src.kernelInfos) {
+        serializeKernelDescriptor(writer, kernelInfo->kernelDescriptor);
+    }
+    return std::move(writer.data);
+}
+
+bool deserializeDecodedZeInfo(ProgramInfo &dst, ArrayRef<const uint8_t> blob, std::string &outWarning) {
+    BlobReader reader(blob);
+    DecodedZeInfoBlobHeader header;
+    if (false == reader.read(header)) {
+        return false;
+    }
+    if ((decodedZeInfoBlobMagic != header.magic) || (decodedZeInfoBlobVersion != header.version) || (layoutSize != header.layoutSize)) {
+        return false;
+    }
+
+    std::string warnings;
+    bool functionPointerWithIndirectAccessExists = false;
+    bool valid = reader.readString(warnings) && reader.read(functionPointerWithIndirectAccessExists);
+
+    std::unordered_map<std::string, std::string> globalsDeviceToHostNameMap;
+    uint32_t globalsCount = 0u;
+    valid = valid && reader.read(globalsCount);
+    for (uint32_t i = 0u; valid && i < globalsCount; i++) {
+        std::string deviceName, hostName;
+        valid = reader.readString(deviceName) && reader.readString(hostName);
+        globalsDeviceToHostNameMap[deviceName] = std::move(hostName);
+    }
+
+    std::vector<ExternalFunctionInfo> externalFunctions;
+    uint32_t externalFunctionsCount = 0u;
+    valid = valid && reader.read(externalFunctionsCount);
+    for (uint32_t i = 0u; valid && i < externalFunctionsCount; i++) {
+        ExternalFunctionInfo externalFunction;
+        valid = reader.readString(externalFunction.functionName) &&
+                reader.read(externalFunction.barrierCount) &&
+                reader.read(externalFunction.numGrfRequired) &&
+                reader.read(externalFunction.simdSize) &&
+                reader.read(externalFunction.hasRTCalls);
+        externalFunctions.push_back(std::move(externalFunction));
+    }
+
+    std::vector<std::unique_ptr<KernelInfo>> kernelInfos;
+    for (uint32_t i = 0u; valid && i < header.kernelsCount; i++) {
+        auto kernelInfo = std::make_unique<KernelInfo>();
+        valid = deserializeKernelDescriptor(reader, kernelInfo->kernelDescriptor);
+        kernelInfos.push_back(std::move(kernelInfo));
+    }
+
+    if (false == valid || false == reader.isFullyConsumed()) {
+        return false;
+    }
+
+    outWarning.append(warnings);
+    dst.functionPointerWithIndirectAccessExists |= functionPointerWithIndirectAccessExists;
+    for (auto &[deviceName, hostName] : globalsDeviceToHostNameMap) {
+        dst.globalsDeviceToHostNameMap[deviceName] = std::move(hostName);
+    }
+    for (auto &externalFunction : externalFunctions) {
+        dst.externalFunctions.push_back(std::move(externalFunction));
+    }
+    for (auto &kernelInfo : kernelInfos) {
+        dst.kernelInfos.push_back(kernelInfo.release());
+    }
+    return true;
+}
+
+} // namespace NEO::Zebin::ZeInfo
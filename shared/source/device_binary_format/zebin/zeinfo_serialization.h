@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/utilities/arrayref.h"
+#include "shared/source/utilities/const_stringref.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace NEO {
+struct ProgramInfo;
+
+namespace Zebin::ZeInfo {
+
+// Binary form of the program metadata produced by decodeZeInfo.
+// Contains only offsets and values (no pointers), so it can be stored in compiler cache and reused across processes.
+// Any change to the serialized structures must bump decodedZeInfoBlobVersion.
+inline constexpr uint32_t decodedZeInfoBlobMagic = 0x4349455a; // "ZEIC"
+inline constexpr uint32_t decodedZeInfoBlobVersion = 1u;
+
+struct DecodedZeInfoBlobHeader {
+    uint32_t magic = decodedZeInfoBlobMagic;
+    uint32_t version = decodedZeInfoBlobVersion;
+    uint32_t layoutSize = 0u;
+    uint32_t kernelsCount = 0u;
+};
+
+std::string getDecodedZeInfoCacheKey(ConstStringRef zeInfo, uint32_t grfSize, uint32_t minScratchSpaceSize);
+
+// returns empty blob when program contains metadata which can't be serialized
+std::vector<uint8_t> serializeDecodedZeInfo(const ProgramInfo &src, ConstStringRef decodeWarnings);
+
+// dst is modified only on success
+bool deserializeDecodedZeInfo(ProgramInfo &dst, ArrayRef<const uint8_t> blob, std::string &outWarning);
+
+} // namespace Zebin::ZeInfo
+} // namespace NEO
@@ -9,7 +9,6 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
-#include "shared/source/helpers/sleep.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_thread.h"
 #include "shared/source/os_interface/product_helper.h"
@@ -39,6 +38,9 @@ void DirectSubmissionController::registerDirectSubmission(CommandStreamReceiver
     std::lock_guard<std::mutex> lock(directSubmissionsMutex);
     directSubmissions.insert(std::make_pair(csr, DirectSubmissionState()));
     this->adjustTimeout(csr);
+    // ring may already be running after submit on init, so give it a deadline like any new submission
+    csr->setDirectSubmissionDeadlineArmed(true);
+    this->notifySubmission(csr);
 }
 
 void DirectSubmissionController::setTimeoutParamsForPlatform(const ProductHelper &helper) {
@@ -81,6 +83,23 @@ void DirectSubmissionController::unregisterDirectSubmission(CommandStreamReceive
     directSubmissions.erase(csr);
 }
 
+void DirectSubmissionController::notifySubmission(CommandStreamReceiver *csr) {
+    {
+        std::lock_guard<std::mutex> lock(this->wakeupMutex);
+        this->pendingSubmissions.push_back(csr);
+        this->wakeupRequested = true;
+    }
+    this->wakeupCondition.notify_one();
+}
+
+void DirectSubmissionController::requestWakeup() {
+    {
+        std::lock_guard<std::mutex> lock(this->wakeupMutex);
+        this->wakeupRequested = true;
+    }
+    this->wakeupCondition.notify_one();
+}
+
 void DirectSubmissionController::startThread() {
     directSubmissionControllingThread = Thread::create(controlDirectSubmissionsState, reinterpret_cast<void *>(this));
 }
@@ -88,6 +107,7 @@ void DirectSubmissionController::startThread() {
 void DirectSubmissionController::stopThread() {
     runControlling.store(false);
     keepControlling.store(false);
+    requestWakeup();
     if (directSubmissionControllingThread) {
         directSubmissionControllingThread->join();
         directSubmissionControllingThread.reset();
@@ -96,6 +116,7 @@ void DirectSubmissionController::stopThread() {
 
 void DirectSubmissionController::startControlling() {
     this->runControlling.store(true);
+    requestWakeup();
 }
 
 void *DirectSubmissionController::controlDirectSubmissionsState(void *self) {
@@ -121,38 +142,79 @@ void *DirectSubmissionController::controlDirectSubmissionsState(void *self) {
 
 void DirectSubmissionController::checkNewSubmissions() {
     std::lock_guard<std::mutex> lock(this->directSubmissionsMutex);
+    const auto now = this->getCpuTimestamp();
+
+    std::vector<CommandStreamReceiver *> submissions;
+    {
+        std::lock_guard<std::mutex> wakeupLock(this->wakeupMutex);
+        submissions.swap(this->pendingSubmissions);
+    }
+    for (auto csr : submissions) {
+        auto directSubmission = this->directSubmissions.find(csr);
+        if (directSubmission != this->directSubmissions.end()) {
+            this->updateSubmissionState(csr, directSubmission->second, csr->peekTaskCount(), now, now);
+        }
+    }
+
     bool shouldRecalculateTimeout = false;
-    for (auto &directSubmission : this->directSubmissions) {
-        auto csr = directSubmission.first;
-        auto &state = directSubmission.second;
+    while (!this->deadlines.empty() && this->deadlines.top().deadline <= now) {
+        const auto entry = this->deadlines.top();
+        this->deadlines.pop();
+
+        auto directSubmission = this->directSubmissions.find(entry.csr);
+        if (directSubmission == this->directSubmissions.end() ||
+            directSubmission->second.isStopped ||
+            directSubmission->second.deadline != entry.deadline) {
+            continue;
+        }
 
+        auto csr = entry.csr;
+        auto &state = directSubmission->second;
         auto taskCount = csr->peekTaskCount();
         if (taskCount == state.taskCount) {
-            if (state.isStopped) {
-                continue;
-            } else {
-                auto lock = csr->obtainUniqueOwnership();
-                csr->stopDirectSubmission(false);
-                state.isStopped = true;
-                shouldRecalculateTimeout = true;
-                this->lowestThrottleSubmitted = QueueThrottle::HIGH;
-            }
+            auto lock = csr->obtainUniqueOwnership();
+            csr->stopDirectSubmission(false);
+            csr->setDirectSubmissionDeadlineArmed(false);
+            state.isStopped = true;
+            shouldRecalculateTimeout = true;
+            this->lowestThrottleSubmitted = QueueThrottle::HIGH;
         } else {
-            state.isStopped = false;
-            state.taskCount = taskCount;
-            if (this->adjustTimeoutOnThrottleAndAcLineStatus) {
-                this->updateLastSubmittedThrottle(csr->getLastDirectSubmissionThrottle());
-                this->applyTimeoutForAcLineStatusAndThrottle(csr->getAcLineConnected(true));
-            }
+            // submissions kept coming while deadline was armed, so next one counts from the latest of them
+            this->updateSubmissionState(csr, state, taskCount, csr->getLastDirectSubmissionNotifyTimestamp(), now);
         }
     }
     if (shouldRecalculateTimeout) {
         this->recalculateTimeout();
     }
+
+    std::lock_guard<std::mutex> wakeupLock(this->wakeupMutex);
+    this->nextDeadline = this->deadlines.empty() ? SteadyClock::time_point::max() : this->deadlines.top().deadline;
+}
+
+void DirectSubmissionController::updateSubmissionState(CommandStreamReceiver *csr, DirectSubmissionState &state, TaskCountType taskCount, SteadyClock::time_point lastSubmission, SteadyClock::time_point now) {
+    state.isStopped = false;
+    state.taskCount = taskCount;
+    if (this->adjustTimeoutOnThrottleAndAcLineStatus) {
+        this->updateLastSubmittedThrottle(csr->getLastDirectSubmissionThrottle());
+        this->applyTimeoutForAcLineStatusAndThrottle(csr->getAcLineConnected(true));
+    }
+    state.deadline = lastSubmission + this->timeout;
+    if (state.deadline <= now) {
+        // task count changed without recorded submission time, do not stop ring in the same pass
+        state.deadline = now + this->timeout;
+    }
+    this->deadlines.push({state.deadline, csr});
 }
 
 void DirectSubmissionController::sleep() {
-    NEO::sleep(std::chrono::microseconds(this->timeout));
+    std::unique_lock<std::mutex> lock(this->wakeupMutex);
+    auto wakeupPredicate = [this] { return this->wakeupRequested || !this->keepControlling.load(); };
+    if (!this->runControlling.load() || this->nextDeadline == SteadyClock::time_point::max()) {
+        this->wakeupCondition.wait(lock, wakeupPredicate);
+    } else {
+        this->wakeupCondition.wait_for(lock, this->nextDeadline - this->getCpuTimestamp(), wakeupPredicate);
+    }
+    this->wakeupRequested = false;
 }
 
 SteadyClock::time_point DirectSubmissionController::getCpuTimestamp() {
@@ -14,9 +14,12 @@
 #include <array>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <queue>
 #include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class MemoryManager;
@@ -42,6 +45,7 @@ class DirectSubmissionController {
     void setTimeoutParamsForPlatform(const ProductHelper &helper);
     void registerDirectSubmission(CommandStreamReceiver *csr);
     void unregisterDirectSubmission(CommandStreamReceiver *csr);
+    void notifySubmission(CommandStreamReceiver *csr);
 
     void startThread();
     void startControlling();
@@ -54,6 +58,7 @@ class DirectSubmissionController {
         DirectSubmissionState(DirectSubmissionState &&other) {
             isStopped = other.isStopped.load();
             taskCount = other.taskCount.load();
+            deadline = other.deadline;
         }
         DirectSubmissionState &operator=(const DirectSubmissionState &other) {
             if (this == &other) {
@@ -61,6 +66,7 @@ class DirectSubmissionController {
             }
             this->isStopped = other.isStopped.load();
             this->taskCount = other.taskCount.load();
+            this->deadline = other.deadline;
             return *this;
         }
 
@@ -72,10 +78,20 @@ class DirectSubmissionController {
 
         std::atomic_bool isStopped{true};
         std::atomic<TaskCountType> taskCount{0};
+        SteadyClock::time_point deadline{};
+    };
+
+    struct DeadlineEntry {
+        bool operator>(const DeadlineEntry &other) const { return deadline > other.deadline; }
+
+        SteadyClock::time_point deadline;
+        CommandStreamReceiver *csr;
     };
 
     static void *controlDirectSubmissionsState(void *self);
     void checkNewSubmissions();
+    void updateSubmissionState(CommandStreamReceiver *csr, DirectSubmissionState &state, TaskCountType taskCount, SteadyClock::time_point lastSubmission, SteadyClock::time_point now);
+    void requestWakeup();
     MOCKABLE_VIRTUAL void sleep();
     MOCKABLE_VIRTUAL SteadyClock::time_point getCpuTimestamp();
 
@@ -88,8 +104,15 @@ class DirectSubmissionController {
     uint32_t maxCcsCount = 1u;
     std::array<uint32_t, DeviceBitfield().size()> ccsCount = {};
     std::unordered_map<CommandStreamReceiver *, DirectSubmissionState> directSubmissions;
+    std::priority_queue<DeadlineEntry, std::vector<DeadlineEntry>, std::greater<DeadlineEntry>> deadlines;
     std::mutex directSubmissionsMutex;
 
+    std::vector<CommandStreamReceiver *> pendingSubmissions;
+    SteadyClock::time_point nextDeadline = SteadyClock::time_point::max();
+    bool wakeupRequested = false;
+    std::condition_variable wakeupCondition;
+    std::mutex wakeupMutex;
+
     std::unique_ptr<Thread> directSubmissionControllingThread;
     std::atomic_bool keepControlling = true;
     std::atomic_bool runControlling = false;
@@ -54,6 +54,7 @@ inline constexpr bool defaultDisableMonitorFence = true;
 
 struct BatchBuffer;
 class DirectSubmissionDiagnosticsCollector;
+struct DirectSubmissionTelemetry;
 class FlushStampTracker;
 class GraphicsAllocation;
 struct HardwareInfo;
@@ -100,6 +101,10 @@ class DirectSubmissionHw {
         return this->lastSubmittedThrottle;
     }
 
+    const DirectSubmissionTelemetry *getTelemetry() const {
+        return this->telemetry.get();
+    }
+
   protected:
     static constexpr size_t prefetchSize = 8 * MemoryConstants::cacheLineSize;
     static constexpr size_t prefetchNoops = prefetchSize / sizeof(uint32_t);
@@ -185,6 +190,12 @@ class DirectSubmissionHw {
 
     void updateRelaxedOrderingQueueSize(uint32_t newSize);
 
+    void dispatchGpuStartTimestampSection();
+    size_t getSizeGpuStartTimestampSection();
+    void collectGpuStartTimestamp(uint32_t slot);
+    void collectGpuStartTimestamps();
+    void updateGpuCpuTimeReference();
+
     struct RingBufferUse {
         RingBufferUse() = default;
         RingBufferUse(FlushStamp completionFence, GraphicsAllocation *ringBuffer) : completionFence(completionFence), ringBuffer(ringBuffer){};
@@ -203,11 +214,13 @@ class DirectSubmissionHw {
 
     LinearStream ringCommandStream;
     std::unique_ptr<DirectSubmissionDiagnosticsCollector> diagnostic;
+    std::unique_ptr<DirectSubmissionTelemetry> telemetry;
 
     uint64_t semaphoreGpuVa = 0u;
     uint64_t gpuVaForMiFlush = 0u;
     uint64_t gpuVaForAdditionalSynchronizationWA = 0u;
     uint64_t relaxedOrderingQueueSizeLimitValueVa = 0;
+    uint64_t gpuStartTimestampsGpuVa = 0u;
 
     OsContext &osContext;
     const uint32_t rootDeviceIndex;
@@ -224,6 +237,7 @@ class DirectSubmissionHw {
     void *semaphorePtr = nullptr;
     volatile RingSemaphoreData *semaphoreData = nullptr;
     volatile void *workloadModeOneStoreAddress = nullptr;
+    volatile uint64_t *gpuStartTimestamps = nullptr;
     uint32_t *pciBarrierPtr = nullptr;
 
     uint32_t currentQueueWorkCount = 1u;
@@ -254,5 +268,6 @@ class DirectSubmissionHw {
     bool relaxedOrderingInitialized = false;
     bool relaxedOrderingSchedulerRequired = false;
     bool inputMonitorFenceDispatchRequirement = true;
+    bool printTelemetry = false;
 };
 } // namespace NEO
@@ -12,6 +12,7 @@
 #include "shared/source/device/device.h"
 #include "shared/source/direct_submission/direct_submission_hw.h"
 #include "shared/source/direct_submission/direct_submission_hw_diagnostic_mode.h"
+#include "shared/source/direct_submission/direct_submission_telemetry.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
@@ -19,15 +20,18 @@
 #include "shared/source/gmm_helper/gmm_lib.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/definitions/command_encoder_args.h"
+#include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/register_offsets.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/os_interface/os_time.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/utilities/cpu_info.h"
 #include "shared/source/utilities/cpuintrinsics.h"
@@ -99,6 +103,11 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(const DirectSubmis
     createDiagnostic();
     setImmWritePostSyncOffset();
 
+    if (debugManager.flags.DirectSubmissionTelemetry.get() > 0) {
+        telemetry = std::make_unique<DirectSubmissionTelemetry>();
+        printTelemetry = debugManager.flags.DirectSubmissionTelemetry.get() == 2;
+    }
+
     dcFlushRequired = MemorySynchronizationCommands<GfxFamily>::getDcFlushEnable(true, inputParams.rootDeviceEnvironment);
     auto &gfxCoreHelper = inputParams.rootDeviceEnvironment.getHelper<GfxCoreHelper>();
     relaxedOrderingEnabled = gfxCoreHelper.isRelaxedOrderingSupported();
@@ -318,7 +327,12 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchRelaxedOrderingScheduler
 }
 
 template <typename GfxFamily, typename Dispatcher>
-DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() = default;
+DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() {
+    if (telemetry && printTelemetry) {
+        collectGpuStartTimestamps();
+        PRINT_DEBUG_STRING(true, stdout, "%s", telemetry->toString(EngineHelpers::engineTypeToString(osContext.getEngineType())).c_str());
+    }
+}
 
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
@@ -408,6 +422,14 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
 
     this->gpuVaForMiFlush = this->semaphoreGpuVa + offsetof(RingSemaphoreData, miFlushSpace);
 
+    if (telemetry) {
+        static_assert(sizeof(RingSemaphoreData) + DirectSubmissionTelemetry::gpuStartTimestampSlotsCount * sizeof(uint64_t) <= MemoryConstants::pageSize,
+                      "GPU start timestamps do not fit into semaphore allocation");
+        gpuStartTimestamps = static_cast<volatile uint64_t *>(ptrOffset(semaphorePtr, sizeof(RingSemaphoreData)));
+        gpuStartTimestampsGpuVa = semaphoreGpuVa + sizeof(RingSemaphoreData);
+        memset(ptrOffset(semaphorePtr, sizeof(RingSemaphoreData)), 0, DirectSubmissionTelemetry::gpuStartTimestampSlotsCount * sizeof(uint64_t));
+    }
+
     auto ret = makeResourcesResident(allocations);
 
     return ret && allocateOsResources();
@@ -495,6 +517,10 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::initialize(bool submitOnInit, bo
         dispatchSemaphoreSection(currentQueueWorkCount);
 
         ringStart = submit(ringCommandStream.getGraphicsAllocation()->getGpuAddress(), startBufferSize);
+        if (telemetry && ringStart) {
+            DirectSubmissionTelemetry::increment(telemetry->ringStarts);
+            updateGpuCpuTimeReference();
+        }
         performDiagnosticMode();
         return ringStart;
     }
@@ -535,9 +561,15 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::stopRingBuffer(bool blocking) {
 
     this->handleStopRingBuffer();
     this->ringStart = false;
+    if (telemetry) {
+        DirectSubmissionTelemetry::increment(telemetry->ringStops);
+    }
 
     if (blocking) {
         this->ensureRingCompletion();
+        if (telemetry) {
+            collectGpuStartTimestamps();
+        }
     }
 
     return true;
@@ -547,6 +579,8 @@ template <typename GfxFamily, typename Dispatcher>
 inline void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchSemaphoreSection(uint32_t value) {
     using COMPARE_OPERATION = typename GfxFamily::MI_SEMAPHORE_WAIT::COMPARE_OPERATION;
 
+    const uint64_t startTimestamp = telemetry ? DirectSubmissionTelemetry::getTimestampNs() : 0u;
+
     dispatchDisablePrefetcher(true);
 
     if (this->relaxedOrderingEnabled && this->relaxedOrderingSchedulerRequired) {
@@ -564,6 +598,10 @@ inline void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchSemaphoreSection(
 
     dispatchPrefetchMitigation();
     dispatchDisablePrefetcher(false);
+
+    if (telemetry) {
+        telemetry->semaphoreSectionNs.record(DirectSubmissionTelemetry::getTimestampNs() - startTimestamp);
+    }
 }
 
 template <typename GfxFamily, typename Dispatcher>
@@ -633,6 +671,9 @@ inline size_t DirectSubmissionHw<GfxFamily, Dispatcher>::getSizeDispatch(bool re
     size_t size = getSizeSemaphoreSection(relaxedOrderingSchedulerRequired);
     if (workloadMode == 0) {
         size += getSizeStartSection();
+        if (telemetry) {
+            size += getSizeGpuStartTimestampSection();
+        }
         if (this->relaxedOrderingEnabled && returnPtrsRequired) {
             size += RelaxedOrderingHelper::getSizeReturnPtrRegs<GfxFamily>();
         }
@@ -662,6 +703,52 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::updateRelaxedOrderingQueueSize(u
                                                       nullptr);
 }
 
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchGpuStartTimestampSection() {
+    auto slot = telemetry->currentGpuStartTimestampSlot;
+    collectGpuStartTimestamp(slot);
+    gpuStartTimestamps[slot] = 0u;
+
+    auto slotGpuVa = gpuStartTimestampsGpuVa + slot * sizeof(uint64_t);
+    EncodeStoreMMIO<GfxFamily>::encode(ringCommandStream, RegisterOffsets::globalTimestampLdw, slotGpuVa, false, nullptr);
+    EncodeStoreMMIO<GfxFamily>::encode(ringCommandStream, RegisterOffsets::globalTimestampUn, slotGpuVa + sizeof(uint32_t), false, nullptr);
+}
+
+template <typename GfxFamily, typename Dispatcher>
+size_t DirectSubmissionHw<GfxFamily, Dispatcher>::getSizeGpuStartTimestampSection() {
+    return 2 * EncodeStoreMMIO<GfxFamily>::size;
+}
+
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::collectGpuStartTimestamp(uint32_t slot) {
+    auto &submitCpuTimestamp = telemetry->submitCpuTimestampsNs[slot];
+    uint64_t gpuStartTimestamp = gpuStartTimestamps[slot];
+    if (submitCpuTimestamp != 0u && gpuStartTimestamp != 0u) {
+        telemetry->recordSubmitToGpuStart(submitCpuTimestamp, gpuStartTimestamp);
+        gpuStartTimestamps[slot] = 0u;
+    }
+    submitCpuTimestamp = 0u;
+}
+
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::collectGpuStartTimestamps() {
+    if (gpuStartTimestamps == nullptr) {
+        return;
+    }
+    for (uint32_t slot = 0u; slot < DirectSubmissionTelemetry::gpuStartTimestampSlotsCount; slot++) {
+        collectGpuStartTimestamp(slot);
+    }
+}
+
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::updateGpuCpuTimeReference() {
+    auto osTime = this->rootDeviceEnvironment.osTime.get();
+    TimeStampData gpuCpuTime = {};
+    if (osTime && osTime->getGpuCpuTime(&gpuCpuTime)) {
+        telemetry->setGpuCpuTimeReference(gpuCpuTime.gpuTimeStamp, gpuCpuTime.cpuTimeinNS, osTime->getDynamicDeviceTimerResolution(*hwInfo));
+    }
+}
+
 template <typename GfxFamily, typename Dispatcher>
 void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadSection(BatchBuffer &batchBuffer, bool dispatchMonitorFence) {
     void *currentPosition = ringCommandStream.getSpace(0);
@@ -696,6 +783,10 @@ void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadSection(BatchBu
 
         auto copyCmdBuffer = this->copyCommandBufferIntoRing(batchBuffer);
 
+        if (telemetry) {
+            dispatchGpuStartTimestampSection();
+        }
+
         if (copyCmdBuffer) {
             auto cmdStreamTaskPtr = ptrOffset(batchBuffer.stream->getCpuBase(), batchBuffer.startOffset);
             auto sizeToCopy = ptrDiff(returnCmd, cmdStreamTaskPtr);
@@ -727,6 +818,9 @@ void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadSection(BatchBu
         if (expectedQueueSize > this->currentRelaxedOrderingQueueSize && debugManager.flags.DirectSubmissionRelaxedOrderingQueueSizeLimit.get() == -1) {
             updateRelaxedOrderingQueueSize(expectedQueueSize);
         }
+        if (telemetry) {
+            telemetry->relaxedOrderingQueueSize.record(expectedQueueSize);
+        }
     }
 
     if (!disableCacheFlush) {
@@ -937,6 +1031,8 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchUllsState() {
 
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffer &batchBuffer, FlushStampTracker &flushStamp) {
+    const uint64_t startTimestamp = telemetry ? DirectSubmissionTelemetry::getTimestampNs() : 0u;
+
     if (batchBuffer.ringBufferRestartRequest) {
         this->stopRingBuffer(false);
     }
@@ -990,10 +1086,29 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
 
     cpuCachelineFlush(currentPosition, dispatchSize);
 
+    uint64_t submitCpuTimestamp = 0u;
+    if (telemetry && workloadMode == 0 && this->rootDeviceEnvironment.osTime) {
+        this->rootDeviceEnvironment.osTime->getCpuTime(&submitCpuTimestamp);
+    }
+
     if (!this->submitCommandBufferToGpu(needStart, startVA, requiredMinimalSize)) {
         return false;
     }
 
+    if (telemetry) {
+        telemetry->dispatchCpuTimeNs.record(DirectSubmissionTelemetry::getTimestampNs() - startTimestamp);
+        DirectSubmissionTelemetry::increment(telemetry->submissions);
+        if (needStart) {
+            DirectSubmissionTelemetry::increment(telemetry->ringStarts);
+            updateGpuCpuTimeReference();
+        }
+        if (workloadMode == 0) {
+            auto &slot = telemetry->currentGpuStartTimestampSlot;
+            telemetry->submitCpuTimestampsNs[slot] = submitCpuTimestamp;
+            slot = (slot + 1) % DirectSubmissionTelemetry::gpuStartTimestampSlotsCount;
+        }
+    }
+
     cpuCachelineFlush(semaphorePtr, MemoryConstants::cacheLineSize);
     currentQueueWorkCount++;
     DirectSubmissionDiagnostics::diagnosticModeOneSubmit(diagnostic.get());
@@ -1066,6 +1181,9 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::switchRingBuffersNeeded(size_t s
 
 template <typename GfxFamily, typename Dispatcher>
 inline uint64_t DirectSubmissionHw<GfxFamily, Dispatcher>::switchRingBuffers(ResidencyContainer *allocationsForResidency) {
+    if (telemetry) {
+        DirectSubmissionTelemetry::increment(telemetry->ringSwitches);
+    }
     GraphicsAllocation *nextRingBuffer = switchRingBuffersAllocations();
     void *flushPtr = ringCommandStream.getSpace(0);
     uint64_t currentBufferGpuVa = ringCommandStream.getCurrentGpuAddressPosition();
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/direct_submission/direct_submission_telemetry.h"
+
+#include <sstream>
+
+namespace NEO {
+
+uint64_t LogScaleHistogram::getSamplesCount() const {
+    uint64_t samples = 0u;
+    for (const auto &bucket : buckets) {
+        samples += bucket.load(std::memory_order_relaxed);
+    }
+    return samples;
+}
+
+std::string LogScaleHistogram::toString() const {
+    std::stringstream value;
+    for (uint32_t index = 0u; index < bucketsCount; index++) {
+        auto samples = getBucket(index);
+        if (samples == 0u) {
+            continue;
+        }
+        uint64_t lowerBound = index == 0u ? 0u : (1ull << (index - 1u));
+        value << " [" << lowerBound;
+        if (index + 1u < bucketsCount) {
+            value << ", " << (1ull << index) << "): ";
+        } else {
+            value << ", inf): ";
+        }
+        value << samples;
+    }
+    return value.str();
+}
+
+std::string DirectSubmissionTelemetry::toString(const std::string &engineName) const {
+    std::stringstream value;
+    value << "ULLS telemetry " << engineName
+          << ": submissions " << submissions.load(std::memory_order_relaxed)
+          << ", ring starts " << ringStarts.load(std::memory_order_relaxed)
+          << ", ring stops " << ringStops.load(std::memory_order_relaxed)
+          << ", ring switches " << ringSwitches.load(std::memory_order_relaxed) << "\n";
+    value << "  dispatch cpu time ns:" << dispatchCpuTimeNs.toString() << "\n";
+    value << "  semaphore section ns:" << semaphoreSectionNs.toString() << "\n";
+    value << "  relaxed ordering queue size:" << relaxedOrderingQueueSize.toString() << "\n";
+    value << "  submit to gpu start ns:" << submitToGpuStartNs.toString() << "\n";
+    return value.str();
+}
+
+void DirectSubmissionTelemetry::recordSubmitToGpuStart(uint64_t submitCpuNs, uint64_t gpuStartTicks) {
+    if (gpuTimerResolutionNs == 0.0 || gpuStartTicks < referenceGpuTicks) {
+        return;
+    }
+    auto gpuStartCpuNs = referenceCpuNs + static_cast<uint64_t>((gpuStartTicks - referenceGpuTicks) * gpuTimerResolutionNs);
+    submitToGpuStartNs.record(gpuStartCpuNs > submitCpuNs ? gpuStartCpuNs - submitCpuNs : 0u);
+}
+
+} // namespace NEO
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace NEO {
+
+class LogScaleHistogram : NonCopyableOrMovableClass {
+  public:
+    // bucket 0 counts zero samples, bucket i counts samples in [2^(i-1), 2^i), last bucket is open ended
+    static constexpr uint32_t bucketsCount = 32u;
+
+    static uint32_t getBucketIndex(uint64_t value) {
+        if (value == 0u) {
+            return 0u;
+        }
+        return std::min(Math::log2(value) + 1u, bucketsCount - 1u);
+    }
+
+    void record(uint64_t value) {
+        buckets[getBucketIndex(value)].fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    uint64_t getBucket(uint32_t index) const {
+        return buckets[index].load(std::memory_order_relaxed);
+    }
+
+    uint64_t getSamplesCount() const;
+    std::string toString() const;
+
+  protected:
+    std::array<std::atomic<uint64_t>, bucketsCount> buckets{};
+};
+
+struct DirectSubmissionTelemetry : NonCopyableOrMovableClass {
+    // ring stores GPU timestamp at start of each batch into slot reused in round robin order,
+    // slot is collected before it is reused and when ring is stopped
+    static constexpr uint32_t gpuStartTimestampSlotsCount = 64u;
+
+    static uint64_t getTimestampNs() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    static void increment(std::atomic<uint64_t> &counter) {
+        counter.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    std::string toString(const std::string &engineName) const;
+
+    void setGpuCpuTimeReference(uint64_t gpuTicks, uint64_t cpuNs, double timerResolutionNs) {
+        referenceGpuTicks = gpuTicks;
+        referenceCpuNs = cpuNs;
+        gpuTimerResolutionNs = timerResolutionNs;
+    }
+    void recordSubmitToGpuStart(uint64_t submitCpuNs, uint64_t gpuStartTicks);
+
+    LogScaleHistogram dispatchCpuTimeNs;
+    LogScaleHistogram semaphoreSectionNs;
+    LogScaleHistogram relaxedOrderingQueueSize;
+    LogScaleHistogram submitToGpuStartNs;
+
+    std::atomic<uint64_t> submissions{0u};
+    std::atomic<uint64_t> ringStarts{0u};
+    std::atomic<uint64_t> ringStops{0u};
+    std::atomic<uint64_t> ringSwitches{0u};
+
+    // accessed only from submission path, which is serialized by command stream receiver
+    std::array<uint64_t, gpuStartTimestampSlotsCount> submitCpuTimestampsNs{};
+    uint32_t currentGpuStartTimestampSlot = 0u;
+    uint64_t referenceGpuTicks = 0u;
+    uint64_t referenceCpuNs = 0u;
+    double gpuTimerResolutionNs = 0.0;
+};
+
+} // namespace NEO
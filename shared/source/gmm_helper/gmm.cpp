@@ -347,6 +347,30 @@ uint8_t Gmm::resourceCopyBlt(void *sys, void *gpu, uint32_t pitch, uint32_t heig
     return this->gmmResourceInfo->cpuBlt(&gmmResourceCopyBLT);
 }
 
+uint8_t Gmm::resourceCopyBltRegion(void *sys, void *gpu, uint32_t rowPitch, uint32_t slicePitch, uint32_t bytesPerPixel, const size_t *origin, const size_t *region, unsigned char upload) {
+    GMM_RES_COPY_BLT gmmResourceCopyBLT = {};
+    auto width = static_cast<uint32_t>(region[0]);
+    auto height = static_cast<uint32_t>(region[1]);
+    auto slices = static_cast<uint32_t>(region[2]);
+
+    gmmResourceCopyBLT.Gpu.pData = gpu;
+    gmmResourceCopyBLT.Gpu.OffsetX = static_cast<uint32_t>(origin[0]);
+    gmmResourceCopyBLT.Gpu.OffsetY = static_cast<uint32_t>(origin[1]);
+    gmmResourceCopyBLT.Gpu.Slice = static_cast<uint32_t>(origin[2]);
+    gmmResourceCopyBLT.Sys.pData = sys;
+    gmmResourceCopyBLT.Sys.RowPitch = rowPitch;
+    gmmResourceCopyBLT.Sys.SlicePitch = slicePitch;
+    gmmResourceCopyBLT.Sys.PixelPitch = bytesPerPixel;
+    gmmResourceCopyBLT.Sys.BufferSize = slicePitch * (slices - 1) + rowPitch * (height - 1) + bytesPerPixel * width;
+    gmmResourceCopyBLT.Blt.Width = width;
+    gmmResourceCopyBLT.Blt.Height = height;
+    gmmResourceCopyBLT.Blt.Slices = slices;
+    gmmResourceCopyBLT.Blt.BytesPerPixel = bytesPerPixel;
+    gmmResourceCopyBLT.Blt.Upload = upload;
+
+    return this->gmmResourceInfo->cpuBlt(&gmmResourceCopyBLT);
+}
+
 bool Gmm::unifiedAuxTranslationCapable() const {
     auto gmmFlags = this->gmmResourceInfo->getResourceFlags();
     UNRECOVERABLE_IF(gmmFlags->Info.RenderCompressed && gmmFlags->Info.MediaCompressed);
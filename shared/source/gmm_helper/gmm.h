@@ -63,6 +63,8 @@ class Gmm {
     void updateImgInfoAndDesc(ImageInfo &imgInfo, uint32_t arrayIndex, ImagePlane yuvPlaneType);
     void updateOffsetsInImgInfo(ImageInfo &imgInfo, uint32_t arrayIndex);
     uint8_t resourceCopyBlt(void *sys, void *gpu, uint32_t pitch, uint32_t height, unsigned char upload, ImagePlane plane);
+    // origin and region are in pixels, rows and slices (array layers or depth slices), system memory pitches are in bytes
+    uint8_t resourceCopyBltRegion(void *sys, void *gpu, uint32_t rowPitch, uint32_t slicePitch, uint32_t bytesPerPixel, const size_t *origin, const size_t *region, unsigned char upload);
 
     uint32_t getUnifiedAuxPitchTiles();
     uint32_t getAuxQPitch();
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_memory_copy.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
+
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <system_error>
+#include <vector>
+
+namespace NEO {
+namespace CpuMemoryCopy {
+
+std::thread createStdThread(std::function<void()> &&work) {
+    return std::thread(std::move(work));
+}
+
+std::thread (*createWorkerThread)(std::function<void()> &&work) = createStdThread;
+
+uint32_t getWorkersCount(size_t size) {
+    auto workersCount = debugManager.flags.CpuTransferWorkerThreads.get();
+    size_t hwThreadsCount = std::max(1u, std::thread::hardware_concurrency());
+    if (workersCount == -1) {
+        // leave half of the hw threads for the application, memory bandwidth saturates with a few cores anyway
+        return static_cast<uint32_t>(std::max<size_t>(1u, std::min({hwThreadsCount / 2, static_cast<size_t>(maxDefaultWorkersCount), size / minChunkSizePerWorker})));
+    }
+    return static_cast<uint32_t>(std::min(static_cast<size_t>(std::max(workersCount, 1)), hwThreadsCount));
+}
+
+bool isStreamingStoresPreferred(size_t size, bool dstReadByCpu) {
+    auto streamingStores = debugManager.flags.CpuTransferStreamingStores.get();
+    if (streamingStores != -1) {
+        return streamingStores == 1;
+    }
+    return !dstReadByCpu && size >= minSizeForStreamingStores;
+}
+
+void copyWithStreamingStores(void *dst, const void *src, size_t size) {
+    constexpr size_t vectorSize = sizeof(__m128i);
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    auto headSize = std::min(size, ptrDiff(alignUp(dstBytes, vectorSize), dstBytes));
+    memcpy_s(dstBytes, headSize, srcBytes, headSize);
+    dstBytes += headSize;
+    srcBytes += headSize;
+    size -= headSize;
+
+    auto vectorsCount = size / vectorSize;
+    auto dstVectors = reinterpret_cast<__m128i *>(dstBytes);
+    auto srcVectors = reinterpret_cast<const __m128i *>(srcBytes);
+    for (size_t i = 0; i < vectorsCount; i++) {
+        _mm_stream_si128(dstVectors + i, _mm_loadu_si128(srcVectors + i));
+    }
+    _mm_sfence();
+
+    auto copiedSize = vectorsCount * vectorSize;
+    memcpy_s(dstBytes + copiedSize, size - copiedSize, srcBytes + copiedSize, size - copiedSize);
+}
+
+void copy(void *dst, const void *src, size_t size, bool dstReadByCpu) {
+    auto streamingStores = isStreamingStoresPreferred(size, dstReadByCpu);
+    auto copyChunk = [&](size_t offset, size_t chunkSize) {
+        if (streamingStores) {
+            copyWithStreamingStores(ptrOffset(dst, offset), ptrOffset(src, offset), chunkSize);
+        } else {
+            memcpy_s(ptrOffset(dst, offset), chunkSize, ptrOffset(src, offset), chunkSize);
+        }
+    };
+
+    const auto workersCount = std::min(static_cast<size_t>(getWorkersCount(size)), size / MemoryConstants::cacheLineSize);
+    if (workersCount <= 1u) {
+        copyChunk(0u, size);
+        return;
+    }
+
+    // chunks are cache line aligned, so workers never write to the same cache line
+    auto chunkSize = alignUp((size + workersCount - 1) / workersCount, MemoryConstants::cacheLineSize);
+    std::vector<std::thread> workers;
+    workers.reserve(workersCount - 1u);
+    size_t offset = chunkSize;
+    for (size_t i = 1u; i < workersCount && offset < size; i++, offset += chunkSize) {
+        auto currentChunkSize = std::min(chunkSize, size - offset);
+        try {
+            workers.push_back(createWorkerThread([&copyChunk, offset, currentChunkSize]() { copyChunk(offset, currentChunkSize); }));
+        } catch (const std::system_error &) {
+            // out of threads, copy remaining chunks here
+            copyChunk(offset, size - offset);
+            break;
+        }
+    }
+    copyChunk(0u, std::min(chunkSize, size));
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+} // namespace CpuMemoryCopy
+} // namespace NEO
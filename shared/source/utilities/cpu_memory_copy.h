@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+namespace NEO {
+namespace CpuMemoryCopy {
+
+// copies smaller than this are not worth waking up additional workers
+inline constexpr size_t minChunkSizePerWorker = 2 * MemoryConstants::megaByte;
+inline constexpr uint32_t maxDefaultWorkersCount = 4u;
+// destinations larger than this would evict most of the cache with regular stores
+inline constexpr size_t minSizeForStreamingStores = 2 * MemoryConstants::megaByte;
+
+// throws std::system_error when thread can't be created
+extern std::thread (*createWorkerThread)(std::function<void()> &&work);
+
+// never more than hardware threads count
+uint32_t getWorkersCount(size_t size);
+bool isStreamingStoresPreferred(size_t size, bool dstReadByCpu);
+
+// dstReadByCpu - destination is expected to be read by CPU soon after the copy (e.g. user host pointer),
+//                when false, large copies bypass the cache with non-temporal stores
+// chunks of workers which couldn't be started are copied on calling thread
+void copy(void *dst, const void *src, size_t size, bool dstReadByCpu);
+void copyWithStreamingStores(void *dst, const void *src, size_t size);
+
+} // namespace CpuMemoryCopy
+} // namespace NEO
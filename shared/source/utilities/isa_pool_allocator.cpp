@@ -7,11 +7,19 @@
 
 #include "shared/source/utilities/isa_pool_allocator.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/os_interface/product_helper.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/buffer_pool_allocator.inl"
 
+#include <cstring>
+#include <limits>
+
 namespace NEO {
 
 ISAPool::ISAPool(Device *device, bool isBuiltin, size_t storageSize)
@@ -72,7 +80,95 @@ ISAPoolAllocator::ISAPoolAllocator(Device *device) : device(device) {
  */
 SharedIsaAllocation *ISAPoolAllocator::requestGraphicsAllocationForIsa(bool isBuiltin, size_t size) {
     std::unique_lock lock(allocatorMtx);
+    return allocateISA(isBuiltin, size);
+}
+
+/**
+ * @brief This method returns SharedIsaAllocation holding given ISA content.
+ * If allocation with identical content and ISA type was already requested and is still in use,
+ * it is reused and its reference count is incremented. Otherwise, new allocation is created
+ * as in requestGraphicsAllocationForIsa and the content is uploaded to it.
+ *
+ * @param[in] isBuiltin flag specifying whether ISA will be used for builtin kernels
+ * @param[in] isaContent final (not requiring any patching) ISA, size of the content is the size of the allocation.
+ *
+ * @return returns SharedIsaAllocation or nullptr if allocation didn't succeeded
+ *
+ * @note no host copy of the content is kept, on hash match it is compared with contents of the allocation.
+ */
+SharedIsaAllocation *ISAPoolAllocator::requestDeduplicatedGraphicsAllocationForIsa(bool isBuiltin, ArrayRef<const uint8_t> isaContent) {
+    DEBUG_BREAK_IF(isaContent.empty());
+    auto isaContentHash = Hash::hash(reinterpret_cast<const char *>(isaContent.begin()), isaContent.size());
+
+    std::unique_lock lock(allocatorMtx);
+    auto [rangeBegin, rangeEnd] = deduplicatedIsaAllocations.equal_range(isaContentHash);
+    for (auto it = rangeBegin; it != rangeEnd; ++it) {
+        auto sharedIsaAllocation = it->second;
+        if ((sharedIsaAllocation->isBuiltin == isBuiltin) && (sharedIsaAllocation->getSize() == isaContent.size()) &&
+            isIsaContentEqual(*sharedIsaAllocation, isaContent)) {
+            ++sharedIsaAllocation->refCount;
+            return sharedIsaAllocation;
+        }
+    }
+
+    auto sharedIsaAllocation = allocateISA(isBuiltin, isaContent.size());
+    if (sharedIsaAllocation == nullptr) {
+        return nullptr;
+    }
+    if (false == uploadIsaContent(*sharedIsaAllocation, isaContent)) {
+        tryFreeFromPoolBuffer(sharedIsaAllocation->getGraphicsAllocation(), sharedIsaAllocation->getOffset(), sharedIsaAllocation->getSize());
+        delete sharedIsaAllocation;
+        return nullptr;
+    }
+    sharedIsaAllocation->deduplicated = true;
+    sharedIsaAllocation->isaContentHash = isaContentHash;
+    sharedIsaAllocation->isBuiltin = isBuiltin;
+    sharedIsaAllocation->refCount = 1u;
+    deduplicatedIsaAllocations.insert({isaContentHash, sharedIsaAllocation});
+    return sharedIsaAllocation;
+}
+
+bool ISAPoolAllocator::uploadIsaContent(SharedIsaAllocation &sharedIsaAllocation, ArrayRef<const uint8_t> isaContent) {
+    auto graphicsAllocation = sharedIsaAllocation.getGraphicsAllocation();
+    auto lock = sharedIsaAllocation.obtainSharedAllocationLock();
+    graphicsAllocation->setAubWritable(true, std::numeric_limits<uint32_t>::max());
+    graphicsAllocation->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+    auto useBlitter = device->getProductHelper().isBlitCopyRequiredForLocalMemory(device->getRootDeviceEnvironment(), *graphicsAllocation);
+    if (false == MemoryTransferHelper::transferMemoryToAllocation(useBlitter, *device, graphicsAllocation, sharedIsaAllocation.getOffset(),
+                                                                  isaContent.begin(), isaContent.size())) {
+        return false;
+    }
+
+    auto commandStreamReceiver = device->getDefaultEngine().commandStreamReceiver;
+    if (commandStreamReceiver->getType() != CommandStreamReceiverType::hardware) {
+        commandStreamReceiver->writeMemory(*graphicsAllocation);
+    }
+    return true;
+}
+
+bool ISAPoolAllocator::isIsaContentEqual(SharedIsaAllocation &sharedIsaAllocation, ArrayRef<const uint8_t> isaContent) {
+    auto graphicsAllocation = sharedIsaAllocation.getGraphicsAllocation();
+    auto memoryManager = device->getMemoryManager();
+
+    // allocation lock also serializes locking of the pool storage with ISA uploads of other users
+    auto lock = sharedIsaAllocation.obtainSharedAllocationLock();
+    auto cpuPtr = graphicsAllocation->getUnderlyingBuffer();
+    auto lockedForComparison = (cpuPtr == nullptr) && (false == graphicsAllocation->isLocked()) && graphicsAllocation->isAllocationLockable();
+    if (cpuPtr == nullptr) {
+        cpuPtr = lockedForComparison ? memoryManager->lockResource(graphicsAllocation) : graphicsAllocation->getLockedPtr();
+    }
+    if (cpuPtr == nullptr) {
+        return false;
+    }
+
+    auto isEqual = (0 == memcmp(ptrOffset(cpuPtr, sharedIsaAllocation.getOffset()), isaContent.begin(), isaContent.size()));
+    if (lockedForComparison) {
+        memoryManager->unlockResource(graphicsAllocation);
+    }
+    return isEqual;
+}
 
+SharedIsaAllocation *ISAPoolAllocator::allocateISA(bool isBuiltin, size_t size) {
     auto maxAllocationSize = getAllocationSize(isBuiltin);
 
     if (size > maxAllocationSize) {
@@ -101,9 +197,23 @@ SharedIsaAllocation *ISAPoolAllocator::requestGraphicsAllocationForIsa(bool isBu
  * @param[in] sharedIsaAllocation SharedIsaAllocation to free.
  *
  * @note actual chunk is not released immediately, it's freed during drain call.
+ * Allocation shared by content is released when its last user frees it.
  */
 void ISAPoolAllocator::freeSharedIsaAllocation(SharedIsaAllocation *sharedIsaAllocation) {
     std::unique_lock lock(allocatorMtx);
+    if (sharedIsaAllocation->isDeduplicated()) {
+        DEBUG_BREAK_IF(sharedIsaAllocation->refCount == 0u);
+        if (--sharedIsaAllocation->refCount > 0u) {
+            return;
+        }
+        auto [rangeBegin, rangeEnd] = deduplicatedIsaAllocations.equal_range(sharedIsaAllocation->isaContentHash);
+        for (auto it = rangeBegin; it != rangeEnd; ++it) {
+            if (it->second == sharedIsaAllocation) {
+                deduplicatedIsaAllocations.erase(it);
+                break;
+            }
+        }
+    }
     tryFreeFromPoolBuffer(sharedIsaAllocation->getGraphicsAllocation(), sharedIsaAllocation->getOffset(), sharedIsaAllocation->getSize());
     delete sharedIsaAllocation;
 }
@@ -8,9 +8,11 @@
 #pragma once
 
 #include "shared/source/helpers/constants.h"
+#include "shared/source/utilities/arrayref.h"
 #include "shared/source/utilities/buffer_pool_allocator.h"
 
 #include <mutex>
+#include <unordered_map>
 
 namespace NEO {
 class GraphicsAllocation;
@@ -37,11 +39,23 @@ class SharedIsaAllocation {
         return std::unique_lock<std::mutex>(mtx);
     }
 
-  private:
+    bool isDeduplicated() const {
+        return deduplicated;
+    }
+
+  protected:
+    friend class ISAPoolAllocator;
+
     GraphicsAllocation *graphicsAllocation;
     const size_t offset;
     const size_t size;
     std::mutex &mtx; // This mutex is shared across all users of this GA
+
+    // Set only for allocations shared by content, see ISAPoolAllocator::requestDeduplicatedGraphicsAllocationForIsa
+    uint64_t isaContentHash = 0u;
+    uint32_t refCount = 0u;
+    bool isBuiltin = false;
+    bool deduplicated = false;
 };
 
 // Each shared GA is maintained by single ISAPool
@@ -69,10 +83,14 @@ class ISAPoolAllocator : public AbstractBuffersAllocator<ISAPool, GraphicsAlloca
   public:
     ISAPoolAllocator(Device *device);
     SharedIsaAllocation *requestGraphicsAllocationForIsa(bool isBuiltin, size_t size);
+    SharedIsaAllocation *requestDeduplicatedGraphicsAllocationForIsa(bool isBuiltin, ArrayRef<const uint8_t> isaContent);
     void freeSharedIsaAllocation(SharedIsaAllocation *sharedIsaAllocation);
 
   private:
+    SharedIsaAllocation *allocateISA(bool isBuiltin, size_t size);
     SharedIsaAllocation *tryAllocateISA(bool isBuiltin, size_t size);
+    bool uploadIsaContent(SharedIsaAllocation &sharedIsaAllocation, ArrayRef<const uint8_t> isaContent);
+    bool isIsaContentEqual(SharedIsaAllocation &sharedIsaAllocation, ArrayRef<const uint8_t> isaContent);
 
     size_t getAllocationSize(bool isBuiltin) const {
         return isBuiltin ? buitinAllocationSize : userAllocationSize;
@@ -81,6 +99,7 @@ class ISAPoolAllocator : public AbstractBuffersAllocator<ISAPool, GraphicsAlloca
     Device *device;
     size_t userAllocationSize = MemoryConstants::pageSize2M * 2;
     size_t buitinAllocationSize = MemoryConstants::pageSize64k;
+    std::unordered_multimap<uint64_t, SharedIsaAllocation *> deduplicatedIsaAllocations;
     std::mutex allocatorMtx;
 };
 
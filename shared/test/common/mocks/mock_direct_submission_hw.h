@@ -47,6 +47,7 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::getSizeDispatch;
     using BaseClass::getSizeDispatchRelaxedOrderingQueueStall;
     using BaseClass::getSizeEnd;
+    using BaseClass::getSizeGpuStartTimestampSection;
     using BaseClass::getSizeNewResourceHandler;
     using BaseClass::getSizePartitionRegisterConfigurationSection;
     using BaseClass::getSizePrefetchMitigation;
@@ -54,6 +55,8 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::getSizeStartSection;
     using BaseClass::getSizeSwitchRingBufferSection;
     using BaseClass::getSizeSystemMemoryFenceAddress;
+    using BaseClass::gpuStartTimestamps;
+    using BaseClass::gpuStartTimestampsGpuVa;
     using BaseClass::hwInfo;
     using BaseClass::immWritePostSyncOffset;
     using BaseClass::inputMonitorFenceDispatchRequirement;
@@ -75,6 +78,7 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::ringBuffers;
     using BaseClass::ringCommandStream;
     using BaseClass::ringStart;
+    using BaseClass::telemetry;
     using BaseClass::rootDeviceEnvironment;
     using BaseClass::semaphoreData;
     using BaseClass::semaphoreGpuVa;
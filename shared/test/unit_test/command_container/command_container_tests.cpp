@@ -420,7 +420,7 @@ TEST_F(CommandContainerTest, givenCommandContainerWhenInitializeThenCmdBuffersAr
     EXPECT_EQ(cmdContainer.getResidencyContainer().size(), cmdContainer.getCmdBufferAllocations().size());
 }
 
-TEST_F(CommandContainerTest, givenCommandContainerWhenWantToAddAlreadyAddedAllocationAndDuplicatesRemovedThenExpectedSizeIsReturned) {
+TEST_F(CommandContainerTest, givenCommandContainerWhenWantToAddAlreadyAddedAllocationThenItIsNotAddedAgain) {
     CommandContainer cmdContainer;
     cmdContainer.initialize(pDevice, nullptr, HeapSize::defaultHeapSize, true, false);
     MockGraphicsAllocation mockAllocation;
@@ -435,7 +435,7 @@ TEST_F(CommandContainerTest, givenCommandContainerWhenWantToAddAlreadyAddedAlloc
     cmdContainer.addToResidencyContainer(&mockAllocation);
     auto sizeAfterSecondAdd = cmdContainer.getResidencyContainer().size();
 
-    EXPECT_NE(sizeAfterFirstAdd, sizeAfterSecondAdd);
+    EXPECT_EQ(sizeAfterFirstAdd, sizeAfterSecondAdd);
 
     cmdContainer.removeDuplicatesFromResidencyContainer();
     auto sizeAfterDuplicatesRemoved = cmdContainer.getResidencyContainer().size();
@@ -443,6 +443,107 @@ TEST_F(CommandContainerTest, givenCommandContainerWhenWantToAddAlreadyAddedAlloc
     EXPECT_EQ(sizeAfterFirstAdd, sizeAfterDuplicatesRemoved);
 }
 
+TEST_F(CommandContainerTest, givenAllocationPushedDirectlyToResidencyContainerWhenDuplicatesRemovedThenFirstOccurrencesAreKeptInOrder) {
+    CommandContainer cmdContainer;
+    MockGraphicsAllocation mockAllocation0;
+    MockGraphicsAllocation mockAllocation1;
+    MockGraphicsAllocation mockAllocation2;
+
+    auto &residencyContainer = cmdContainer.getResidencyContainer();
+    residencyContainer.push_back(&mockAllocation1);
+    residencyContainer.push_back(nullptr);
+    residencyContainer.push_back(&mockAllocation0);
+    residencyContainer.push_back(&mockAllocation1);
+    residencyContainer.push_back(&mockAllocation2);
+    residencyContainer.push_back(&mockAllocation0);
+
+    cmdContainer.removeDuplicatesFromResidencyContainer();
+
+    ASSERT_EQ(3u, residencyContainer.size());
+    EXPECT_EQ(&mockAllocation1, residencyContainer[0]);
+    EXPECT_EQ(&mockAllocation0, residencyContainer[1]);
+    EXPECT_EQ(&mockAllocation2, residencyContainer[2]);
+
+    cmdContainer.addToResidencyContainer(&mockAllocation2);
+    EXPECT_EQ(3u, residencyContainer.size());
+}
+
+TEST_F(CommandContainerTest, givenResidencyContainerClearedOrEntryErasedWhenAllocationIsAddedAgainThenItIsAdded) {
+    CommandContainer cmdContainer;
+    MockGraphicsAllocation mockAllocation0;
+    MockGraphicsAllocation mockAllocation1;
+
+    auto &residencyContainer = cmdContainer.getResidencyContainer();
+    cmdContainer.addToResidencyContainer(&mockAllocation0);
+    cmdContainer.addToResidencyContainer(&mockAllocation1);
+    ASSERT_EQ(2u, residencyContainer.size());
+
+    residencyContainer.clear();
+    cmdContainer.addToResidencyContainer(&mockAllocation1);
+    ASSERT_EQ(1u, residencyContainer.size());
+    EXPECT_EQ(&mockAllocation1, residencyContainer[0]);
+
+    cmdContainer.addToResidencyContainer(&mockAllocation0);
+    residencyContainer.erase(residencyContainer.begin());
+    cmdContainer.addToResidencyContainer(&mockAllocation1);
+    ASSERT_EQ(2u, residencyContainer.size());
+    EXPECT_EQ(&mockAllocation0, residencyContainer[0]);
+    EXPECT_EQ(&mockAllocation1, residencyContainer[1]);
+
+    cmdContainer.addToResidencyContainer(&mockAllocation0);
+    EXPECT_EQ(2u, residencyContainer.size());
+}
+
+TEST_F(CommandContainerTest, givenAllocationAddedToTwoCommandContainersWhenAddedAgainThenEachContainerHoldsItOnce) {
+    CommandContainer cmdContainer0;
+    CommandContainer cmdContainer1;
+    MockGraphicsAllocation mockAllocation;
+
+    cmdContainer0.addToResidencyContainer(&mockAllocation);
+    cmdContainer1.addToResidencyContainer(&mockAllocation);
+    cmdContainer1.addToResidencyContainer(&mockAllocation);
+    cmdContainer0.addToResidencyContainer(&mockAllocation);
+
+    cmdContainer0.removeDuplicatesFromResidencyContainer();
+    cmdContainer1.removeDuplicatesFromResidencyContainer();
+
+    ASSERT_EQ(1u, cmdContainer0.getResidencyContainer().size());
+    ASSERT_EQ(1u, cmdContainer1.getResidencyContainer().size());
+    EXPECT_EQ(&mockAllocation, cmdContainer0.getResidencyContainer()[0]);
+    EXPECT_EQ(&mockAllocation, cmdContainer1.getResidencyContainer()[0]);
+}
+
+TEST_F(CommandContainerTest, givenAllocationSharedByCommandContainersWhenAddingItInterleavedThenEachContainerSkipsItsOwnDuplicateWithoutRemovingDuplicates) {
+    CommandContainer cmdContainer0;
+    CommandContainer cmdContainer1;
+    MockGraphicsAllocation sharedAllocation;
+    MockGraphicsAllocation allocation0;
+    MockGraphicsAllocation allocation1;
+
+    cmdContainer0.addToResidencyContainer(&allocation0);
+    cmdContainer0.addToResidencyContainer(&sharedAllocation);
+    cmdContainer1.addToResidencyContainer(&sharedAllocation);
+    cmdContainer1.addToResidencyContainer(&allocation1);
+    cmdContainer0.addToResidencyContainer(&sharedAllocation);
+    cmdContainer1.addToResidencyContainer(&sharedAllocation);
+
+    auto &residencyContainer0 = cmdContainer0.getResidencyContainer();
+    auto &residencyContainer1 = cmdContainer1.getResidencyContainer();
+    ASSERT_EQ(2u, residencyContainer0.size());
+    EXPECT_EQ(&allocation0, residencyContainer0[0]);
+    EXPECT_EQ(&sharedAllocation, residencyContainer0[1]);
+    ASSERT_EQ(2u, residencyContainer1.size());
+    EXPECT_EQ(&sharedAllocation, residencyContainer1[0]);
+    EXPECT_EQ(&allocation1, residencyContainer1[1]);
+
+    residencyContainer0.erase(residencyContainer0.begin());
+    cmdContainer0.removeDuplicatesFromResidencyContainer();
+    cmdContainer1.addToResidencyContainer(&sharedAllocation);
+    cmdContainer0.addToResidencyContainer(&sharedAllocation);
+    EXPECT_EQ(1u, residencyContainer0.size());
+    EXPECT_EQ(2u, residencyContainer1.size());
+}
+
 HWTEST_F(CommandContainerTest, givenCmdContainerWhenInitializeCalledThenSSHHeapHasBindlessOffsetReserved) {
     using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
     std::unique_ptr<CommandContainer> cmdContainer(new CommandContainer);
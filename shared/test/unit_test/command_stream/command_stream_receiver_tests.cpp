@@ -2920,6 +2920,43 @@ HWTEST_F(CommandStreamReceiverHwTest, givenFailureOnFlushWhenFlushingBcsTaskThen
     EXPECT_EQ(CompletionStamp::failed, commandStreamReceiver.flushBcsTask(container, true, false, *pDevice));
 }
 
+HWTEST_F(CommandStreamReceiverHwTest, givenRingStoppedByDirectSubmissionControllerWhenFlushingBcsTaskThenControllerIsNotifiedAndStopsRingAgainAfterTimeout) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.blitterDirectSubmissionAvailable = true;
+    commandStreamReceiver.callBaseStopDirectSubmission = false;
+
+    auto controller = new DirectSubmissionControllerMock();
+    pDevice->executionEnvironment->directSubmissionController.reset(controller);
+    controller->registerDirectSubmission(&commandStreamReceiver);
+    controller->checkNewSubmissions();
+    controller->cpuTimestamp += controller->timeout;
+    controller->checkNewSubmissions();
+    EXPECT_TRUE(controller->directSubmissions[&commandStreamReceiver].isStopped);
+    commandStreamReceiver.stopDirectSubmissionCalled = false;
+
+    auto blitProperties = BlitProperties::constructPropertiesForReadWrite(BlitterConstants::BlitDirection::bufferToHostPtr,
+                                                                          commandStreamReceiver, commandStreamReceiver.getTagAllocation(), nullptr,
+                                                                          commandStreamReceiver.getTagAllocation()->getUnderlyingBuffer(),
+                                                                          commandStreamReceiver.getTagAllocation()->getGpuAddress(), 0,
+                                                                          0, 0, 0, 0, 0, 0, 0);
+    BlitPropertiesContainer container;
+    container.push_back(blitProperties);
+
+    auto taskCount = commandStreamReceiver.flushBcsTask(container, false, false, *pDevice);
+    EXPECT_EQ(1u, controller->pendingSubmissions.size());
+
+    controller->checkNewSubmissions();
+    EXPECT_FALSE(controller->directSubmissions[&commandStreamReceiver].isStopped);
+    EXPECT_EQ(taskCount, controller->directSubmissions[&commandStreamReceiver].taskCount);
+
+    controller->cpuTimestamp += controller->timeout;
+    controller->checkNewSubmissions();
+    EXPECT_TRUE(controller->directSubmissions[&commandStreamReceiver].isStopped);
+    EXPECT_TRUE(commandStreamReceiver.stopDirectSubmissionCalled);
+
+    controller->unregisterDirectSubmission(&commandStreamReceiver);
+}
+
 HWTEST_F(CommandStreamReceiverHwTest, givenFlushBcsTaskVerifyLatestSentTaskCountUpdated) {
 
     auto executionEnvironment = std::make_unique<MockExecutionEnvironment>(defaultHwInfo.get(), true, 2u);
@@ -0,0 +1,249 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_build_scheduler.h"
+#include "shared/test/common/fixtures/device_fixture.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace NEO;
+
+namespace {
+TranslationOutput::ErrorCode setDeviceBinary(TranslationOutput &output, const std::string &binary) {
+    output.deviceBinary.mem = makeCopy(binary.data(), binary.size());
+    output.deviceBinary.size = binary.size();
+    output.backendCompilerLog = "log";
+    return TranslationOutput::ErrorCode::success;
+}
+
+template <typename PredicateT>
+void waitForStatistics(const CompilerBuildScheduler &scheduler, PredicateT predicate) {
+    while (false == predicate(scheduler.getStatistics())) {
+        std::this_thread::yield();
+    }
+}
+} // namespace
+
+TEST(CompilerBuildSchedulerTest, whenBuildIsRequestedThenBuildFunctionIsExecutedAndStatisticsAreUpdated) {
+    CompilerBuildScheduler scheduler(2u);
+    EXPECT_EQ(2u, scheduler.getMaxConcurrentBuilds());
+
+    TranslationOutput output;
+    uint32_t buildCalls = 0u;
+    auto result = scheduler.build("key", output, [&buildCalls](TranslationOutput &out) {
+        ++buildCalls;
+        return setDeviceBinary(out, "binary");
+    });
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, result);
+    EXPECT_EQ(1u, buildCalls);
+    ASSERT_EQ(6u, output.deviceBinary.size);
+    EXPECT_EQ(0, memcmp("binary", output.deviceBinary.mem.get(), output.deviceBinary.size));
+
+    auto statistics = scheduler.getStatistics();
+    EXPECT_EQ(1u, statistics.buildsExecuted);
+    EXPECT_EQ(0u, statistics.buildsDeduplicated);
+    EXPECT_EQ(0u, statistics.buildsQueued);
+    EXPECT_EQ(0u, statistics.buildsActive);
+    EXPECT_EQ(1u, statistics.maxBuildsQueued);
+
+    TranslationOutput secondOutput;
+    scheduler.build("key", secondOutput, [&buildCalls](TranslationOutput &out) {
+        ++buildCalls;
+        return setDeviceBinary(out, "binary");
+    });
+    EXPECT_EQ(2u, buildCalls);
+}
+
+TEST(CompilerBuildSchedulerTest, givenZeroMaxConcurrentBuildsWhenCreatingSchedulerThenSingleBuildIsAllowed) {
+    CompilerBuildScheduler scheduler(0u);
+    EXPECT_EQ(1u, scheduler.getMaxConcurrentBuilds());
+}
+
+TEST(CompilerBuildSchedulerTest, givenIdenticalBuildInFlightWhenBuildIsRequestedThenItWaitsForInFlightBuildAndGetsCopyOfItsOutput) {
+    CompilerBuildScheduler scheduler(4u);
+    std::atomic<bool> releaseBuild = false;
+    std::atomic<uint32_t> buildCalls = 0u;
+    auto blockingBuild = [&](TranslationOutput &out) {
+        ++buildCalls;
+        while (false == releaseBuild) {
+            std::this_thread::yield();
+        }
+        return setDeviceBinary(out, "binary");
+    };
+
+    TranslationOutput firstOutput;
+    TranslationOutput::ErrorCode firstResult = TranslationOutput::ErrorCode::unknownError;
+    std::thread firstThread([&] { firstResult = scheduler.build("key", firstOutput, blockingBuild); });
+    waitForStatistics(scheduler, [](const CompilerBuildStatistics &statistics) { return statistics.buildsActive == 1u; });
+
+    TranslationOutput secondOutput;
+    TranslationOutput::ErrorCode secondResult = TranslationOutput::ErrorCode::unknownError;
+    std::thread secondThread([&] { secondResult = scheduler.build("key", secondOutput, blockingBuild); });
+    waitForStatistics(scheduler, [](const CompilerBuildStatistics &statistics) { return statistics.buildsDeduplicated == 1u; });
+
+    releaseBuild = true;
+    firstThread.join();
+    secondThread.join();
+
+    EXPECT_EQ(1u, buildCalls);
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, firstResult);
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, secondResult);
+    ASSERT_EQ(firstOutput.deviceBinary.size, secondOutput.deviceBinary.size);
+    EXPECT_NE(firstOutput.deviceBinary.mem.get(), secondOutput.deviceBinary.mem.get());
+    EXPECT_EQ(0, memcmp(firstOutput.deviceBinary.mem.get(), secondOutput.deviceBinary.mem.get(), firstOutput.deviceBinary.size));
+    EXPECT_EQ(firstOutput.backendCompilerLog, secondOutput.backendCompilerLog);
+
+    auto statistics = scheduler.getStatistics();
+    EXPECT_EQ(1u, statistics.buildsExecuted);
+    EXPECT_EQ(1u, statistics.buildsDeduplicated);
+}
+
+TEST(CompilerBuildSchedulerTest, givenMaxConcurrentBuildsReachedWhenBuildIsRequestedThenItIsQueuedUntilBuildSlotIsReleased) {
+    CompilerBuildScheduler scheduler(1u);
+    std::atomic<bool> releaseBuild = false;
+    std::atomic<uint32_t> buildCalls = 0u;
+    auto blockingBuild = [&](TranslationOutput &out) {
+        ++buildCalls;
+        while (false == releaseBuild) {
+            std::this_thread::yield();
+        }
+        return setDeviceBinary(out, "binary");
+    };
+
+    TranslationOutput firstOutput;
+    std::thread firstThread([&] { scheduler.build("first", firstOutput, blockingBuild); });
+    waitForStatistics(scheduler, [](const CompilerBuildStatistics &statistics) { return statistics.buildsActive == 1u; });
+
+    TranslationOutput secondOutput;
+    std::thread secondThread([&] { scheduler.build("second", secondOutput, blockingBuild); });
+    waitForStatistics(scheduler, [](const CompilerBuildStatistics &statistics) { return statistics.buildsQueued == 1u; });
+    EXPECT_EQ(1u, buildCalls);
+
+    releaseBuild = true;
+    firstThread.join();
+    secondThread.join();
+
+    EXPECT_EQ(2u, buildCalls);
+    auto statistics = scheduler.getStatistics();
+    EXPECT_EQ(2u, statistics.buildsExecuted);
+    EXPECT_EQ(0u, statistics.buildsDeduplicated);
+    EXPECT_EQ(1u, statistics.maxBuildsQueued);
+    EXPECT_EQ(0u, statistics.buildsQueued);
+}
+
+TEST(CompilerBuildSchedulerTest, givenEmptyBuildKeyWhenIdenticalBuildIsInFlightThenBuildsAreNotJoined) {
+    CompilerBuildScheduler scheduler(2u);
+    std::atomic<bool> releaseBuild = false;
+    std::atomic<uint32_t> buildCalls = 0u;
+    auto blockingBuild = [&](TranslationOutput &out) {
+        ++buildCalls;
+        while (false == releaseBuild) {
+            std::this_thread::yield();
+        }
+        return setDeviceBinary(out, "binary");
+    };
+
+    TranslationOutput firstOutput;
+    std::thread firstThread([&] { scheduler.build("", firstOutput, blockingBuild); });
+    TranslationOutput secondOutput;
+    std::thread secondThread([&] { scheduler.build("", secondOutput, blockingBuild); });
+    waitForStatistics(scheduler, [](const CompilerBuildStatistics &statistics) { return statistics.buildsActive == 2u; });
+
+    releaseBuild = true;
+    firstThread.join();
+    secondThread.join();
+
+    EXPECT_EQ(2u, buildCalls);
+    EXPECT_EQ(0u, scheduler.getStatistics().buildsDeduplicated);
+}
+
+TEST(CompilerBuildSchedulerTest, givenCompilerMaxConcurrentBuildsFlagWhenGettingDefaultMaxConcurrentBuildsThenFlagValueIsReturned) {
+    DebugManagerStateRestore restorer;
+    EXPECT_LE(1u, CompilerBuildScheduler::getDefaultMaxConcurrentBuilds());
+
+    debugManager.flags.CompilerMaxConcurrentBuilds.set(3);
+    EXPECT_EQ(3u, CompilerBuildScheduler::getDefaultMaxConcurrentBuilds());
+}
+
+using CompilerBuildSchedulerKeyTest = Test<DeviceFixture>;
+
+TEST_F(CompilerBuildSchedulerKeyTest, givenTranslationInputsWhenGettingBuildKeyThenKeyDependsOnAllBuildInputs) {
+    const char src[] = "spirv";
+    const char options[] = "-options";
+    TranslationInput input = {IGC::CodeType::spirV, IGC::CodeType::oclGenBin};
+    input.src = ArrayRef<const char>(src, sizeof(src));
+    input.apiOptions = ArrayRef<const char>(options, sizeof(options));
+    input.specializedValues[1] = 2u;
+
+    TranslationInput sameInput = {IGC::CodeType::spirV, IGC::CodeType::oclGenBin};
+    sameInput.src = ArrayRef<const char>(src, sizeof(src));
+    sameInput.apiOptions = ArrayRef<const char>(options, sizeof(options));
+    sameInput.specializedValues[1] = 2u;
+
+    auto key = CompilerBuildScheduler::getBuildKey(*pDevice, input);
+    EXPECT_FALSE(key.empty());
+    EXPECT_EQ(key, CompilerBuildScheduler::getBuildKey(*pDevice, sameInput));
+
+    sameInput.specializedValues[1] = 3u;
+    EXPECT_NE(key, CompilerBuildScheduler::getBuildKey(*pDevice, sameInput));
+    sameInput.specializedValues[1] = 2u;
+
+    sameInput.apiOptions = {};
+    EXPECT_NE(key, CompilerBuildScheduler::getBuildKey(*pDevice, sameInput));
+    sameInput.apiOptions = ArrayRef<const char>(options, sizeof(options));
+
+    sameInput.outType = IGC::CodeType::llvmBc;
+    EXPECT_NE(key, CompilerBuildScheduler::getBuildKey(*pDevice, sameInput));
+    sameInput.outType = IGC::CodeType::oclGenBin;
+
+    const char tracingOptions[] = {1, 0, 0, 0};
+    const char otherTracingOptions[] = {2, 0, 0, 0};
+    sameInput.tracingOptions = tracingOptions;
+    sameInput.tracingOptionsCount = sizeof(tracingOptions);
+    auto tracingKey = CompilerBuildScheduler::getBuildKey(*pDevice, sameInput);
+    EXPECT_NE(key, tracingKey);
+    sameInput.tracingOptions = otherTracingOptions;
+    EXPECT_NE(tracingKey, CompilerBuildScheduler::getBuildKey(*pDevice, sameInput));
+    sameInput.tracingOptions = nullptr;
+    sameInput.tracingOptionsCount = 0;
+    EXPECT_EQ(key, CompilerBuildScheduler::getBuildKey(*pDevice, sameInput));
+
+    auto otherDevice = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    EXPECT_NE(key, CompilerBuildScheduler::getBuildKey(*otherDevice, sameInput));
+
+    int gtPinInput = 0;
+    sameInput.gtPinInput = &gtPinInput;
+    EXPECT_TRUE(CompilerBuildScheduler::getBuildKey(*pDevice, sameInput).empty());
+}
+
+TEST_F(CompilerBuildSchedulerKeyTest, givenPreparedSrcWhenGettingBuildKeyThenPreparedSrcDigestIsUsedInsteadOfSrc) {
+    const char src[] = "spirv";
+    const char otherSrc[] = "SPIRV";
+    PreparedSpirV preparedSpirV;
+    preparedSpirV.hash = 0x1234u;
+    preparedSpirV.size = sizeof(src);
+
+    TranslationInput input = {IGC::CodeType::spirV, IGC::CodeType::oclGenBin};
+    input.src = ArrayRef<const char>(src, sizeof(src));
+    auto keyWithoutPreparedSrc = CompilerBuildScheduler::getBuildKey(*pDevice, input);
+
+    input.preparedSrc = &preparedSpirV;
+    auto key = CompilerBuildScheduler::getBuildKey(*pDevice, input);
+    EXPECT_NE(keyWithoutPreparedSrc, key);
+
+    input.src = ArrayRef<const char>(otherSrc, sizeof(otherSrc));
+    EXPECT_EQ(key, CompilerBuildScheduler::getBuildKey(*pDevice, input));
+
+    preparedSpirV.hash = 0x4321u;
+    EXPECT_NE(key, CompilerBuildScheduler::getBuildKey(*pDevice, input));
+}
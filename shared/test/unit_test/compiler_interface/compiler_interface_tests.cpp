@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/compiler_interface/compiler_build_scheduler.h"
 #include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/compiler_interface.inl"
@@ -156,6 +157,18 @@ TEST_F(CompilerInterfaceTest, WhenCompilingToIsaThenSuccessIsReturned) {
     EXPECT_EQ(TranslationOutput::ErrorCode::success, err);
 }
 
+TEST_F(CompilerInterfaceTest, WhenBuildIsCompletedThenBuildStatisticsAreUpdated) {
+    auto statisticsBefore = pCompilerInterface->getBuildStatistics();
+    TranslationOutput translationOutput;
+    auto err = pCompilerInterface->build(*pDevice, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, err);
+
+    auto statisticsAfter = pCompilerInterface->getBuildStatistics();
+    EXPECT_EQ(statisticsBefore.buildsExecuted + 1, statisticsAfter.buildsExecuted);
+    EXPECT_EQ(0u, statisticsAfter.buildsActive);
+    EXPECT_EQ(0u, statisticsAfter.buildsQueued);
+}
+
 TEST_F(CompilerInterfaceTest, WhenPreferredIntermediateRepresentationSpecifiedThenPreserveIt) {
     CompilerCacheConfig config = {};
     config.enabled = false;
@@ -1243,6 +1256,60 @@ TEST_F(CompilerInterfaceTest, givenCompilerInterfaceWhenGetSpecializationConstan
     EXPECT_EQ(TranslationOutput::ErrorCode::success, err);
 }
 
+TEST_F(CompilerInterfaceTest, givenSameSpirVWhenPreparingSpirVMultipleTimesThenSpecConstantsInfoIsQueriedOnce) {
+    struct CountingCompilerInterface : MockCompilerInterface {
+        TranslationOutput::ErrorCode getSpecConstantsInfo(const NEO::Device &device, ArrayRef<const char> srcSpirV, SpecConstantInfo &output) override {
+            ++getSpecConstantsInfoCalled;
+            return MockCompilerInterface::getSpecConstantsInfo(device, srcSpirV, output);
+        }
+        uint32_t getSpecConstantsInfoCalled = 0u;
+    };
+    auto compilerInterface = std::make_unique<CountingCompilerInterface>();
+    ASSERT_TRUE(compilerInterface->initialize(std::make_unique<CompilerCache>(CompilerCacheConfig{}), true));
+
+    auto preparedSpirV = compilerInterface->prepareSpirV(*pDevice, inputArgs.src);
+    ASSERT_NE(nullptr, preparedSpirV);
+    EXPECT_EQ(inputArgs.src.size(), preparedSpirV->size);
+    EXPECT_EQ(1u, compilerInterface->getSpecConstantsInfoCalled);
+
+    EXPECT_EQ(preparedSpirV, compilerInterface->prepareSpirV(*pDevice, inputArgs.src));
+    EXPECT_EQ(1u, compilerInterface->getSpecConstantsInfoCalled);
+
+    auto otherSpirV = ArrayRef<const char>(inputArgs.src.begin(), inputArgs.src.size() - 1);
+    auto otherPreparedSpirV = compilerInterface->prepareSpirV(*pDevice, otherSpirV);
+    ASSERT_NE(nullptr, otherPreparedSpirV);
+    EXPECT_NE(preparedSpirV, otherPreparedSpirV);
+    EXPECT_EQ(2u, compilerInterface->getSpecConstantsInfoCalled);
+    EXPECT_NE(preparedSpirV->getDigest(), otherPreparedSpirV->getDigest());
+}
+
+TEST_F(CompilerInterfaceTest, givenDeviceDestroyedWhenPreparingSameSpirVForNewDeviceWithSameRootDeviceIndexThenPreparedSpirVIsReused) {
+    struct CountingCompilerInterface : MockCompilerInterface {
+        TranslationOutput::ErrorCode getSpecConstantsInfo(const NEO::Device &device, ArrayRef<const char> srcSpirV, SpecConstantInfo &output) override {
+            ++getSpecConstantsInfoCalled;
+            return MockCompilerInterface::getSpecConstantsInfo(device, srcSpirV, output);
+        }
+        uint32_t getSpecConstantsInfoCalled = 0u;
+    };
+    auto compilerInterface = std::make_unique<CountingCompilerInterface>();
+    ASSERT_TRUE(compilerInterface->initialize(std::make_unique<CompilerCache>(CompilerCacheConfig{}), true));
+
+    std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get(), 0u));
+    auto preparedSpirV = compilerInterface->prepareSpirV(*device, inputArgs.src);
+    ASSERT_NE(nullptr, preparedSpirV);
+    EXPECT_EQ(1u, compilerInterface->getSpecConstantsInfoCalled);
+    device.reset();
+
+    device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get(), 0u));
+    EXPECT_EQ(preparedSpirV, compilerInterface->prepareSpirV(*device, inputArgs.src));
+    EXPECT_EQ(1u, compilerInterface->getSpecConstantsInfoCalled);
+}
+
+TEST_F(CompilerInterfaceTest, givenSpecConstantsInfoNotAvailableWhenPreparingSpirVThenNullptrIsReturned) {
+    pCompilerInterface->igcMain.reset(nullptr);
+    EXPECT_EQ(nullptr, pCompilerInterface->prepareSpirV(*pDevice, inputArgs.src));
+}
+
 struct UnknownInterfaceCIFMain : MockCIFMain {
     CIF::InterfaceId_t FindIncompatibleImpl(CIF::InterfaceId_t entryPointInterface, CIF::CompatibilityDataHandle handle) const override {
         return CIF::UnknownInterface;
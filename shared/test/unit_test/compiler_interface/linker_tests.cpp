@@ -18,6 +18,7 @@
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/default_hw_info.h"
 #include "shared/test/common/helpers/gtest_helpers.h"
+#include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_elf.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
@@ -30,6 +31,8 @@
 
 #include <array>
 #include <string>
+#include <system_error>
+#include <thread>
 
 TEST(SegmentTypeTests, givenSegmentTypeWhenAsStringIsCalledThenProperRepresentationIsReturned) {
     EXPECT_STREQ("UNKNOWN", NEO::asString(NEO::SegmentType::unknown));
@@ -2493,3 +2496,249 @@ TEST_F(LinkerTests, givenPerThreadPayloadOffsetRelocationWhenPatchingInstruction
     uint32_t expectedPatchedValue = kd.kernelAttributes.crossThreadDataSize - kd.kernelAttributes.inlineDataPayloadSize;
     EXPECT_EQ(expectedPatchedValue, static_cast<uint32_t>(*perThreadPayloadOffsetPatchedValue));
 }
+
+TEST(LinkerInputTests, givenRelocationsWhenAddingThemThenSymbolNamesAreInternedToStableIds) {
+    NEO::LinkerInput linkerInput = {};
+    NEO::LinkerInput::RelocationInfo relocInfo;
+    relocInfo.type = NEO::LinkerInput::RelocationInfo::Type::address;
+
+    relocInfo.offset = 0u;
+    relocInfo.symbolName = "A";
+    linkerInput.addElfTextSegmentRelocation(relocInfo, 0);
+    relocInfo.offset = 8u;
+    relocInfo.symbolName = "B";
+    linkerInput.addElfTextSegmentRelocation(relocInfo, 1);
+    relocInfo.offset = 16u;
+    relocInfo.symbolName = "A";
+    linkerInput.addElfTextSegmentRelocation(relocInfo, 1);
+    relocInfo.offset = 24u;
+    relocInfo.symbolName = "";
+    linkerInput.addElfTextSegmentRelocation(relocInfo, 1);
+    relocInfo.offset = 0u;
+    relocInfo.symbolName = "B";
+    relocInfo.relocationSegment = NEO::SegmentType::globalVariables;
+    linkerInput.addDataRelocationInfo(relocInfo);
+
+    EXPECT_EQ(2u, linkerInput.getSymbolIdsCount());
+    auto idA = linkerInput.getSymbolId("A");
+    auto idB = linkerInput.getSymbolId("B");
+    EXPECT_NE(NEO::LinkerInput::invalidSymbolId, idA);
+    EXPECT_NE(NEO::LinkerInput::invalidSymbolId, idB);
+    EXPECT_NE(idA, idB);
+    EXPECT_EQ(NEO::LinkerInput::invalidSymbolId, linkerInput.getSymbolId("C"));
+
+    auto &textRelocs = linkerInput.getRelocationsInInstructionSegments();
+    ASSERT_EQ(2u, textRelocs.size());
+    ASSERT_EQ(1u, textRelocs[0].size());
+    ASSERT_EQ(3u, textRelocs[1].size());
+    EXPECT_EQ(idA, textRelocs[0][0].symbolId);
+    EXPECT_EQ(idB, textRelocs[1][0].symbolId);
+    EXPECT_EQ(idA, textRelocs[1][1].symbolId);
+    EXPECT_EQ(NEO::LinkerInput::invalidSymbolId, textRelocs[1][2].symbolId);
+    ASSERT_EQ(1u, linkerInput.getDataRelocations().size());
+    EXPECT_EQ(idB, linkerInput.getDataRelocations()[0].symbolId);
+}
+
+TEST(LinkerInputTests, givenUnorderedRelocationsWhenDecodingElfThenRelocationsAreSortedByOffsetPerSegment) {
+    NEO::LinkerInput linkerInput = {};
+    MockElf<NEO::Elf::EI_CLASS_64> elf64;
+
+    std::unordered_map<uint32_t, std::string> sectionNames;
+    sectionNames[0] = ".text.abc";
+    sectionNames[1] = ".data.const";
+    sectionNames[2] = ".data.global";
+
+    elf64.setupSecionNames(std::move(sectionNames));
+    elf64.addReloc(64, 0, Zebin::Elf::R_ZE_SYM_ADDR, 0, 0, "0");
+    elf64.addReloc(8, 0, Zebin::Elf::R_ZE_SYM_ADDR, 0, 0, "0");
+    elf64.addReloc(32, 0, Zebin::Elf::R_ZE_SYM_ADDR, 0, 0, "0");
+    elf64.addReloc(16, 0, Zebin::Elf::R_ZE_SYM_ADDR, 2, 0, "0");
+    elf64.addReloc(0, 0, Zebin::Elf::R_ZE_SYM_ADDR, 2, 0, "0");
+
+    elf64.overrideSymbolName = true;
+    elf64.addSymbol(0, 0x0, 8, 1, Elf::STT_OBJECT, Elf::STB_LOCAL);
+
+    NEO::LinkerInput::SectionNameToSegmentIdMap nameToKernelId = {{"abc", 0}};
+    linkerInput.decodeElfSymbolTableAndRelocations(elf64, nameToKernelId);
+    EXPECT_TRUE(linkerInput.isValid());
+
+    auto symbolId = linkerInput.getSymbolId("0");
+    EXPECT_NE(NEO::LinkerInput::invalidSymbolId, symbolId);
+
+    auto &instructionRelocsPerSeg = linkerInput.getRelocationsInInstructionSegments();
+    ASSERT_EQ(1U, instructionRelocsPerSeg.size());
+    auto &relocations = instructionRelocsPerSeg[0];
+    ASSERT_EQ(3U, relocations.size());
+    EXPECT_EQ(8U, relocations[0].offset);
+    EXPECT_EQ(32U, relocations[1].offset);
+    EXPECT_EQ(64U, relocations[2].offset);
+    for (auto &relocation : relocations) {
+        EXPECT_EQ(symbolId, relocation.symbolId);
+    }
+
+    auto &dataRelocations = linkerInput.getDataRelocations();
+    ASSERT_EQ(2U, dataRelocations.size());
+    EXPECT_EQ(0U, dataRelocations[0].offset);
+    EXPECT_EQ(16U, dataRelocations[1].offset);
+}
+
+TEST(LinkerPatchingTests, givenDefaultSettingsWhenGettingPatchingWorkersCountThenParallelPatchingIsUsedOnlyForManySegmentsAndRelocations) {
+    EXPECT_EQ(1u, NEO::getInstructionsSegmentsPatchingWorkersCount(0u, 0u));
+    EXPECT_EQ(1u, NEO::getInstructionsSegmentsPatchingWorkersCount(1u, 1000000u));
+    EXPECT_EQ(1u, NEO::getInstructionsSegmentsPatchingWorkersCount(16u, 100u));
+
+    auto workersCount = NEO::getInstructionsSegmentsPatchingWorkersCount(4u, 1000000u);
+    EXPECT_LE(workersCount, 4u);
+    EXPECT_EQ(std::max(1u, std::min(4u, std::thread::hardware_concurrency())), workersCount);
+}
+
+TEST(LinkerPatchingTests, givenLinkerPatchingWorkerThreadsSetWhenGettingPatchingWorkersCountThenItIsUsedAndLimitedBySegmentsCount) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.LinkerPatchingWorkerThreads.set(0);
+    EXPECT_EQ(1u, NEO::getInstructionsSegmentsPatchingWorkersCount(16u, 1000000u));
+
+    debugManager.flags.LinkerPatchingWorkerThreads.set(4);
+    EXPECT_EQ(4u, NEO::getInstructionsSegmentsPatchingWorkersCount(16u, 1u));
+    EXPECT_EQ(2u, NEO::getInstructionsSegmentsPatchingWorkersCount(2u, 1u));
+}
+
+TEST(LinkerPatchingTests, givenWorkerThreadCreationFailingWhenPatchingInstructionsSegmentsInParallelThenAllSegmentsArePatched) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.LinkerPatchingWorkerThreads.set(4);
+
+    uint32_t createWorkerThreadCalled = 0u;
+    static uint32_t *createWorkerThreadCalledPtr = nullptr;
+    VariableBackup<uint32_t *> calledPtrBackup(&createWorkerThreadCalledPtr, &createWorkerThreadCalled);
+    VariableBackup<decltype(NEO::createInstructionsSegmentsPatchingWorkerThread)> createWorkerThreadBackup(&NEO::createInstructionsSegmentsPatchingWorkerThread, [](std::function<void()> &&work) -> std::thread {
+        if ((*createWorkerThreadCalledPtr)++ > 0u) {
+            throw std::system_error(std::make_error_code(std::errc::resource_unavailable_try_again));
+        }
+        return std::thread(std::move(work));
+    });
+
+    constexpr uint32_t segmentsCount = 8u;
+    constexpr uint32_t relocationsPerSegment = 16u;
+    constexpr uint64_t symbolGpuAddress = 0x1234000000u;
+
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    NEO::SymbolInfo symbolInfo{};
+    symbolInfo.segment = NEO::SegmentType::globalVariables;
+    symbolInfo.offset = 0u;
+    symbolInfo.size = sizeof(uint64_t);
+    symbolInfo.global = true;
+    linkerInput.addSymbol("sym", symbolInfo);
+    for (uint32_t segId = 0u; segId < segmentsCount; segId++) {
+        for (uint32_t relocId = 0u; relocId < relocationsPerSegment; relocId++) {
+            NEO::LinkerInput::RelocationInfo relocInfo;
+            relocInfo.offset = relocId * sizeof(uint64_t);
+            relocInfo.addend = segId;
+            relocInfo.type = NEO::LinkerInput::RelocationInfo::Type::address;
+            relocInfo.symbolName = "sym";
+            linkerInput.addElfTextSegmentRelocation(relocInfo, segId);
+        }
+    }
+
+    NEO::Linker::SegmentInfo globalVariablesSegInfo;
+    globalVariablesSegInfo.gpuAddress = symbolGpuAddress;
+    globalVariablesSegInfo.segmentSize = sizeof(uint64_t);
+
+    std::vector<std::vector<uint64_t>> segmentsData(segmentsCount, std::vector<uint64_t>(relocationsPerSegment, 0u));
+    NEO::Linker::PatchableSegments instructionsSegments(segmentsCount);
+    for (uint32_t segId = 0u; segId < segmentsCount; segId++) {
+        instructionsSegments[segId].hostPointer = segmentsData[segId].data();
+        instructionsSegments[segId].segmentSize = segmentsData[segId].size() * sizeof(uint64_t);
+    }
+
+    WhiteBox<NEO::Linker> linker(linkerInput);
+    EXPECT_TRUE(linker.relocateSymbols(globalVariablesSegInfo, {}, {}, {}, instructionsSegments, 0u, 0u));
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+    NEO::Linker::KernelDescriptorsT kernelDescriptors;
+    linker.patchInstructionsSegments(instructionsSegments, unresolvedExternals, kernelDescriptors);
+
+    EXPECT_EQ(2u, createWorkerThreadCalled);
+    EXPECT_TRUE(unresolvedExternals.empty());
+    for (uint32_t segId = 0u; segId < segmentsCount; segId++) {
+        for (uint32_t relocId = 0u; relocId < relocationsPerSegment; relocId++) {
+            EXPECT_EQ(symbolGpuAddress + segId, segmentsData[segId][relocId]);
+        }
+    }
+}
+
+TEST(LinkerPatchingTests, givenRelocationHeavyInputWhenPatchingInstructionsSegmentsInParallelThenResultsMatchSequentialPatching) {
+    constexpr uint32_t segmentsCount = 8u;
+    constexpr uint32_t relocationsPerSegment = 2048u;
+    constexpr uint32_t symbolsCount = 64u;
+    constexpr uint64_t symbolsGpuBase = 0x1234000000u;
+
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    for (uint32_t symbolId = 0u; symbolId < symbolsCount; symbolId++) {
+        NEO::SymbolInfo symbolInfo{};
+        symbolInfo.segment = NEO::SegmentType::globalVariables;
+        symbolInfo.offset = symbolId * sizeof(uint64_t);
+        symbolInfo.size = sizeof(uint64_t);
+        symbolInfo.global = true;
+        linkerInput.addSymbol("sym" + std::to_string(symbolId), symbolInfo);
+    }
+
+    for (uint32_t segId = 0u; segId < segmentsCount; segId++) {
+        for (uint32_t relocId = 0u; relocId < relocationsPerSegment; relocId++) {
+            NEO::LinkerInput::RelocationInfo relocInfo;
+            relocInfo.offset = (relocationsPerSegment - 1u - relocId) * sizeof(uint64_t);
+            relocInfo.addend = relocId;
+            relocInfo.type = NEO::LinkerInput::RelocationInfo::Type::address;
+            // every 512th relocation targets symbol which is not defined
+            relocInfo.symbolName = (relocId % 512u == 7u) ? "undefined" + std::to_string(segId) : "sym" + std::to_string((relocId * 7u + segId) % symbolsCount);
+            linkerInput.addElfTextSegmentRelocation(relocInfo, segId);
+        }
+    }
+
+    NEO::Linker::SegmentInfo globalVariablesSegInfo;
+    globalVariablesSegInfo.gpuAddress = symbolsGpuBase;
+    globalVariablesSegInfo.segmentSize = symbolsCount * sizeof(uint64_t);
+
+    auto patchSegments = [&](int32_t workersCount, std::vector<std::vector<uint64_t>> &segmentsData, NEO::Linker::UnresolvedExternals &unresolvedExternals) {
+        DebugManagerStateRestore restorer;
+        debugManager.flags.LinkerPatchingWorkerThreads.set(workersCount);
+
+        segmentsData.assign(segmentsCount, std::vector<uint64_t>(relocationsPerSegment, 0u));
+        NEO::Linker::PatchableSegments instructionsSegments(segmentsCount);
+        for (uint32_t segId = 0u; segId < segmentsCount; segId++) {
+            instructionsSegments[segId].hostPointer = segmentsData[segId].data();
+            instructionsSegments[segId].segmentSize = segmentsData[segId].size() * sizeof(uint64_t);
+        }
+
+        WhiteBox<NEO::Linker> linker(linkerInput);
+        EXPECT_TRUE(linker.relocateSymbols(globalVariablesSegInfo, {}, {}, {}, instructionsSegments, 0u, 0u));
+        NEO::Linker::KernelDescriptorsT kernelDescriptors;
+        linker.patchInstructionsSegments(instructionsSegments, unresolvedExternals, kernelDescriptors);
+    };
+
+    std::vector<std::vector<uint64_t>> sequentialData;
+    NEO::Linker::UnresolvedExternals sequentialUnresolvedExternals;
+    patchSegments(1, sequentialData, sequentialUnresolvedExternals);
+
+    std::vector<std::vector<uint64_t>> parallelData;
+    NEO::Linker::UnresolvedExternals parallelUnresolvedExternals;
+    patchSegments(4, parallelData, parallelUnresolvedExternals);
+
+    EXPECT_EQ(sequentialData, parallelData);
+    ASSERT_EQ(segmentsCount * relocationsPerSegment / 512u, sequentialUnresolvedExternals.size());
+    ASSERT_EQ(sequentialUnresolvedExternals.size(), parallelUnresolvedExternals.size());
+    for (size_t i = 0; i < sequentialUnresolvedExternals.size(); i++) {
+        EXPECT_EQ(sequentialUnresolvedExternals[i].instructionsSegmentId, parallelUnresolvedExternals[i].instructionsSegmentId);
+        EXPECT_EQ(sequentialUnresolvedExternals[i].unresolvedRelocation.symbolName, parallelUnresolvedExternals[i].unresolvedRelocation.symbolName);
+        EXPECT_EQ(sequentialUnresolvedExternals[i].unresolvedRelocation.offset, parallelUnresolvedExternals[i].unresolvedRelocation.offset);
+    }
+
+    for (uint32_t segId = 0u; segId < segmentsCount; segId++) {
+        for (uint32_t relocId = 0u; relocId < relocationsPerSegment; relocId++) {
+            auto patchedValue = parallelData[segId][relocationsPerSegment - 1u - relocId];
+            if (relocId % 512u == 7u) {
+                EXPECT_EQ(0u, patchedValue);
+            } else {
+                uint64_t expectedValue = symbolsGpuBase + ((relocId * 7u + segId) % symbolsCount) * sizeof(uint64_t) + relocId;
+                EXPECT_EQ(expectedValue, patchedValue);
+            }
+        }
+    }
+}
@@ -0,0 +1,289 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_interface.h"
+#include "shared/source/compiler_interface/oclc_include_dependencies.h"
+#include "shared/source/helpers/path.h"
+#include "shared/test/common/device_binary_format/patchtokens_tests.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/libult/global_environment.h"
+#include "shared/test/common/mocks/mock_compiler_cache.h"
+#include "shared/test/common/mocks/mock_compiler_interface.h"
+#include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <cstring>
+#include <map>
+
+using namespace NEO;
+
+namespace {
+std::map<std::string, std::string> mockIncludeFiles;
+
+std::unique_ptr<char[]> loadMockIncludeFile(const char *fileName, size_t &fileSize) {
+    auto file = mockIncludeFiles.find(fileName);
+    if (file == mockIncludeFiles.end()) {
+        fileSize = 0u;
+        return nullptr;
+    }
+    fileSize = file->second.size();
+    auto content = std::make_unique<char[]>(fileSize + 1);
+    memcpy(content.get(), file->second.c_str(), fileSize + 1);
+    return content;
+}
+} // namespace
+
+class OclcIncludeDependenciesTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        mockIncludeFiles.clear();
+    }
+
+    void TearDown() override {
+        mockIncludeFiles.clear();
+    }
+
+    bool collect(const char *src, const char *options = "") {
+        return dependencies.collect(ArrayRef<const char>(src, strlen(src)), ArrayRef<const char>(options, strlen(options)), ArrayRef<const char>());
+    }
+
+    VariableBackup<decltype(OclcIncludeDependencies::loadFile)> loadFileBackup{&OclcIncludeDependencies::loadFile, loadMockIncludeFile};
+    OclcIncludeDependencies dependencies;
+};
+
+TEST_F(OclcIncludeDependenciesTest, givenNestedIncludesWhenCollectingThenAllProbedCandidatesAreRecordedInSearchOrder) {
+    const auto headerB = joinPath("inc2", "b.h");
+    const auto headerC = joinPath("inc2", "c.h");
+    mockIncludeFiles["a.h"] = "#define A 1\n";
+    mockIncludeFiles[headerB] = "  #  include \"c.h\"\n";
+    mockIncludeFiles[headerC] = "";
+
+    EXPECT_TRUE(collect("#include \"a.h\"\n#include <b.h>\n__kernel void k() {}", "-cl-std=CL2.0 -I inc1 -Iinc2"));
+
+    auto &recorded = dependencies.getDependencies();
+    ASSERT_EQ(4u, recorded.size());
+    EXPECT_EQ("a.h", recorded[0].path);
+    EXPECT_TRUE(recorded[0].exists);
+    EXPECT_EQ(Hash::hash(mockIncludeFiles["a.h"].c_str(), mockIncludeFiles["a.h"].size()), recorded[0].contentHash);
+    EXPECT_EQ(joinPath("inc1", "b.h"), recorded[1].path);
+    EXPECT_FALSE(recorded[1].exists);
+    EXPECT_EQ(headerB, recorded[2].path);
+    EXPECT_TRUE(recorded[2].exists);
+    EXPECT_EQ(headerC, recorded[3].path);
+    EXPECT_TRUE(recorded[3].exists);
+}
+
+TEST_F(OclcIncludeDependenciesTest, givenFileIncludedMultipleTimesWhenCollectingThenItIsRecordedOnce) {
+    mockIncludeFiles["a.h"] = "#ifndef A_H\n#define A_H\n#include \"a.h\"\n#endif\n";
+
+    EXPECT_TRUE(collect("#include \"a.h\"\n#include \"a.h\"\n"));
+    EXPECT_EQ(1u, dependencies.getDependencies().size());
+
+    EXPECT_TRUE(collect("__kernel void k() {} // #include \"a.h\"\n"));
+    EXPECT_EQ(0u, dependencies.getDependencies().size());
+}
+
+TEST_F(OclcIncludeDependenciesTest, givenIncludeWhichCantBeResolvedByScanningWhenCollectingThenFalseIsReturned) {
+    mockIncludeFiles["a.h"] = "";
+
+    EXPECT_FALSE(collect("#include \"missing.h\"\n"));
+    EXPECT_FALSE(collect("#include HEADER_NAME\n"));
+    EXPECT_FALSE(collect("#include_next <a.h>\n"));
+    EXPECT_FALSE(collect("#include \"a.h\n"));
+    EXPECT_FALSE(collect("#include \"\"\n"));
+    EXPECT_FALSE(collect("#include <a.h>\n"));
+    EXPECT_FALSE(collect("#include \"a.h\"\n", "-include a.h"));
+    EXPECT_FALSE(collect("#include \"a.h\"\n", "-I"));
+
+    EXPECT_TRUE(collect("#include \"a.h\"\n"));
+
+    for (uint32_t i = 0; i <= OclcIncludeDependencies::maxIncludeDepth; i++) {
+        mockIncludeFiles[std::to_string(i) + ".h"] = "#include \"" + std::to_string(i + 1) + ".h\"\n";
+    }
+    mockIncludeFiles[std::to_string(OclcIncludeDependencies::maxIncludeDepth + 1) + ".h"] = "";
+    EXPECT_FALSE(collect("#include \"0.h\"\n"));
+    EXPECT_TRUE(collect("#include \"2.h\"\n"));
+}
+
+TEST_F(OclcIncludeDependenciesTest, givenHasIncludeProbeWhenCollectingThenFalseIsReturned) {
+    mockIncludeFiles["a.h"] = "";
+    mockIncludeFiles["b.h"] = "#if __has_include_next(<a.h>)\n#endif\n";
+
+    EXPECT_FALSE(collect("#if __has_include(\"a.h\")\n#include \"a.h\"\n#endif\n"));
+    EXPECT_FALSE(collect("#if defined(__has_include)\n#elif __has_include(<missing.h>)\n#endif\n"));
+    EXPECT_FALSE(collect("#include \"b.h\"\n"));
+
+    EXPECT_TRUE(collect("#include \"a.h\"\n"));
+}
+
+TEST_F(OclcIncludeDependenciesTest, givenCollectedDependenciesWhenIncludedFileChangesOrShadowingFileIsCreatedThenDependenciesAreNotUpToDate) {
+    const auto header = joinPath("inc", "a.h");
+    mockIncludeFiles[header] = "#define A 1\n";
+
+    EXPECT_TRUE(collect("#include \"a.h\"\n", "-I \"inc\""));
+    EXPECT_TRUE(dependencies.isUpToDate());
+
+    mockIncludeFiles[header] = "#define A 2\n";
+    EXPECT_FALSE(dependencies.isUpToDate());
+    mockIncludeFiles[header] = "#define A 1\n";
+    EXPECT_TRUE(dependencies.isUpToDate());
+
+    mockIncludeFiles["a.h"] = "#define A 3\n";
+    EXPECT_FALSE(dependencies.isUpToDate());
+    mockIncludeFiles.erase("a.h");
+
+    mockIncludeFiles.erase(header);
+    EXPECT_FALSE(dependencies.isUpToDate());
+}
+
+TEST_F(OclcIncludeDependenciesTest, givenSerializedDependenciesWhenDeserializingThenSameDependenciesAndDigestAreRestored) {
+    mockIncludeFiles["dir with spaces/a.h"] = "#include <b.h>\n";
+    mockIncludeFiles[joinPath("inc", "b.h")] = "#define B 1\n";
+
+    EXPECT_TRUE(collect("#include \"dir with spaces/a.h\"\n", "-Iinc"));
+    auto manifest = dependencies.serialize();
+
+    OclcIncludeDependencies restored;
+    EXPECT_TRUE(restored.deserialize(ArrayRef<const char>(manifest.c_str(), manifest.size())));
+    ASSERT_EQ(dependencies.getDependencies().size(), restored.getDependencies().size());
+    for (size_t i = 0; i < restored.getDependencies().size(); i++) {
+        EXPECT_EQ(dependencies.getDependencies()[i].path, restored.getDependencies()[i].path);
+        EXPECT_EQ(dependencies.getDependencies()[i].exists, restored.getDependencies()[i].exists);
+        EXPECT_EQ(dependencies.getDependencies()[i].contentHash, restored.getDependencies()[i].contentHash);
+    }
+    EXPECT_EQ(dependencies.getDigest(), restored.getDigest());
+    EXPECT_TRUE(restored.isUpToDate());
+
+    mockIncludeFiles[joinPath("inc", "b.h")] = "#define B 2\n";
+    EXPECT_TRUE(collect("#include \"dir with spaces/a.h\"\n", "-Iinc"));
+    EXPECT_NE(dependencies.getDigest(), restored.getDigest());
+}
+
+TEST_F(OclcIncludeDependenciesTest, givenInvalidManifestWhenDeserializingThenFalseIsReturnedAndDependenciesAreNotModified) {
+    mockIncludeFiles["a.h"] = "";
+    EXPECT_TRUE(collect("#include \"a.h\"\n"));
+
+    const std::string header = std::string(OclcIncludeDependencies::manifestHeader) + "\n";
+    const std::string invalidManifests[] = {
+        "",
+        "oclc_include_dependencies 0\n",
+        header + "2 0000000000000000 a.h\n",
+        header + "1 00000000000000 a.h\n",
+        header + "1 000000000000000g a.h\n",
+        header + "1 0000000000000000 \n",
+        header + "1_0000000000000000 a.h\n"};
+    for (const auto &manifest : invalidManifests) {
+        EXPECT_FALSE(dependencies.deserialize(ArrayRef<const char>(manifest.c_str(), manifest.size())));
+        EXPECT_EQ(1u, dependencies.getDependencies().size());
+    }
+
+    EXPECT_TRUE(dependencies.deserialize(ArrayRef<const char>(header.c_str(), header.size())));
+    EXPECT_EQ(0u, dependencies.getDependencies().size());
+}
+
+class CompilerInterfaceIncludeAwareCacheTest : public OclcIncludeDependenciesTest {
+  public:
+    void SetUp() override {
+        OclcIncludeDependenciesTest::SetUp();
+
+        auto cache = std::make_unique<CompilerCacheMock>();
+        cache->config.enabled = true;
+        compilerInterface = std::make_unique<MockCompilerInterface>();
+        ASSERT_TRUE(compilerInterface->initialize(std::move(cache), true));
+        mockCompilerCache = static_cast<CompilerCacheMock *>(compilerInterface->cache.get());
+
+        fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+        fclDebugVarsForceBuildFailure.fileName = gEnvironment->fclGetMockFile();
+        fclDebugVarsForceBuildFailure.forceBuildFailure = true;
+
+        igcDebugVarsDeviceBinary.fileName = gEnvironment->igcGetMockFile();
+        igcDebugVarsDeviceBinary.binaryToReturn = patchtokensProgram.storage.data();
+        igcDebugVarsDeviceBinary.binaryToReturnSize = patchtokensProgram.storage.size();
+        igcDebugVarsForceBuildFailure.fileName = gEnvironment->igcGetMockFile();
+        igcDebugVarsForceBuildFailure.forceBuildFailure = true;
+
+        inputArgs.src = ArrayRef<const char>(src, strlen(src));
+        mockIncludeFiles["header.h"] = "#define VALUE 1\n";
+    }
+
+    TranslationOutput::ErrorCode buildWithFailingCompilers() {
+        gEnvironment->fclPushDebugVars(fclDebugVarsForceBuildFailure);
+        gEnvironment->igcPushDebugVars(igcDebugVarsForceBuildFailure);
+        TranslationOutput output;
+        auto err = compilerInterface->build(device, inputArgs, output);
+        gEnvironment->igcPopDebugVars();
+        gEnvironment->fclPopDebugVars();
+        return err;
+    }
+
+    TranslationOutput::ErrorCode buildWithWorkingCompilers() {
+        gEnvironment->fclPushDebugVars(fclDebugVars);
+        gEnvironment->igcPushDebugVars(igcDebugVarsDeviceBinary);
+        TranslationOutput output;
+        auto err = compilerInterface->build(device, inputArgs, output);
+        gEnvironment->igcPopDebugVars();
+        gEnvironment->fclPopDebugVars();
+        return err;
+    }
+
+    const char *src = "#include \"header.h\"\n__kernel void k() {}";
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+    MockCompilerDebugVars fclDebugVars;
+    MockCompilerDebugVars fclDebugVarsForceBuildFailure;
+    MockCompilerDebugVars igcDebugVarsDeviceBinary;
+    MockCompilerDebugVars igcDebugVarsForceBuildFailure;
+    PatchTokensTestData::ValidEmptyProgram patchtokensProgram;
+    MockDevice device;
+    std::unique_ptr<MockCompilerInterface> compilerInterface;
+    CompilerCacheMock *mockCompilerCache = nullptr;
+};
+
+TEST_F(CompilerInterfaceIncludeAwareCacheTest, givenKernelWithResolvableIncludesAndBinaryInCacheWhenBuildingThenFclIsNotCalled) {
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, buildWithWorkingCompilers());
+    EXPECT_EQ(2u, mockCompilerCache->hashToBinaryMap.size());
+    ASSERT_EQ(2u, mockCompilerCache->cacheBinaryKernelFileHashes.size());
+    EXPECT_EQ(OclcIncludeDependencies::getManifestCacheKey(""), mockCompilerCache->cacheBinaryKernelFileHashes[1].substr(mockCompilerCache->cacheBinaryKernelFileHashes[0].size()));
+
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, buildWithFailingCompilers());
+}
+
+TEST_F(CompilerInterfaceIncludeAwareCacheTest, givenIncludedFileChangedAfterCachingWhenBuildingThenCachedBinaryIsNotUsed) {
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, buildWithWorkingCompilers());
+
+    mockIncludeFiles["header.h"] = "#define VALUE 2\n";
+    EXPECT_EQ(TranslationOutput::ErrorCode::buildFailure, buildWithFailingCompilers());
+
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, buildWithWorkingCompilers());
+    EXPECT_EQ(3u, mockCompilerCache->hashToBinaryMap.size());
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, buildWithFailingCompilers());
+
+    mockIncludeFiles["header.h"] = "#define VALUE 1\n";
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, buildWithFailingCompilers());
+}
+
+TEST_F(CompilerInterfaceIncludeAwareCacheTest, givenManifestLostWhenBuildingThenIncludesAreCollectedAgainAndCachedBinaryIsUsed) {
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, buildWithWorkingCompilers());
+    ASSERT_EQ(2u, mockCompilerCache->cacheBinaryKernelFileHashes.size());
+    mockCompilerCache->hashToBinaryMap.erase(mockCompilerCache->cacheBinaryKernelFileHashes[1]);
+
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, buildWithFailingCompilers());
+}
+
+TEST_F(CompilerInterfaceIncludeAwareCacheTest, givenIncludeAwareDirectCachingDisabledOrUnresolvableIncludeWhenBuildingThenSourceIsPreprocessedBeforeCacheLookup) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableIncludeAwareDirectCaching.set(0);
+
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, buildWithWorkingCompilers());
+    EXPECT_EQ(1u, mockCompilerCache->hashToBinaryMap.size());
+    EXPECT_EQ(TranslationOutput::ErrorCode::buildFailure, buildWithFailingCompilers());
+
+    debugManager.flags.EnableIncludeAwareDirectCaching.set(-1);
+    mockIncludeFiles.clear();
+    EXPECT_EQ(TranslationOutput::ErrorCode::buildFailure, buildWithFailingCompilers());
+    EXPECT_EQ(1u, mockCompilerCache->hashToBinaryMap.size());
+}
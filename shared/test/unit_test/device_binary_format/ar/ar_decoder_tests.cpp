@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/device_binary_format/ar/ar_decoder.h"
+#include "shared/source/device_binary_format/ar/ar_encoder.h"
 #include "shared/test/common/test_macros/test.h"
 
 using namespace NEO::Ar;
@@ -424,3 +425,87 @@ TEST(ArDecoderDecodeAr, GivenFilesWithLongFilenamesWhenLongNameIsOutOfBoundsThen
     EXPECT_FALSE(decodeErrors.empty());
     EXPECT_STREQ("Corrupt AR archive - long file name entry has broken identifier : '/100            '", decodeErrors.c_str());
 }
+
+TEST(ArDecoderDecodeAr, GivenArWithTargetIndexThenIndexIsNotReportedAsRegularFile) {
+    const uint8_t data0[8] = "1234567";
+    ArEncoder encoder(false, true);
+    encoder.appendFileEntry("a", data0);
+    auto arData = encoder.encode();
+
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto ar = decodeAr(arData, decodeErrors, decodeWarnings);
+    EXPECT_TRUE(decodeErrors.empty()) << decodeErrors;
+    EXPECT_TRUE(decodeWarnings.empty()) << decodeWarnings;
+    ASSERT_EQ(1U, ar.files.size());
+    EXPECT_EQ("a", ar.files[0].fileName);
+    EXPECT_EQ(NEO::Ar::SpecialFileNames::targetIndexFile, ar.targetIndexEntry.fileName);
+    EXPECT_NE(nullptr, ar.targetIndexEntry.fullHeader);
+}
+
+TEST(ArDecoderDecodeArTargetIndex, GivenArWithTargetIndexThenEntriesPointToFileHeaders) {
+    const uint8_t data0[8] = "1234567";
+    const uint8_t data1[4] = "abc";
+    ArEncoder encoder(false, true);
+    encoder.appendFileEntry("a", data0);
+    encoder.appendFileEntry("bc", data1);
+    auto arData = encoder.encode();
+
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto ar = decodeAr(arData, decodeErrors, decodeWarnings);
+    ASSERT_EQ(2U, ar.files.size());
+
+    auto index = decodeArTargetIndex(arData);
+    ASSERT_EQ(2U, index.size());
+    for (size_t i = 0; i < index.size(); i++) {
+        EXPECT_EQ(ar.files[i].fileName, index[i].fileName);
+        EXPECT_EQ(reinterpret_cast<const uint8_t *>(ar.files[i].fullHeader), arData.data() + index[i].headerOffset);
+
+        ArFileEntryHeaderAndData fileEntry = {};
+        EXPECT_TRUE(decodeArFileEntry(arData, index[i].headerOffset, fileEntry));
+        EXPECT_EQ(ar.files[i].fileName, fileEntry.fileName);
+        EXPECT_EQ(ar.files[i].fileData.begin(), fileEntry.fileData.begin());
+        EXPECT_EQ(ar.files[i].fileData.size(), fileEntry.fileData.size());
+    }
+}
+
+TEST(ArDecoderDecodeArTargetIndex, GivenArWithoutTargetIndexThenIndexIsEmpty) {
+    const uint8_t data0[8] = "1234567";
+    ArEncoder encoder;
+    encoder.appendFileEntry("a", data0);
+    auto arData = encoder.encode();
+    EXPECT_TRUE(decodeArTargetIndex(arData).empty());
+
+    const uint8_t notAr[] = "aaaaa";
+    EXPECT_TRUE(decodeArTargetIndex(notAr).empty());
+}
+
+TEST(ArDecoderDecodeArTargetIndex, GivenMalformedIndexLineThenIndexIsEmpty) {
+    const uint8_t malformedIndex[] = "a/123\n";
+    ArEncoder encoder;
+    encoder.appendFileEntry("target_index", ArrayRef<const uint8_t>(malformedIndex, sizeof(malformedIndex) - 1));
+    auto arData = encoder.encode();
+    EXPECT_TRUE(decodeArTargetIndex(arData).empty());
+}
+
+TEST(ArDecoderDecodeArFileEntry, GivenInvalidOffsetOrHeaderThenDecodingFails) {
+    const uint8_t data0[8] = "1234567";
+    ArEncoder encoder;
+    encoder.appendFileEntry("a", data0);
+    auto arData = encoder.encode();
+
+    ArFileEntryHeaderAndData fileEntry = {};
+    EXPECT_TRUE(decodeArFileEntry(arData, arMagic.size(), fileEntry));
+    EXPECT_FALSE(decodeArFileEntry(arData, 0U, fileEntry));
+    EXPECT_FALSE(decodeArFileEntry(arData, arMagic.size() + 1, fileEntry));
+    EXPECT_FALSE(decodeArFileEntry(arData, arData.size(), fileEntry));
+
+    auto header = reinterpret_cast<ArFileEntryHeader *>(arData.data() + arMagic.size());
+    header->fileSizeInBytes[0] = '9';
+    EXPECT_FALSE(decodeArFileEntry(arData, arMagic.size(), fileEntry));
+    header->fileSizeInBytes[0] = '8';
+    header->identifier[0] = '/';
+    header->identifier[1] = '0';
+    EXPECT_FALSE(decodeArFileEntry(arData, arMagic.size(), fileEntry));
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -147,3 +147,55 @@ TEST(ArEncoder, GivenValidTwoFileEntriesWhen8BytePaddingIsRequestedThenPaddingFi
     EXPECT_EQ(0, memcmp(file1Data, data1, sizeof(data1)));
     EXPECT_EQ(0, memcmp(file2Data, data2, sizeof(data2)));
 }
+
+TEST(ArEncoder, GivenTargetIndexEnabledThenIndexIsEmittedAsFirstFileEntryWithHeaderOffsetsOfAllFiles) {
+    const uint8_t data0[7] = "123456";
+    const uint8_t data1[3] = "ab";
+    ArEncoder encoder(false, true);
+    ASSERT_NE(nullptr, encoder.appendFileEntry("64.12.60.7", data0));
+    ASSERT_NE(nullptr, encoder.appendFileEntry("generic_ir", data1));
+    auto arData = encoder.encode();
+
+    ArEncoder encoderWithoutIndex;
+    encoderWithoutIndex.appendFileEntry("64.12.60.7", data0);
+    encoderWithoutIndex.appendFileEntry("generic_ir", data1);
+    auto arDataWithoutIndex = encoderWithoutIndex.encode();
+    ASSERT_GT(arData.size(), arDataWithoutIndex.size());
+    const size_t indexEntrySize = arData.size() - arDataWithoutIndex.size();
+    EXPECT_EQ(0U, indexEntrySize % 2);
+    EXPECT_EQ(0, memcmp(arData.data() + arMagic.size() + indexEntrySize, arDataWithoutIndex.data() + arMagic.size(), arDataWithoutIndex.size() - arMagic.size()));
+
+    auto indexHeader = reinterpret_cast<const ArFileEntryHeader *>(arData.data() + arMagic.size());
+    EXPECT_EQ(ConstStringRef("target_index/   ", 16), ConstStringRef::fromArray(indexHeader->identifier));
+    auto indexData = ConstStringRef(reinterpret_cast<const char *>(indexHeader + 1), indexEntrySize - sizeof(ArFileEntryHeader));
+    const size_t offset0 = arMagic.size() + indexEntrySize;
+    const size_t offset1 = offset0 + sizeof(ArFileEntryHeader) + sizeof(data0) + 1;
+    std::string expectedIndex = "64.12.60.7/" + std::string(20 - std::to_string(offset0).size(), '0') + std::to_string(offset0) + "\n" +
+                                "generic_ir/" + std::string(20 - std::to_string(offset1).size(), '0') + std::to_string(offset1) + "\n";
+    EXPECT_TRUE(indexData.startsWith(expectedIndex.c_str()));
+    EXPECT_EQ(std::string(indexData.size() - expectedIndex.size(), '\n'), std::string(indexData.begin() + expectedIndex.size(), indexData.end()));
+}
+
+TEST(ArEncoder, GivenTargetIndexAndPaddingTo8BytesEnabledThenFileEntriesDataRemainsAligned) {
+    const uint8_t data0[7] = "123456";
+    const uint8_t data1[3] = "ab";
+    ArEncoder encoder(true, true);
+    auto header0 = encoder.appendFileEntry("a", data0);
+    ASSERT_NE(nullptr, header0);
+    auto header1 = encoder.appendFileEntry("bcd", data1);
+    ASSERT_NE(nullptr, header1);
+    auto arData = encoder.encode();
+
+    ArEncoder encoderWithoutIndex(true);
+    encoderWithoutIndex.appendFileEntry("a", data0);
+    encoderWithoutIndex.appendFileEntry("bcd", data1);
+    auto arDataWithoutIndex = encoderWithoutIndex.encode();
+    const size_t indexEntrySize = arData.size() - arDataWithoutIndex.size();
+    EXPECT_EQ(0U, indexEntrySize % 8);
+}
+
+TEST(ArEncoder, GivenTargetIndexEnabledAndNoFilesThenIndexIsNotEmitted) {
+    ArEncoder encoder(true, true);
+    auto arData = encoder.encode();
+    EXPECT_EQ(arMagic.size(), arData.size());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -613,3 +613,95 @@ TEST(UnpackSingleDeviceBinaryAr, WhenCouldNotFindBinaryWithRightPointerSizeThenU
     EXPECT_TRUE(unpackWarnings.empty()) << unpackWarnings;
     EXPECT_STREQ("Couldn't find matching binary in AR archive", unpackErrors.c_str());
 }
+
+TEST(UnpackSingleDeviceBinaryAr, GivenArWithTargetIndexWhenUnpackingThenSameBestMatchIsChosenAsWithoutIndex) {
+    PatchTokensTestData::ValidEmptyProgram programTokens;
+    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+    const auto &compilerProductHelper = mockExecutionEnvironment.rootDeviceEnvironments[0]->getHelper<NEO::CompilerProductHelper>();
+    NEO::HardwareInfo hwInfo = *NEO::defaultHwInfo;
+    NEO::HardwareIpVersion aotConfig = {0};
+    aotConfig.value = compilerProductHelper.getHwIpVersion(hwInfo);
+
+    std::string requiredProduct = NEO::hardwarePrefix[productFamily];
+    std::string requiredStepping = std::to_string(programTokens.header->SteppingId);
+    std::string requiredPointerSize = (programTokens.header->GPUPointerSizeInBytes == 4) ? "32" : "64";
+    std::string requiredProductConfig = ProductConfigHelper::parseMajorMinorRevisionValue(aotConfig);
+
+    NEO::Ar::ArEncoder encoderWithIndex(true, true);
+    NEO::Ar::ArEncoder encoderWithoutIndex(true);
+    for (auto encoder : {&encoderWithIndex, &encoderWithoutIndex}) {
+        for (uint32_t i = 0; i < 64; ++i) {
+            ASSERT_TRUE(encoder->appendFileEntry(requiredPointerSize + "unk" + std::to_string(i), programTokens.storage));
+        }
+        ASSERT_TRUE(encoder->appendFileEntry(requiredPointerSize + "." + requiredProduct, programTokens.storage));
+        ASSERT_TRUE(encoder->appendFileEntry(requiredPointerSize + "." + requiredProductConfig, programTokens.storage));
+    }
+
+    NEO::TargetDevice target;
+    target.coreFamily = static_cast<GFXCORE_FAMILY>(programTokens.header->Device);
+    target.aotConfig = aotConfig;
+    target.stepping = programTokens.header->SteppingId;
+    target.maxPointerSizeInBytes = programTokens.header->GPUPointerSizeInBytes;
+
+    auto arDataWithIndex = encoderWithIndex.encode();
+    auto arDataWithoutIndex = encoderWithoutIndex.encode();
+    ASSERT_FALSE(NEO::Ar::decodeArTargetIndex(arDataWithIndex).empty());
+
+    std::string unpackErrors;
+    std::string unpackWarnings;
+    auto unpackedWithIndex = NEO::unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::archive>(arDataWithIndex, requiredProduct, target, unpackErrors, unpackWarnings);
+    EXPECT_TRUE(unpackErrors.empty()) << unpackErrors;
+    EXPECT_TRUE(unpackWarnings.empty()) << unpackWarnings;
+    auto unpackedWithoutIndex = NEO::unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::archive>(arDataWithoutIndex, requiredProduct, target, unpackErrors, unpackWarnings);
+    EXPECT_TRUE(unpackErrors.empty()) << unpackErrors;
+    EXPECT_TRUE(unpackWarnings.empty()) << unpackWarnings;
+
+    EXPECT_EQ(NEO::DeviceBinaryFormat::patchtokens, unpackedWithIndex.format);
+    ASSERT_EQ(unpackedWithoutIndex.packedTargetDeviceBinary.size(), unpackedWithIndex.packedTargetDeviceBinary.size());
+    EXPECT_EQ(unpackedWithoutIndex.packedTargetDeviceBinary.begin() - arDataWithoutIndex.data(),
+              unpackedWithIndex.packedTargetDeviceBinary.begin() - arDataWithIndex.data() - static_cast<ptrdiff_t>(arDataWithIndex.size() - arDataWithoutIndex.size()));
+}
+
+TEST(UnpackSingleDeviceBinaryAr, GivenArWithStaleTargetIndexWhenUnpackingThenFallbackToDecodingWholeArchive) {
+    PatchTokensTestData::ValidEmptyProgram programTokens;
+    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+    const auto &compilerProductHelper = mockExecutionEnvironment.rootDeviceEnvironments[0]->getHelper<NEO::CompilerProductHelper>();
+    NEO::HardwareInfo hwInfo = *NEO::defaultHwInfo;
+    NEO::HardwareIpVersion aotConfig = {0};
+    aotConfig.value = compilerProductHelper.getHwIpVersion(hwInfo);
+
+    std::string requiredProduct = NEO::hardwarePrefix[productFamily];
+    std::string requiredPointerSize = (programTokens.header->GPUPointerSizeInBytes == 4) ? "32" : "64";
+    std::string requiredProductConfig = ProductConfigHelper::parseMajorMinorRevisionValue(aotConfig);
+
+    NEO::Ar::ArEncoder encoder(true, true);
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize + "." + requiredProduct, programTokens.storage));
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize + "." + requiredProductConfig, programTokens.storage));
+    auto arData = encoder.encode();
+
+    auto targetIndex = NEO::Ar::decodeArTargetIndex(arData);
+    ASSERT_EQ(2U, targetIndex.size());
+    auto fileEntryHeader = reinterpret_cast<NEO::Ar::ArFileEntryHeader *>(arData.data() + targetIndex[1].headerOffset);
+    fileEntryHeader->identifier[0] = 'x';
+
+    NEO::TargetDevice target;
+    target.coreFamily = static_cast<GFXCORE_FAMILY>(programTokens.header->Device);
+    target.aotConfig = aotConfig;
+    target.stepping = programTokens.header->SteppingId;
+    target.maxPointerSizeInBytes = programTokens.header->GPUPointerSizeInBytes;
+
+    std::string unpackErrors;
+    std::string unpackWarnings;
+    auto unpacked = NEO::unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::archive>(arData, requiredProduct, target, unpackErrors, unpackWarnings);
+    EXPECT_TRUE(unpackErrors.empty()) << unpackErrors;
+    EXPECT_FALSE(unpackWarnings.empty());
+
+    unpackErrors.clear();
+    unpackWarnings.clear();
+    auto decodedAr = NEO::Ar::decodeAr(arData, unpackErrors, unpackWarnings);
+    std::string productFamilyFileName = requiredPointerSize + "." + requiredProduct;
+    auto productFamilyFile = std::find_if(decodedAr.files.begin(), decodedAr.files.end(), [&](const auto &file) { return file.fileName == productFamilyFileName.c_str(); });
+    ASSERT_NE(decodedAr.files.end(), productFamilyFile);
+    EXPECT_EQ(unpacked.packedTargetDeviceBinary.begin(), productFamilyFile->fileData.begin());
+    EXPECT_EQ(NEO::DeviceBinaryFormat::patchtokens, unpacked.format);
+}
@@ -8,6 +8,7 @@
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
 #include "shared/test/common/test_macros/test.h"
 
+#include <algorithm>
 #include <limits>
 #include <stdexcept>
 #include <type_traits>
@@ -3159,3 +3160,82 @@ TEST(ReserveBasedOnEstimates, WhenContainerFullThenGrowBasedOnPos) {
     EXPECT_TRUE(reservedAdditionalMem);
     EXPECT_EQ(280U, container.capacity());
 }
+
+namespace {
+void expectSameTokenizationAsScalar(ConstStringRef text) {
+    LinesCache lines, scalarLines;
+    TokensCache tokens, scalarTokens;
+    std::string errors, warnings, scalarErrors, scalarWarnings;
+
+    bool success = NEO::Yaml::tokenize(text, lines, tokens, errors, warnings);
+    bool scalarSuccess = NEO::Yaml::tokenizeScalar(text, scalarLines, scalarTokens, scalarErrors, scalarWarnings);
+
+    EXPECT_EQ(scalarSuccess, success);
+    EXPECT_EQ(scalarErrors, errors);
+    EXPECT_EQ(scalarWarnings, warnings);
+
+    ASSERT_EQ(scalarTokens.size(), tokens.size());
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        EXPECT_EQ(scalarTokens[i].pos, tokens[i].pos) << i;
+        EXPECT_EQ(scalarTokens[i].len, tokens[i].len) << i;
+        EXPECT_EQ(scalarTokens[i].traits.type, tokens[i].traits.type) << i;
+        EXPECT_EQ(scalarTokens[i].traits.character0, tokens[i].traits.character0) << i;
+    }
+
+    ASSERT_EQ(scalarLines.size(), lines.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        EXPECT_EQ(scalarLines[i].first, lines[i].first) << i;
+        EXPECT_EQ(scalarLines[i].last, lines[i].last) << i;
+        EXPECT_EQ(scalarLines[i].indent, lines[i].indent) << i;
+        EXPECT_EQ(scalarLines[i].lineType, lines[i].lineType) << i;
+        EXPECT_EQ(scalarLines[i].traits.packed, lines[i].traits.packed) << i;
+    }
+}
+} // namespace
+
+TEST(YamlTokenize, GivenLongIdentifiersIndentsAndCommentsThenTokenizationMatchesScalarTokenizer) {
+    ConstStringRef texts[] = {
+        "a\n",
+        "short: value\n",
+        "kernels:\n"
+        "                                  - name:            very_long_kernel_name_with.dots-and-dashes_0123456789\n"
+        "                                    execution_env:   # comment which is longer than single block of characters\n"
+        "                                      simd_size:     32\n"
+        "                                      grf_count:     [ 128, 256 ]\n"
+        "#######################################################################\n"
+        "identifier with several separated words and tab\tinside: 'quoted string value with spaces'\n"
+        "Identifier_With_Upper_Case_Letters_Only_ABCDEFGHIJKLMNOPQRSTUVWXYZ: -0x12345678\n",
+        "identifier_without_newline_at_the_end_which_spans_blocks",
+        "                                        ",
+        "# comment without newline at the end which spans multiple blocks",
+        "identifier_followed_by_invalid_character_after_first_block@: 1\n",
+        "identifier_with_non_ascii_character_\xc3\xa9_in_the_middle_of_block: 1\n",
+        "      {inline: dictionary}\n",
+    };
+    for (auto text : texts) {
+        expectSameTokenizationAsScalar(text);
+    }
+}
+
+TEST(YamlTokenize, GivenLargeZeInfoThenTokenizationMatchesScalarTokenizerAndStorageIsReservedUpfront) {
+    std::string zeInfo = "version: '1.40'\nkernels:\n";
+    for (uint32_t kernelId = 0u; kernelId < 2000u; ++kernelId) {
+        zeInfo += "  - name: kernel_with_a_reasonably_long_name_" + std::to_string(kernelId) + "\n";
+        zeInfo += "    execution_env:\n";
+        zeInfo += "      grf_count: 128\n";
+        zeInfo += "      simd_size: 16\n";
+        zeInfo += "    payload_arguments:\n";
+        zeInfo += "      - arg_type: global_id_offset\n";
+        zeInfo += "        offset: 0\n";
+        zeInfo += "        size: 12\n";
+    }
+    expectSameTokenizationAsScalar(zeInfo);
+
+    LinesCache lines;
+    TokensCache tokens;
+    std::string errors, warnings;
+    ASSERT_TRUE(NEO::Yaml::tokenize(zeInfo, lines, tokens, errors, warnings));
+    EXPECT_EQ(static_cast<size_t>(std::count(zeInfo.begin(), zeInfo.end(), '\n')), lines.size());
+    EXPECT_GE(lines.capacity(), lines.size());
+    EXPECT_LE(tokens.size(), (lines.size() + 1) * NEO::Yaml::estimatedTokensPerLine);
+}
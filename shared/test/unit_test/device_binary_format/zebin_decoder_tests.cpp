@@ -11,6 +11,7 @@
 #include "shared/source/device_binary_format/zebin/zebin_decoder.h"
 #include "shared/source/device_binary_format/zebin/zebin_elf.h"
 #include "shared/source/device_binary_format/zebin/zeinfo_enum_lookup.h"
+#include "shared/source/device_binary_format/zebin/zeinfo_serialization.h"
 #include "shared/source/helpers/compiler_product_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/ptr_math.h"
@@ -19,6 +20,8 @@
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_info.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/mocks/mock_compiler_cache.h"
 #include "shared/test/common/mocks/mock_elf.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/mocks/mock_modules_zebin.h"
@@ -27,6 +30,7 @@
 #include "platforms.h"
 
 #include <numeric>
+#include <system_error>
 #include <vector>
 
 extern PRODUCT_FAMILY productFamily;
@@ -7049,3 +7053,267 @@ TEST(ZeInfoMetadataExtractionFromElf, givenValidElfNotContainingZeInfoSectionWhe
     EXPECT_EQ(nullptr, zeInfoStr32B.data());
     EXPECT_EQ(nullptr, zeInfoStr64B.data());
 }
+
+namespace {
+std::string createZeInfoWithKernels(uint32_t kernelsCount, const std::vector<uint32_t> &invalidKernels) {
+    std::string zeInfo = "kernels:\n";
+    for (uint32_t kernelId = 0u; kernelId < kernelsCount; kernelId++) {
+        zeInfo += "  - name: kernel_" + std::to_string(kernelId) + "\n";
+        zeInfo += "    unknown_entry_" + std::to_string(kernelId) + ": 1\n";
+        if (std::find(invalidKernels.begin(), invalidKernels.end(), kernelId) != invalidKernels.end()) {
+            continue;
+        }
+        zeInfo += "    execution_env:\n";
+        zeInfo += "      simd_size: " + std::to_string(8u << (kernelId % 3)) + "\n";
+    }
+    return zeInfo;
+}
+
+DecodeError decodeZeInfoKernelsWithWorkers(int32_t workersCount, const std::string &zeInfo, NEO::ProgramInfo &programInfo, std::string &errors, std::string &warnings) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.ZebinDecodeWorkerThreads.set(workersCount);
+
+    NEO::Yaml::YamlParser parser;
+    if (false == parser.parse(zeInfo, errors, warnings)) {
+        return DecodeError::invalidBinary;
+    }
+    ZeInfo::ZeInfoSections zeInfoSections;
+    zeInfoSections.kernels.push_back(parser.findNodeWithKeyDfs("kernels"));
+    return ZeInfo::decodeZeInfoKernels(programInfo, parser, zeInfoSections, errors, warnings, ZeInfo::zeInfoDecoderVersion);
+}
+} // namespace
+
+TEST(DecodeZeInfoKernelsTest, whenGettingDecodeWorkersCountThenDebugFlagAndKernelsCountAreRespected) {
+    DebugManagerStateRestore restorer;
+
+    EXPECT_EQ(1u, ZeInfo::getZeInfoKernelsDecodeWorkersCount(0u));
+    EXPECT_EQ(1u, ZeInfo::getZeInfoKernelsDecodeWorkersCount(10u));
+    EXPECT_LE(ZeInfo::getZeInfoKernelsDecodeWorkersCount(10000u), 8u);
+
+    NEO::debugManager.flags.ZebinDecodeWorkerThreads.set(0);
+    EXPECT_EQ(1u, ZeInfo::getZeInfoKernelsDecodeWorkersCount(10000u));
+
+    NEO::debugManager.flags.ZebinDecodeWorkerThreads.set(4);
+    EXPECT_EQ(4u, ZeInfo::getZeInfoKernelsDecodeWorkersCount(10000u));
+    EXPECT_EQ(2u, ZeInfo::getZeInfoKernelsDecodeWorkersCount(2u));
+}
+
+TEST(DecodeZeInfoKernelsTest, givenManyKernelsWhenDecodingOnMultipleThreadsThenResultMatchesSingleThreadedDecoding) {
+    constexpr uint32_t kernelsCount = 500u;
+    auto zeInfo = createZeInfoWithKernels(kernelsCount, {});
+
+    NEO::ProgramInfo sequentialProgramInfo, parallelProgramInfo;
+    std::string sequentialErrors, sequentialWarnings, parallelErrors, parallelWarnings;
+    EXPECT_EQ(DecodeError::success, decodeZeInfoKernelsWithWorkers(1, zeInfo, sequentialProgramInfo, sequentialErrors, sequentialWarnings));
+    EXPECT_EQ(DecodeError::success, decodeZeInfoKernelsWithWorkers(4, zeInfo, parallelProgramInfo, parallelErrors, parallelWarnings));
+
+    EXPECT_TRUE(parallelErrors.empty());
+    EXPECT_EQ(sequentialWarnings, parallelWarnings);
+    EXPECT_NE(std::string::npos, parallelWarnings.find("unknown_entry_499"));
+
+    ASSERT_EQ(kernelsCount, sequentialProgramInfo.kernelInfos.size());
+    ASSERT_EQ(kernelsCount, parallelProgramInfo.kernelInfos.size());
+    for (uint32_t kernelId = 0u; kernelId < kernelsCount; kernelId++) {
+        auto &parallelDescriptor = parallelProgramInfo.kernelInfos[kernelId]->kernelDescriptor;
+        EXPECT_EQ("kernel_" + std::to_string(kernelId), parallelDescriptor.kernelMetadata.kernelName);
+        EXPECT_EQ(sequentialProgramInfo.kernelInfos[kernelId]->kernelDescriptor.kernelAttributes.simdSize, parallelDescriptor.kernelAttributes.simdSize);
+    }
+}
+
+TEST(DecodeZeInfoKernelsTest, givenMultipleInvalidKernelsWhenDecodingOnMultipleThreadsThenFirstErrorAndPrecedingWarningsAreReported) {
+    constexpr uint32_t kernelsCount = 300u;
+    auto zeInfo = createZeInfoWithKernels(kernelsCount, {7u, 250u});
+
+    NEO::ProgramInfo sequentialProgramInfo, parallelProgramInfo;
+    std::string sequentialErrors, sequentialWarnings, parallelErrors, parallelWarnings;
+    EXPECT_EQ(DecodeError::invalidBinary, decodeZeInfoKernelsWithWorkers(1, zeInfo, sequentialProgramInfo, sequentialErrors, sequentialWarnings));
+    EXPECT_EQ(DecodeError::invalidBinary, decodeZeInfoKernelsWithWorkers(4, zeInfo, parallelProgramInfo, parallelErrors, parallelWarnings));
+
+    EXPECT_FALSE(parallelErrors.empty());
+    EXPECT_EQ(sequentialErrors, parallelErrors);
+    EXPECT_EQ(sequentialWarnings, parallelWarnings);
+    EXPECT_NE(std::string::npos, parallelWarnings.find("unknown_entry_7\""));
+    EXPECT_EQ(std::string::npos, parallelWarnings.find("unknown_entry_8\""));
+    EXPECT_EQ(7u, parallelProgramInfo.kernelInfos.size());
+}
+
+TEST(DecodeZeInfoKernelsTest, givenWorkerThreadCreationFailingWhenDecodingOnMultipleThreadsThenAllKernelsAreDecoded) {
+    constexpr uint32_t kernelsCount = 300u;
+    auto zeInfo = createZeInfoWithKernels(kernelsCount, {});
+
+    uint32_t createWorkerThreadCalled = 0u;
+    static uint32_t *createWorkerThreadCalledPtr = nullptr;
+    VariableBackup<uint32_t *> calledPtrBackup(&createWorkerThreadCalledPtr, &createWorkerThreadCalled);
+    VariableBackup<decltype(ZeInfo::createZeInfoKernelsDecodeWorkerThread)> createWorkerThreadBackup(&ZeInfo::createZeInfoKernelsDecodeWorkerThread, [](std::function<void()> &&work) -> std::thread {
+        if ((*createWorkerThreadCalledPtr)++ > 0u) {
+            throw std::system_error(std::make_error_code(std::errc::resource_unavailable_try_again));
+        }
+        return std::thread(std::move(work));
+    });
+
+    NEO::ProgramInfo programInfo;
+    std::string errors, warnings;
+    EXPECT_EQ(DecodeError::success, decodeZeInfoKernelsWithWorkers(4, zeInfo, programInfo, errors, warnings));
+    EXPECT_EQ(2u, createWorkerThreadCalled);
+
+    EXPECT_TRUE(errors.empty());
+    ASSERT_EQ(kernelsCount, programInfo.kernelInfos.size());
+    for (uint32_t kernelId = 0u; kernelId < kernelsCount; kernelId++) {
+        EXPECT_EQ("kernel_" + std::to_string(kernelId), programInfo.kernelInfos[kernelId]->kernelDescriptor.kernelMetadata.kernelName);
+    }
+}
+
+namespace {
+constexpr NEO::ConstStringRef zeInfoForDecodedMetadataCache = R"===(---
+version:         '1.19'
+kernels:
+  - name:            some_kernel
+    execution_env:
+      grf_count:       128
+      simd_size:       16
+      required_sub_group_size: 16
+    payload_arguments:
+      - arg_type:        global_id_offset
+        offset:          0
+        size:            12
+      - arg_type:        arg_bypointer
+        offset:          16
+        size:            8
+        arg_index:       0
+        addrmode:        stateless
+        addrspace:       global
+        access_type:     readwrite
+      - arg_type:        arg_byvalue
+        offset:          24
+        size:            4
+        arg_index:       1
+    per_thread_payload_arguments:
+      - arg_type:        local_id
+        offset:          0
+        size:            96
+...
+)===";
+} // namespace
+
+TEST(DecodedZeInfoSerializationTest, givenDecodedZeInfoWhenSerializedAndDeserializedThenKernelDescriptorsAreRestored) {
+    NEO::ProgramInfo decodedProgramInfo;
+    std::string errors, warnings;
+    ASSERT_EQ(DecodeError::success, ZeInfo::decodeZeInfo(decodedProgramInfo, zeInfoForDecodedMetadataCache, errors, warnings)) << errors;
+    ASSERT_EQ(1u, decodedProgramInfo.kernelInfos.size());
+
+    auto blob = ZeInfo::serializeDecodedZeInfo(decodedProgramInfo, "some warning\n");
+    ASSERT_FALSE(blob.empty());
+
+    NEO::ProgramInfo restoredProgramInfo;
+    std::string restoredWarnings;
+    ASSERT_TRUE(ZeInfo::deserializeDecodedZeInfo(restoredProgramInfo, blob, restoredWarnings));
+    EXPECT_EQ("some warning\n", restoredWarnings);
+    ASSERT_EQ(1u, restoredProgramInfo.kernelInfos.size());
+
+    const auto &decoded = decodedProgramInfo.kernelInfos[0]->kernelDescriptor;
+    const auto &restored = restoredProgramInfo.kernelInfos[0]->kernelDescriptor;
+    EXPECT_EQ(decoded.kernelMetadata.kernelName, restored.kernelMetadata.kernelName);
+    EXPECT_EQ(decoded.kernelMetadata.requiredSubGroupSize, restored.kernelMetadata.requiredSubGroupSize);
+    EXPECT_EQ(decoded.kernelAttributes.simdSize, restored.kernelAttributes.simdSize);
+    EXPECT_EQ(decoded.kernelAttributes.numGrfRequired, restored.kernelAttributes.numGrfRequired);
+    EXPECT_EQ(decoded.kernelAttributes.crossThreadDataSize, restored.kernelAttributes.crossThreadDataSize);
+    EXPECT_EQ(decoded.kernelAttributes.perThreadDataSize, restored.kernelAttributes.perThreadDataSize);
+    EXPECT_EQ(0, memcmp(decoded.payloadMappings.dispatchTraits.globalWorkOffset, restored.payloadMappings.dispatchTraits.globalWorkOffset, sizeof(decoded.payloadMappings.dispatchTraits.globalWorkOffset)));
+
+    ASSERT_EQ(2u, restored.payloadMappings.explicitArgs.size());
+    const auto &pointerArg = restored.payloadMappings.explicitArgs[0];
+    ASSERT_TRUE(pointerArg.is<NEO::ArgDescriptor::argTPointer>());
+    EXPECT_EQ(decoded.payloadMappings.explicitArgs[0].as<NEO::ArgDescPointer>().stateless, pointerArg.as<NEO::ArgDescPointer>().stateless);
+    EXPECT_EQ(decoded.payloadMappings.explicitArgs[0].as<NEO::ArgDescPointer>().pointerSize, pointerArg.as<NEO::ArgDescPointer>().pointerSize);
+    const auto &valueArg = restored.payloadMappings.explicitArgs[1];
+    ASSERT_TRUE(valueArg.is<NEO::ArgDescriptor::argTValue>());
+    ASSERT_EQ(1u, valueArg.as<NEO::ArgDescValue>().elements.size());
+    EXPECT_EQ(24u, valueArg.as<NEO::ArgDescValue>().elements[0].offset);
+    EXPECT_EQ(4u, valueArg.as<NEO::ArgDescValue>().elements[0].size);
+}
+
+TEST(DecodedZeInfoSerializationTest, givenCorruptedOrTruncatedBlobWhenDeserializingThenFailAndLeaveProgramInfoUntouched) {
+    NEO::ProgramInfo decodedProgramInfo;
+    std::string errors, warnings;
+    ASSERT_EQ(DecodeError::success, ZeInfo::decodeZeInfo(decodedProgramInfo, zeInfoForDecodedMetadataCache, errors, warnings)) << errors;
+    auto blob = ZeInfo::serializeDecodedZeInfo(decodedProgramInfo, "");
+    ASSERT_FALSE(blob.empty());
+
+    NEO::ProgramInfo programInfo;
+    std::string restoredWarnings;
+
+    auto truncatedBlob = blob;
+    truncatedBlob.resize(blob.size() - 1);
+    EXPECT_FALSE(ZeInfo::deserializeDecodedZeInfo(programInfo, truncatedBlob, restoredWarnings));
+
+    auto extendedBlob = blob;
+    extendedBlob.push_back(0u);
+    EXPECT_FALSE(ZeInfo::deserializeDecodedZeInfo(programInfo, extendedBlob, restoredWarnings));
+
+    auto wrongVersionBlob = blob;
+    auto header = reinterpret_cast<ZeInfo::DecodedZeInfoBlobHeader *>(wrongVersionBlob.data());
+    header->version = ZeInfo::decodedZeInfoBlobVersion + 1;
+    EXPECT_FALSE(ZeInfo::deserializeDecodedZeInfo(programInfo, wrongVersionBlob, restoredWarnings));
+
+    EXPECT_FALSE(ZeInfo::deserializeDecodedZeInfo(programInfo, {}, restoredWarnings));
+
+    EXPECT_TRUE(programInfo.kernelInfos.empty());
+    EXPECT_TRUE(restoredWarnings.empty());
+}
+
+TEST(DecodedZeInfoSerializationTest, givenDifferentDecodeInputsWhenGettingCacheKeyThenKeysDiffer) {
+    auto key = ZeInfo::getDecodedZeInfoCacheKey(zeInfoForDecodedMetadataCache, 32u, 0u);
+    EXPECT_EQ(key, ZeInfo::getDecodedZeInfoCacheKey(zeInfoForDecodedMetadataCache, 32u, 0u));
+    EXPECT_NE(key, ZeInfo::getDecodedZeInfoCacheKey(zeInfoForDecodedMetadataCache, 64u, 0u));
+    EXPECT_NE(key, ZeInfo::getDecodedZeInfoCacheKey(zeInfoForDecodedMetadataCache, 32u, 1024u));
+    EXPECT_NE(key, ZeInfo::getDecodedZeInfoCacheKey("kernels:\n", 32u, 0u));
+}
+
+TEST(DecodedZeInfoSerializationTest, givenCompilerCacheWhenDecodingZeInfoThenDecodedMetadataIsStoredOnMissAndReusedOnHit) {
+    NEO::CompilerCacheMock cache;
+
+    NEO::ProgramInfo firstProgramInfo;
+    std::string errors, warnings;
+    EXPECT_EQ(DecodeError::success, decodeZeInfoWithCache(firstProgramInfo, zeInfoForDecodedMetadataCache, &cache, errors, warnings)) << errors;
+    EXPECT_EQ(1u, cache.cacheInvoked);
+    ASSERT_EQ(1u, cache.hashToBinaryMap.size());
+    ASSERT_EQ(1u, firstProgramInfo.kernelInfos.size());
+
+    auto &cachedBlob = cache.hashToBinaryMap.begin()->second;
+    auto cachedHeader = reinterpret_cast<const ZeInfo::DecodedZeInfoBlobHeader *>(cachedBlob.data());
+    EXPECT_EQ(ZeInfo::decodedZeInfoBlobMagic, cachedHeader->magic);
+
+    NEO::ProgramInfo secondProgramInfo;
+    std::string secondErrors, secondWarnings;
+    EXPECT_EQ(DecodeError::success, decodeZeInfoWithCache(secondProgramInfo, zeInfoForDecodedMetadataCache, &cache, secondErrors, secondWarnings));
+    EXPECT_EQ(1u, cache.cacheInvoked);
+    EXPECT_EQ(warnings, secondWarnings);
+    ASSERT_EQ(1u, secondProgramInfo.kernelInfos.size());
+    EXPECT_EQ(firstProgramInfo.kernelInfos[0]->kernelDescriptor.kernelMetadata.kernelName, secondProgramInfo.kernelInfos[0]->kernelDescriptor.kernelMetadata.kernelName);
+    EXPECT_EQ(firstProgramInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.crossThreadDataSize, secondProgramInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.crossThreadDataSize);
+}
+
+TEST(DecodedZeInfoSerializationTest, givenCorruptedCacheEntryWhenDecodingZeInfoThenZeInfoIsDecodedAndCacheEntryIsReplaced) {
+    NEO::CompilerCacheMock cache;
+    NEO::ProgramInfo programInfo;
+    auto cacheKey = ZeInfo::getDecodedZeInfoCacheKey(zeInfoForDecodedMetadataCache, programInfo.grfSize, programInfo.minScratchSpaceSize);
+    cache.hashToBinaryMap[cacheKey] = "corrupted";
+
+    std::string errors, warnings;
+    EXPECT_EQ(DecodeError::success, decodeZeInfoWithCache(programInfo, zeInfoForDecodedMetadataCache, &cache, errors, warnings)) << errors;
+    EXPECT_EQ(1u, programInfo.kernelInfos.size());
+    EXPECT_EQ(1u, cache.cacheInvoked);
+    EXPECT_NE("corrupted", cache.hashToBinaryMap[cacheKey]);
+}
+
+TEST(DecodedZeInfoSerializationTest, givenDecodedZeInfoCacheDisabledWhenDecodingZeInfoThenCompilerCacheIsNotUsed) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableDecodedZeInfoCache.set(0);
+    NEO::CompilerCacheMock cache;
+
+    NEO::ProgramInfo programInfo;
+    std::string errors, warnings;
+    EXPECT_EQ(DecodeError::success, decodeZeInfoWithCache(programInfo, zeInfoForDecodedMetadataCache, &cache, errors, warnings)) << errors;
+    EXPECT_EQ(1u, programInfo.kernelInfos.size());
+    EXPECT_EQ(0u, cache.cacheInvoked);
+}
@@ -13,6 +13,7 @@ namespace NEO {
 struct DirectSubmissionControllerMock : public DirectSubmissionController {
     using DirectSubmissionController::adjustTimeoutOnThrottleAndAcLineStatus;
     using DirectSubmissionController::checkNewSubmissions;
+    using DirectSubmissionController::deadlines;
     using DirectSubmissionController::directSubmissionControllingThread;
     using DirectSubmissionController::directSubmissions;
     using DirectSubmissionController::directSubmissionsMutex;
@@ -21,20 +22,26 @@ struct DirectSubmissionControllerMock : public DirectSubmissionController {
     using DirectSubmissionController::lastTerminateCpuTimestamp;
     using DirectSubmissionController::lowestThrottleSubmitted;
     using DirectSubmissionController::maxTimeout;
+    using DirectSubmissionController::nextDeadline;
+    using DirectSubmissionController::pendingSubmissions;
     using DirectSubmissionController::timeout;
     using DirectSubmissionController::timeoutDivisor;
     using DirectSubmissionController::timeoutParamsMap;
 
     void sleep() override {
-        DirectSubmissionController::sleep();
         this->sleepCalled = true;
+        DirectSubmissionController::sleep();
     }
 
     SteadyClock::time_point getCpuTimestamp() override {
+        if (callBaseGetCpuTimestamp) {
+            return DirectSubmissionController::getCpuTimestamp();
+        }
         return cpuTimestamp;
     }
 
     SteadyClock::time_point cpuTimestamp{};
     std::atomic<bool> sleepCalled{false};
+    bool callBaseGetCpuTimestamp = false;
 };
 } // namespace NEO
\ No newline at end of file
@@ -55,19 +55,28 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegiste
     EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 5u);
 
     csr.taskCount.store(6u);
+    controller.cpuTimestamp += controller.timeout;
     controller.checkNewSubmissions();
     EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
     EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 6u);
 
+    controller.cpuTimestamp += controller.timeout / 2;
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 6u);
+
+    controller.cpuTimestamp += controller.timeout / 2;
     controller.checkNewSubmissions();
     EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
     EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 6u);
 
+    controller.cpuTimestamp += controller.timeout;
     controller.checkNewSubmissions();
     EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
     EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 6u);
 
     csr.taskCount.store(8u);
+    controller.notifySubmission(&csr);
     controller.checkNewSubmissions();
     EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
     EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 8u);
@@ -75,6 +84,139 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegiste
     controller.unregisterDirectSubmission(&csr);
 }
 
+TEST(DirectSubmissionControllerTests, givenNoLiveDirectSubmissionsWhenCheckingSubmissionsThenNoDeadlineIsScheduled) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    DirectSubmissionControllerMock controller;
+    EXPECT_EQ(SteadyClock::time_point::max(), controller.nextDeadline);
+
+    controller.registerDirectSubmission(&csr);
+    EXPECT_EQ(1u, controller.pendingSubmissions.size());
+
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.pendingSubmissions.empty());
+    EXPECT_EQ(controller.cpuTimestamp + controller.timeout, controller.nextDeadline);
+
+    controller.cpuTimestamp += controller.timeout;
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_TRUE(controller.deadlines.empty());
+    EXPECT_EQ(SteadyClock::time_point::max(), controller.nextDeadline);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
+TEST(DirectSubmissionControllerTests, givenUnregisteredDirectSubmissionWhenItsDeadlinePassesThenItIsSkipped) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    DirectSubmissionControllerMock controller;
+    controller.registerDirectSubmission(&csr);
+    controller.checkNewSubmissions();
+    EXPECT_EQ(1u, controller.deadlines.size());
+
+    controller.unregisterDirectSubmission(&csr);
+    controller.cpuTimestamp += controller.timeout;
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.deadlines.empty());
+    EXPECT_EQ(0u, controller.directSubmissions.size());
+}
+
+TEST(DirectSubmissionControllerTests, givenControllerTrackingCsrWhenCsrNotifiesAgainThenNoNewSubmissionIsPostedUntilRingIsStopped) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    auto controller = new DirectSubmissionControllerMock();
+    executionEnvironment.directSubmissionController.reset(controller);
+    controller->registerDirectSubmission(&csr);
+    controller->checkNewSubmissions();
+
+    csr.notifyDirectSubmissionController();
+    EXPECT_TRUE(controller->pendingSubmissions.empty());
+    EXPECT_NE(SteadyClock::time_point{}, csr.getLastDirectSubmissionNotifyTimestamp());
+
+    controller->cpuTimestamp += controller->timeout;
+    controller->checkNewSubmissions();
+    EXPECT_TRUE(controller->directSubmissions[&csr].isStopped);
+
+    csr.taskCount.store(1u);
+    csr.notifyDirectSubmissionController();
+    EXPECT_EQ(1u, controller->pendingSubmissions.size());
+    csr.notifyDirectSubmissionController();
+    EXPECT_EQ(1u, controller->pendingSubmissions.size());
+
+    controller->checkNewSubmissions();
+    EXPECT_FALSE(controller->directSubmissions[&csr].isStopped);
+    EXPECT_EQ(1u, controller->directSubmissions[&csr].taskCount);
+
+    controller->unregisterDirectSubmission(&csr);
+}
+
+TEST(DirectSubmissionControllerTests, givenSubmissionAfterDeadlineWasArmedWhenDeadlineExpiresThenRingIsStoppedOneTimeoutAfterLastSubmission) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    DirectSubmissionControllerMock controller;
+    controller.registerDirectSubmission(&csr);
+    controller.checkNewSubmissions();
+    EXPECT_EQ(controller.cpuTimestamp + controller.timeout, controller.nextDeadline);
+
+    const SteadyClock::time_point lastSubmission = controller.cpuTimestamp + controller.timeout * 3 / 4;
+    csr.taskCount.store(1u);
+    csr.lastDirectSubmissionNotifyTimestamp.store(lastSubmission.time_since_epoch().count());
+
+    controller.cpuTimestamp += controller.timeout;
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(1u, controller.directSubmissions[&csr].taskCount);
+    EXPECT_EQ(lastSubmission + controller.timeout, controller.directSubmissions[&csr].deadline);
+    EXPECT_EQ(lastSubmission + controller.timeout, controller.nextDeadline);
+
+    controller.cpuTimestamp = lastSubmission + controller.timeout - std::chrono::microseconds(1);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+
+    controller.cpuTimestamp = lastSubmission + controller.timeout;
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(1u, controller.directSubmissions[&csr].taskCount);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
 TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerAndDivisorDisabledWhenIncreaseTimeoutEnabledThenTimeoutIsIncreased) {
     DebugManagerStateRestore restorer;
     debugManager.flags.DirectSubmissionControllerMaxTimeout.set(200'000);
@@ -95,6 +237,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerAndDivisorD
     controller.registerDirectSubmission(&csr);
     {
         csr.taskCount.store(1u);
+        controller.notifySubmission(&csr);
         controller.checkNewSubmissions();
         EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
         EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 1u);
@@ -110,6 +253,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerAndDivisorD
     }
     {
         csr.taskCount.store(2u);
+        controller.notifySubmission(&csr);
         controller.checkNewSubmissions();
         EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
         EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 2u);
@@ -124,6 +268,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerAndDivisorD
     }
     {
         csr.taskCount.store(3u);
+        controller.notifySubmission(&csr);
         controller.checkNewSubmissions();
         EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
         EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 3u);
@@ -139,6 +284,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerAndDivisorD
     {
         controller.timeout = std::chrono::microseconds(5'000);
         csr.taskCount.store(4u);
+        controller.notifySubmission(&csr);
         controller.checkNewSubmissions();
         EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
         EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 4u);
@@ -221,6 +367,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerAndAdjustOn
         csr.getLastDirectSubmissionThrottleReturnValue = QueueThrottle::LOW;
         csr.getAcLineConnectedReturnValue = true;
         csr.taskCount.store(1u);
+        controller.notifySubmission(&csr);
         controller.checkNewSubmissions();
         EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
         EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 1u);
@@ -235,6 +382,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerAndAdjustOn
         csr.getLastDirectSubmissionThrottleReturnValue = QueueThrottle::MEDIUM;
         csr.getAcLineConnectedReturnValue = true;
         csr.taskCount.store(2u);
+        controller.notifySubmission(&csr);
         controller.checkNewSubmissions();
         EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
         EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 2u);
@@ -249,6 +397,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerAndAdjustOn
         csr.getLastDirectSubmissionThrottleReturnValue = QueueThrottle::HIGH;
         csr.getAcLineConnectedReturnValue = true;
         csr.taskCount.store(3u);
+        controller.notifySubmission(&csr);
         controller.checkNewSubmissions();
         EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
         EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 3u);
@@ -263,6 +412,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerAndAdjustOn
         csr.getLastDirectSubmissionThrottleReturnValue = QueueThrottle::LOW;
         csr.getAcLineConnectedReturnValue = false;
         csr.taskCount.store(4u);
+        controller.notifySubmission(&csr);
         controller.checkNewSubmissions();
         EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
         EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 4u);
@@ -277,6 +427,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerAndAdjustOn
         csr.getLastDirectSubmissionThrottleReturnValue = QueueThrottle::MEDIUM;
         csr.getAcLineConnectedReturnValue = false;
         csr.taskCount.store(5u);
+        controller.notifySubmission(&csr);
         controller.checkNewSubmissions();
         EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
         EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 5u);
@@ -291,6 +442,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerAndAdjustOn
         csr.getLastDirectSubmissionThrottleReturnValue = QueueThrottle::HIGH;
         csr.getAcLineConnectedReturnValue = false;
         csr.taskCount.store(6u);
+        controller.notifySubmission(&csr);
         controller.checkNewSubmissions();
         EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
         EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 6u);
@@ -302,6 +454,7 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerAndAdjustOn
 
     {
         controller.lowestThrottleSubmitted = QueueThrottle::LOW;
+        controller.cpuTimestamp += controller.timeout;
         controller.checkNewSubmissions();
         EXPECT_EQ(QueueThrottle::HIGH, controller.lowestThrottleSubmitted);
     }
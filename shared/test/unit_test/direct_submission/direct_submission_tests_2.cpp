@@ -9,6 +9,7 @@
 #include "shared/source/command_stream/submissions_aggregator.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/direct_submission/direct_submission_hw.h"
+#include "shared/source/direct_submission/direct_submission_telemetry.h"
 #include "shared/source/direct_submission/dispatchers/render_dispatcher.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
@@ -2761,3 +2762,186 @@ HWTEST_F(DirectSubmissionDispatchBufferTest, givenNotStartedDirectSubmissionWhen
 
     EXPECT_FALSE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
 }
+
+TEST(LogScaleHistogramTest, whenRecordingSamplesThenLog2BucketIsIncremented) {
+    LogScaleHistogram histogram;
+
+    EXPECT_EQ(0u, LogScaleHistogram::getBucketIndex(0u));
+    EXPECT_EQ(1u, LogScaleHistogram::getBucketIndex(1u));
+    EXPECT_EQ(2u, LogScaleHistogram::getBucketIndex(2u));
+    EXPECT_EQ(2u, LogScaleHistogram::getBucketIndex(3u));
+    EXPECT_EQ(11u, LogScaleHistogram::getBucketIndex(1024u));
+    EXPECT_EQ(LogScaleHistogram::bucketsCount - 1, LogScaleHistogram::getBucketIndex(std::numeric_limits<uint64_t>::max()));
+
+    histogram.record(0u);
+    histogram.record(3u);
+    histogram.record(2u);
+    histogram.record(std::numeric_limits<uint64_t>::max());
+
+    EXPECT_EQ(1u, histogram.getBucket(0u));
+    EXPECT_EQ(2u, histogram.getBucket(2u));
+    EXPECT_EQ(1u, histogram.getBucket(LogScaleHistogram::bucketsCount - 1));
+    EXPECT_EQ(4u, histogram.getSamplesCount());
+}
+
+TEST(LogScaleHistogramTest, whenPrintingHistogramThenOnlyNonEmptyBucketsArePrinted) {
+    LogScaleHistogram histogram;
+    EXPECT_EQ("", histogram.toString());
+
+    histogram.record(5u);
+    histogram.record(6u);
+
+    auto output = histogram.toString();
+    EXPECT_NE(std::string::npos, output.find("[4, 8): 2"));
+    EXPECT_EQ(std::string::npos, output.find("[0, 1)"));
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenTelemetryDisabledWhenCreatingDirectSubmissionThenTelemetryIsNotCollected) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_EQ(nullptr, directSubmission.getTelemetry());
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenTelemetryEnabledWhenDispatchingCommandBuffersThenCountersAndHistogramsAreUpdated) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionTelemetry.set(1);
+
+    FlushStampTracker flushStamp(true);
+
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    auto telemetry = directSubmission.getTelemetry();
+    ASSERT_NE(nullptr, telemetry);
+
+    EXPECT_TRUE(directSubmission.initialize(true, false));
+    EXPECT_EQ(1u, telemetry->ringStarts.load());
+
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+
+    EXPECT_EQ(2u, telemetry->submissions.load());
+    EXPECT_EQ(1u, telemetry->ringStarts.load());
+    EXPECT_EQ(2u, telemetry->dispatchCpuTimeNs.getSamplesCount());
+    EXPECT_EQ(3u, telemetry->semaphoreSectionNs.getSamplesCount());
+
+    EXPECT_TRUE(directSubmission.stopRingBuffer(false));
+    EXPECT_EQ(1u, telemetry->ringStops.load());
+
+    EXPECT_TRUE(directSubmission.stopRingBuffer(false));
+    EXPECT_EQ(1u, telemetry->ringStops.load());
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenTelemetryEnabledWhenRingIsNotStartedThenFirstDispatchCountsRingStart) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionTelemetry.set(1);
+
+    FlushStampTracker flushStamp(true);
+
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_TRUE(directSubmission.initialize(false, false));
+    EXPECT_EQ(0u, directSubmission.getTelemetry()->ringStarts.load());
+
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(1u, directSubmission.getTelemetry()->ringStarts.load());
+    EXPECT_EQ(1u, directSubmission.getTelemetry()->submissions.load());
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenTelemetryPrintingEnabledWhenDirectSubmissionIsDestroyedThenTelemetryIsPrinted) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionTelemetry.set(2);
+
+    testing::internal::CaptureStdout();
+    {
+        MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+        EXPECT_NE(nullptr, directSubmission.getTelemetry());
+    }
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("submissions 0"));
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenTelemetryEnabledWhenDispatchingCommandBufferThenGpuStartTimestampIsStoredBeforeBatchStart) {
+    using MI_STORE_REGISTER_MEM = typename FamilyType::MI_STORE_REGISTER_MEM;
+    using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
+    using Dispatcher = RenderDispatcher<FamilyType>;
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionTelemetry.set(1);
+    debugManager.flags.DirectSubmissionFlatRingBuffer.set(0);
+
+    FlushStampTracker flushStamp(true);
+
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_TRUE(directSubmission.initialize(true, false));
+    EXPECT_EQ(directSubmission.semaphoreGpuVa + sizeof(RingSemaphoreData), directSubmission.gpuStartTimestampsGpuVa);
+    EXPECT_EQ(2 * sizeof(MI_STORE_REGISTER_MEM), directSubmission.getSizeGpuStartTimestampSection());
+
+    size_t usedBefore = directSubmission.ringCommandStream.getUsed();
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(1u, directSubmission.getTelemetry()->currentGpuStartTimestampSlot);
+
+    HardwareParse hwParse;
+    hwParse.parseCommands<FamilyType>(directSubmission.ringCommandStream, usedBefore);
+
+    auto srmIt = find<MI_STORE_REGISTER_MEM *>(hwParse.cmdList.begin(), hwParse.cmdList.end());
+    ASSERT_NE(hwParse.cmdList.end(), srmIt);
+    auto srmLow = genCmdCast<MI_STORE_REGISTER_MEM *>(*srmIt);
+    EXPECT_EQ(RegisterOffsets::globalTimestampLdw, srmLow->getRegisterAddress());
+    EXPECT_EQ(directSubmission.gpuStartTimestampsGpuVa, srmLow->getMemoryAddress());
+
+    auto srmHigh = genCmdCast<MI_STORE_REGISTER_MEM *>(*(++srmIt));
+    ASSERT_NE(nullptr, srmHigh);
+    EXPECT_EQ(RegisterOffsets::globalTimestampUn, srmHigh->getRegisterAddress());
+    EXPECT_EQ(directSubmission.gpuStartTimestampsGpuVa + sizeof(uint32_t), srmHigh->getMemoryAddress());
+
+    auto bbStart = genCmdCast<MI_BATCH_BUFFER_START *>(*(++srmIt));
+    ASSERT_NE(nullptr, bbStart);
+    EXPECT_EQ(ptrOffset(batchBuffer.commandBufferAllocation->getGpuAddress(), batchBuffer.startOffset), bbStart->getBatchBufferStartAddress());
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenGpuStartTimestampStoredWhenRingIsStoppedThenSubmitToGpuStartLatencyIsRecorded) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionTelemetry.set(1);
+
+    FlushStampTracker flushStamp(true);
+
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_TRUE(directSubmission.initialize(true, false));
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+
+    auto telemetry = directSubmission.telemetry.get();
+    telemetry->setGpuCpuTimeReference(1000u, 1500u, 2.0);
+    telemetry->submitCpuTimestampsNs[0] = 2000u;
+    directSubmission.gpuStartTimestamps[0] = 1500u;
+    EXPECT_EQ(0u, telemetry->submitToGpuStartNs.getSamplesCount());
+
+    EXPECT_TRUE(directSubmission.stopRingBuffer(true));
+
+    EXPECT_EQ(1u, telemetry->submitToGpuStartNs.getSamplesCount());
+    EXPECT_EQ(1u, telemetry->submitToGpuStartNs.getBucket(LogScaleHistogram::getBucketIndex(500u)));
+    EXPECT_EQ(0u, telemetry->submitCpuTimestampsNs[0]);
+    EXPECT_EQ(0u, static_cast<uint64_t>(directSubmission.gpuStartTimestamps[0]));
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenGpuStartTimestampSlotReusedWhenDispatchingCommandBufferThenPreviousSampleIsRecorded) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionTelemetry.set(1);
+
+    FlushStampTracker flushStamp(true);
+
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_TRUE(directSubmission.initialize(true, false));
+
+    auto telemetry = directSubmission.telemetry.get();
+    telemetry->setGpuCpuTimeReference(1000u, 1500u, 1.0);
+    telemetry->submitCpuTimestampsNs[0] = 2000u;
+    directSubmission.gpuStartTimestamps[0] = 1100u;
+
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+
+    EXPECT_EQ(1u, telemetry->submitToGpuStartNs.getSamplesCount());
+    EXPECT_EQ(1u, telemetry->submitToGpuStartNs.getBucket(0u));
+}
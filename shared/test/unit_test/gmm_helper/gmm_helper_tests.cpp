@@ -535,6 +535,67 @@ TEST_F(GmmHelperTests, GivenPlaneWhenCopyingResourceBltThenResourceIsCopiedCorre
     EXPECT_EQ(5u, mockResInfo->cpuBltCalled);
 }
 
+TEST_F(GmmHelperTests, GivenRegionWhenCopyingResourceBltThenRegionAndSystemMemoryLayoutArePassedToGmm) {
+    ImageDescriptor imgDesc = {};
+    imgDesc.imageType = ImageType::image3D;
+    imgDesc.imageWidth = 17;
+    imgDesc.imageHeight = 17;
+    imgDesc.imageDepth = 17;
+
+    auto imgInfo = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+
+    auto gmm = MockGmm::queryImgParams(getGmmHelper(), imgInfo, false);
+    auto mockResInfo = static_cast<MockGmmResourceInfo *>(gmm->gmmResourceInfo.get());
+
+    GMM_RES_COPY_BLT &requestedCpuBlt = mockResInfo->requestedResCopyBlt;
+    mockResInfo->cpuBltCalled = 0u;
+    GMM_RES_COPY_BLT expectedCpuBlt = {};
+    char sys(0), gpu(0);
+    uint32_t bytesPerPixel = 4;
+    uint32_t rowPitch = 17 * bytesPerPixel;
+    uint32_t slicePitch = rowPitch * 17;
+    size_t origin[3] = {1, 2, 3};
+    size_t region[3] = {15, 14, 13};
+
+    expectedCpuBlt.Gpu.pData = &gpu;
+    expectedCpuBlt.Gpu.OffsetX = 1;
+    expectedCpuBlt.Gpu.OffsetY = 2;
+    expectedCpuBlt.Gpu.Slice = 3;
+    expectedCpuBlt.Sys.pData = &sys;
+    expectedCpuBlt.Sys.RowPitch = rowPitch;
+    expectedCpuBlt.Sys.SlicePitch = slicePitch;
+    expectedCpuBlt.Sys.PixelPitch = bytesPerPixel;
+    expectedCpuBlt.Sys.BufferSize = slicePitch * 12 + rowPitch * 13 + bytesPerPixel * 15;
+    expectedCpuBlt.Blt.Width = 15;
+    expectedCpuBlt.Blt.Height = 14;
+    expectedCpuBlt.Blt.Slices = 13;
+    expectedCpuBlt.Blt.BytesPerPixel = bytesPerPixel;
+    expectedCpuBlt.Blt.Upload = 1u;
+
+    auto retVal = gmm->resourceCopyBltRegion(&sys, &gpu, rowPitch, slicePitch, bytesPerPixel, origin, region, 1u);
+    EXPECT_EQ(1u, retVal);
+    EXPECT_TRUE(memcmp(&expectedCpuBlt, &requestedCpuBlt, sizeof(GMM_RES_COPY_BLT)) == 0);
+    EXPECT_EQ(1u, mockResInfo->cpuBltCalled);
+
+    size_t origin2d[3] = {0, 0, 0};
+    size_t region2d[3] = {17, 17, 1};
+    expectedCpuBlt.Gpu.OffsetX = 0;
+    expectedCpuBlt.Gpu.OffsetY = 0;
+    expectedCpuBlt.Gpu.Slice = 0;
+    expectedCpuBlt.Sys.SlicePitch = 0u;
+    expectedCpuBlt.Sys.BufferSize = rowPitch * 17;
+    expectedCpuBlt.Blt.Width = 17;
+    expectedCpuBlt.Blt.Height = 17;
+    expectedCpuBlt.Blt.Slices = 1;
+    expectedCpuBlt.Blt.Upload = 0u;
+
+    mockResInfo->cpuBltResult = 0u;
+    retVal = gmm->resourceCopyBltRegion(&sys, &gpu, rowPitch, 0u, bytesPerPixel, origin2d, region2d, 0u);
+    EXPECT_EQ(0u, retVal);
+    EXPECT_TRUE(memcmp(&expectedCpuBlt, &requestedCpuBlt, sizeof(GMM_RES_COPY_BLT)) == 0);
+    EXPECT_EQ(2u, mockResInfo->cpuBltCalled);
+}
+
 TEST_F(GmmHelperTests, givenAllValidFlagsWhenAskedForUnifiedAuxTranslationCapabilityThenReturnTrue) {
     GmmRequirements gmmRequirements{};
     gmmRequirements.allowLargePages = true;
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_memory_copy.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <algorithm>
+#include <numeric>
+#include <system_error>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+void expectCopied(size_t size, size_t dstOffset, size_t srcOffset, bool dstReadByCpu) {
+    std::vector<uint8_t> src(size + srcOffset + 1);
+    std::iota(src.begin(), src.end(), static_cast<uint8_t>(7));
+    std::vector<uint8_t> dst(size + dstOffset + 1, 0xcd);
+
+    CpuMemoryCopy::copy(dst.data() + dstOffset, src.data() + srcOffset, size, dstReadByCpu);
+
+    for (size_t i = 0; i < dstOffset; i++) {
+        EXPECT_EQ(0xcd, dst[i]);
+    }
+    EXPECT_EQ(0, memcmp(dst.data() + dstOffset, src.data() + srcOffset, size));
+    EXPECT_EQ(0xcd, dst[dstOffset + size]);
+}
+} // namespace
+
+TEST(CpuMemoryCopyTest, givenUnalignedPointersWhenCopyingWithStreamingStoresThenAllBytesAreCopied) {
+    for (size_t size : {0u, 1u, 15u, 16u, 17u, 255u, 4099u}) {
+        for (size_t dstOffset : {0u, 1u, 9u}) {
+            std::vector<uint8_t> src(size + 3);
+            std::iota(src.begin(), src.end(), static_cast<uint8_t>(1));
+            std::vector<uint8_t> dst(size + dstOffset + 1, 0xcd);
+
+            CpuMemoryCopy::copyWithStreamingStores(dst.data() + dstOffset, src.data() + 3, size);
+
+            EXPECT_EQ(0, memcmp(dst.data() + dstOffset, src.data() + 3, size));
+            EXPECT_EQ(0xcd, dst[dstOffset + size]);
+        }
+    }
+}
+
+TEST(CpuMemoryCopyTest, givenWorkersCountAndStreamingStoresForcedWhenCopyingThenAllBytesAreCopied) {
+    DebugManagerStateRestore restore;
+    for (int32_t workersCount : {1, 3, 8}) {
+        for (int32_t streamingStores : {0, 1}) {
+            debugManager.flags.CpuTransferWorkerThreads.set(workersCount);
+            debugManager.flags.CpuTransferStreamingStores.set(streamingStores);
+            expectCopied(0u, 0u, 0u, false);
+            expectCopied(100u, 3u, 5u, false);
+            expectCopied(MemoryConstants::pageSize * 3 + 5, 1u, 0u, true);
+            expectCopied(MemoryConstants::pageSize * 3 + 5, 0u, 7u, false);
+        }
+    }
+}
+
+TEST(CpuMemoryCopyTest, givenDefaultSettingsWhenGettingWorkersCountThenSmallCopiesAreNotSplit) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.CpuTransferWorkerThreads.set(-1);
+    EXPECT_EQ(1u, CpuMemoryCopy::getWorkersCount(0u));
+    EXPECT_EQ(1u, CpuMemoryCopy::getWorkersCount(CpuMemoryCopy::minChunkSizePerWorker));
+    EXPECT_LE(CpuMemoryCopy::getWorkersCount(64 * MemoryConstants::megaByte), CpuMemoryCopy::maxDefaultWorkersCount);
+    EXPECT_LE(1u, CpuMemoryCopy::getWorkersCount(64 * MemoryConstants::megaByte));
+
+    debugManager.flags.CpuTransferWorkerThreads.set(0);
+    EXPECT_EQ(1u, CpuMemoryCopy::getWorkersCount(64 * MemoryConstants::megaByte));
+
+    debugManager.flags.CpuTransferWorkerThreads.set(6);
+    EXPECT_EQ(std::min(6u, std::max(1u, std::thread::hardware_concurrency())), CpuMemoryCopy::getWorkersCount(1u));
+}
+
+TEST(CpuMemoryCopyTest, givenWorkersCountAboveHardwareThreadsCountWhenGettingWorkersCountThenItIsClamped) {
+    DebugManagerStateRestore restore;
+    auto hwThreadsCount = std::max(1u, std::thread::hardware_concurrency());
+    debugManager.flags.CpuTransferWorkerThreads.set(static_cast<int32_t>(hwThreadsCount + 8));
+    EXPECT_EQ(hwThreadsCount, CpuMemoryCopy::getWorkersCount(64 * MemoryConstants::megaByte));
+}
+
+TEST(CpuMemoryCopyTest, givenWorkerThreadCreationFailingWhenCopyingThenAllBytesAreCopiedOnCallingThread) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.CpuTransferWorkerThreads.set(8);
+    uint32_t createWorkerThreadCalled = 0u;
+    static uint32_t *createWorkerThreadCalledPtr = nullptr;
+    VariableBackup<uint32_t *> calledPtrBackup(&createWorkerThreadCalledPtr, &createWorkerThreadCalled);
+    VariableBackup<decltype(CpuMemoryCopy::createWorkerThread)> createWorkerThreadBackup(&CpuMemoryCopy::createWorkerThread, [](std::function<void()> &&work) -> std::thread {
+        if ((*createWorkerThreadCalledPtr)++ > 0u) {
+            throw std::system_error(std::make_error_code(std::errc::resource_unavailable_try_again));
+        }
+        return std::thread(std::move(work));
+    });
+
+    expectCopied(MemoryConstants::pageSize * 3 + 5, 1u, 0u, true);
+    if (std::thread::hardware_concurrency() > 2u) {
+        EXPECT_EQ(2u, createWorkerThreadCalled);
+    }
+}
+
+TEST(CpuMemoryCopyTest, givenDefaultSettingsWhenCheckingStreamingStoresThenOnlyLargeCopiesNotReadByCpuUseThem) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.CpuTransferStreamingStores.set(-1);
+    EXPECT_TRUE(CpuMemoryCopy::isStreamingStoresPreferred(CpuMemoryCopy::minSizeForStreamingStores, false));
+    EXPECT_FALSE(CpuMemoryCopy::isStreamingStoresPreferred(CpuMemoryCopy::minSizeForStreamingStores, true));
+    EXPECT_FALSE(CpuMemoryCopy::isStreamingStoresPreferred(CpuMemoryCopy::minSizeForStreamingStores - 1, false));
+
+    debugManager.flags.CpuTransferStreamingStores.set(1);
+    EXPECT_TRUE(CpuMemoryCopy::isStreamingStoresPreferred(1u, true));
+
+    debugManager.flags.CpuTransferStreamingStores.set(0);
+    EXPECT_FALSE(CpuMemoryCopy::isStreamingStoresPreferred(CpuMemoryCopy::minSizeForStreamingStores, false));
+}
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/test/common/fixtures/device_fixture.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/test_macros/test.h"
@@ -99,3 +100,75 @@ TEST_F(IsaPoolAllocatorTest, givenIsaPoolAllocatorWhenRequestForLargeAllocationT
     verifySharedIsaAllocation(allocation, 0, requestAllocationSize);
     isaAllocator.freeSharedIsaAllocation(allocation);
 }
+
+TEST_F(IsaPoolAllocatorTest, givenIdenticalIsaContentWhenRequestingDeduplicatedAllocationThenSameAllocationIsReturned) {
+    auto &isaAllocator = pDevice->getIsaPoolAllocator();
+    constexpr size_t requestAllocationSize = MemoryConstants::pageSize;
+
+    auto firstAllocation = isaAllocator.requestDeduplicatedGraphicsAllocationForIsa(false, std::vector<uint8_t>(requestAllocationSize, 0xab));
+    verifySharedIsaAllocation(firstAllocation, 0ul, requestAllocationSize);
+    EXPECT_TRUE(firstAllocation->isDeduplicated());
+    auto firstAllocationCpuPtr = firstAllocation->getGraphicsAllocation()->getUnderlyingBuffer();
+    ASSERT_NE(nullptr, firstAllocationCpuPtr);
+    EXPECT_EQ(std::vector<uint8_t>(requestAllocationSize, 0xab), std::vector<uint8_t>(static_cast<uint8_t *>(firstAllocationCpuPtr), static_cast<uint8_t *>(firstAllocationCpuPtr) + requestAllocationSize));
+
+    auto secondAllocation = isaAllocator.requestDeduplicatedGraphicsAllocationForIsa(false, std::vector<uint8_t>(requestAllocationSize, 0xab));
+    EXPECT_EQ(firstAllocation, secondAllocation);
+
+    auto differentContentAllocation = isaAllocator.requestDeduplicatedGraphicsAllocationForIsa(false, std::vector<uint8_t>(requestAllocationSize, 0xcd));
+    verifySharedIsaAllocation(differentContentAllocation, requestAllocationSize, requestAllocationSize);
+    EXPECT_NE(firstAllocation, differentContentAllocation);
+
+    auto builtinAllocation = isaAllocator.requestDeduplicatedGraphicsAllocationForIsa(true, std::vector<uint8_t>(requestAllocationSize, 0xab));
+    ASSERT_NE(nullptr, builtinAllocation);
+    EXPECT_NE(firstAllocation, builtinAllocation);
+    EXPECT_EQ(AllocationType::kernelIsaInternal, builtinAllocation->getGraphicsAllocation()->getAllocationType());
+
+    auto nonDeduplicatedAllocation = isaAllocator.requestGraphicsAllocationForIsa(false, requestAllocationSize);
+    ASSERT_NE(nullptr, nonDeduplicatedAllocation);
+    EXPECT_FALSE(nonDeduplicatedAllocation->isDeduplicated());
+
+    isaAllocator.freeSharedIsaAllocation(nonDeduplicatedAllocation);
+    isaAllocator.freeSharedIsaAllocation(builtinAllocation);
+    isaAllocator.freeSharedIsaAllocation(differentContentAllocation);
+    isaAllocator.freeSharedIsaAllocation(secondAllocation);
+    isaAllocator.freeSharedIsaAllocation(firstAllocation);
+}
+
+TEST_F(IsaPoolAllocatorTest, givenDeduplicatedAllocationWhenAllUsersFreeItThenNextRequestCreatesNewAllocation) {
+    auto &isaAllocator = pDevice->getIsaPoolAllocator();
+    constexpr size_t requestAllocationSize = MemoryConstants::pageSize;
+
+    auto firstAllocation = isaAllocator.requestDeduplicatedGraphicsAllocationForIsa(false, std::vector<uint8_t>(requestAllocationSize, 0xab));
+    auto secondAllocation = isaAllocator.requestDeduplicatedGraphicsAllocationForIsa(false, std::vector<uint8_t>(requestAllocationSize, 0xab));
+    ASSERT_EQ(firstAllocation, secondAllocation);
+
+    isaAllocator.freeSharedIsaAllocation(firstAllocation);
+    EXPECT_TRUE(secondAllocation->isDeduplicated());
+    isaAllocator.freeSharedIsaAllocation(secondAllocation);
+
+    auto newAllocation = isaAllocator.requestDeduplicatedGraphicsAllocationForIsa(false, std::vector<uint8_t>(requestAllocationSize, 0xab));
+    ASSERT_NE(nullptr, newAllocation);
+    EXPECT_TRUE(newAllocation->isDeduplicated());
+    isaAllocator.freeSharedIsaAllocation(newAllocation);
+}
+
+TEST_F(IsaPoolAllocatorTest, givenDeduplicatedAllocationContentsDifferentThanRequestedIsaWhenRequestingDeduplicatedAllocationThenNewAllocationIsReturned) {
+    auto &isaAllocator = pDevice->getIsaPoolAllocator();
+    constexpr size_t requestAllocationSize = MemoryConstants::pageSize;
+
+    auto firstAllocation = isaAllocator.requestDeduplicatedGraphicsAllocationForIsa(false, std::vector<uint8_t>(requestAllocationSize, 0xab));
+    ASSERT_NE(nullptr, firstAllocation);
+    auto firstAllocationCpuPtr = firstAllocation->getGraphicsAllocation()->getUnderlyingBuffer();
+    ASSERT_NE(nullptr, firstAllocationCpuPtr);
+
+    // only hash is kept on host, so matching request is verified against contents of the allocation
+    static_cast<uint8_t *>(ptrOffset(firstAllocationCpuPtr, firstAllocation->getOffset()))[requestAllocationSize - 1] = 0xcd;
+    auto secondAllocation = isaAllocator.requestDeduplicatedGraphicsAllocationForIsa(false, std::vector<uint8_t>(requestAllocationSize, 0xab));
+    ASSERT_NE(nullptr, secondAllocation);
+    EXPECT_NE(firstAllocation, secondAllocation);
+    EXPECT_TRUE(secondAllocation->isDeduplicated());
+
+    isaAllocator.freeSharedIsaAllocation(secondAllocation);
+    isaAllocator.freeSharedIsaAllocation(firstAllocation);
+}